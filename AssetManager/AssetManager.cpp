@@ -14,6 +14,13 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "SOLpch.h"
 #include "SOL/AssetManager/AssetManager.h"
 #include "SOL/Application.h"
+#include "SOL/AssetManager/ContentHash.h"
+#include "SOL/AssetManager/VirtualFileSystem.h"
+#include "SOL/AssetManager/SharedAssetCache.h"
+#include "SOL/Serializer/MappedJson.h"
+#include <rapidjson/reader.h>
+#include <rapidjson/filereadstream.h>
+#include <stb_image.h>
 
 namespace SOL
 {
@@ -21,6 +28,110 @@ namespace SOL
     static std::mt19937_64 s_Engine(s_RandomDevice());
     static std::uniform_int_distribution<uint64_t> s_UniformDistribution;
 
+    /*!**************************************************************************
+    @brief Get the directory cooked .sidx files are written to.
+
+    Resolved through the VirtualFileSystem, so it follows the write path instead
+    of the working directory.
+
+    @return The directory, ending in a separator.
+    *****************************************************************************/
+    static std::string getCookedDir()
+    {
+        std::string cookedDir = VirtualFileSystem::Get().getWritePath("./Assets/Cooked/");
+        if (!cookedDir.empty() && cookedDir.back() != '/' && cookedDir.back() != '\\')
+            cookedDir += '/';
+        return cookedDir;
+    }
+
+    /*!**************************************************************************
+    @brief Remove the cooked .sidx files of a texture.
+
+    Cooked files are named <uuid>-<source hash>.sidx, so every file of the UUID
+    except the one for the current source is stale.
+
+    @param _texUUID The UUID of the texture.
+    @param _keep The file name to keep, empty to remove every cooked file.
+    *****************************************************************************/
+    static void removeCookedTextures(UUID _texUUID, const std::string& _keep = "")
+    {
+        namespace fs = std::filesystem;
+        const std::string prefix = std::to_string(static_cast<uint64_t>(_texUUID));
+        std::error_code ec;
+        std::vector<fs::path> stale;
+        for (fs::directory_iterator it(getCookedDir(), ec), end; !ec && it != end; it.increment(ec))
+        {
+            const std::string name = it->path().filename().string();
+            if (name != _keep && name.compare(0, prefix.size(), prefix) == 0 &&
+                (name.compare(prefix.size(), 1, "-") == 0 || name == prefix + ".sidx"))
+            {
+                stale.push_back(it->path());
+            }
+        }
+        for (const fs::path& path : stale)
+        {
+            fs::remove(path, ec);
+        }
+    }
+
+    /*!**************************************************************************
+    @brief SAX handler that stops the parse at the top level "version" of a
+           manifest, so the asset list is never read.
+    *****************************************************************************/
+    class ManifestVersionHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, ManifestVersionHandler>
+    {
+    public:
+        bool Default() { m_atVersion = false; return true; }
+        bool StartObject() { m_atVersion = false; ++m_depth; return true; }
+        bool EndObject(rapidjson::SizeType) { --m_depth; return true; }
+        bool StartArray() { m_atVersion = false; ++m_depth; return true; }
+        bool EndArray(rapidjson::SizeType) { --m_depth; return true; }
+
+        bool Key(const char* _str, rapidjson::SizeType _length, bool)
+        {
+            m_atVersion = m_depth == 1 && std::string(_str, _length) == "version";
+            return true;
+        }
+
+        bool Uint(unsigned _value)
+        {
+            if (!m_atVersion)
+                return true;
+            m_version = _value;
+            return false;
+        }
+
+        uint32_t m_version{};
+
+    private:
+        int m_depth{};
+        bool m_atVersion{};
+    };
+
+    /*!**************************************************************************
+    @brief Read the version of a manifest without parsing its asset list.
+
+    writeAssetManifest puts the version first, so only the start of the file is
+    read.
+
+    @param _manifestPath The manifest file.
+    @return The version, 0 if the manifest has none or could not be read.
+    *****************************************************************************/
+    static uint32_t readManifestVersion(const std::string& _manifestPath)
+    {
+        std::FILE* file = std::fopen(VirtualFileSystem::Get().getLoadPath(_manifestPath).c_str(), "rb");
+        if (file == nullptr)
+            return 0;
+
+        char block[512];
+        rapidjson::FileReadStream stream(file, block, sizeof(block));
+        ManifestVersionHandler handler;
+        rapidjson::Reader reader;
+        reader.Parse(stream, handler);
+        std::fclose(file);
+        return handler.m_version;
+    }
+
     /*!**************************************************************************
     @brief Default constructor for UUID.
 
@@ -69,84 +180,45 @@ namespace SOL
     *****************************************************************************/
     void AssetManager::initAssetManager() //DESERIALIZE
     {
-        std::ifstream file(m_assetFilepath);
-        if (!file.is_open())
+        // Parsed in place in the mapped file, the document's strings are not copied
+        MappedJson manifest;
+        if (!manifest.Open(m_assetFilepath))
         {
             ANALYTICS_INFO("Failed to open asset file:");
             return;
         }
 
-        std::stringstream buff;
-        buff << file.rdbuf();
-        std::string jsonString = buff.str();
-        file.close();
-
-        rapidjson::Document doc;
-        if (doc.Parse(jsonString.c_str()).HasParseError())
+        if (manifest.HasParseError())
         {
             ANALYTICS_INFO("Failed to parse assets JSON file.");
             return;
         }
+        const JsonParseContext::Document& doc = manifest.GetDocument();
 
-        // Deserialize textures
-        if (doc.HasMember("textures"))
-        {
-            const rapidjson::Value& tex_obj = doc["textures"];
-            for (auto it = tex_obj.MemberBegin(); it != tex_obj.MemberEnd(); ++it)
-            {
-                std::string tex_name = it->name.GetString();
-                UUID texUUID(it->value["UUID"].GetUint64()); // Use provided UUID from json
-                std::string filepath = it->value["filepath"].GetString();
+        readManifestSection(doc, Asset_Type::ASSET_TEXTURES);
+        readManifestSection(doc, Asset_Type::ASSET_AUDIO);
+        readManifestSection(doc, Asset_Type::ASSET_FONT);
 
-                m_textureMap[texUUID].first.LoadTexture(filepath);
-                m_textureMap[texUUID].second = tex_name;
-
-                m_EditorMap[Asset_Type::ASSET_TEXTURES][texUUID].first = tex_name;
-                m_EditorMap[Asset_Type::ASSET_TEXTURES][texUUID].second = filepath;
-            } 
-            ANALYTICS_INFO("Textures successfully deserialized.");
+        // Patches mounted before init are applied on top of the base manifest
+        for (const AssetPack& patch : m_patches)
+        {
+            applyManifestDelta(patch.getManifestDelta());
         }
 
-        //deserialize audios
-        if (doc.HasMember("audios"))
+        // Queue everything in priority order so the first frame's assets are loaded first
+        for (Asset_Type type : { Asset_Type::ASSET_TEXTURES, Asset_Type::ASSET_FONT, Asset_Type::ASSET_AUDIO })
         {
-            const rapidjson::Value& audio_obj = doc["audios"];
-            for (auto it = audio_obj.MemberBegin(); it != audio_obj.MemberEnd(); ++it)
+            for (UUID assetUUID : getSortedAssets(type))
             {
-                std::string audio_name = it->name.GetString();
-                UUID audioUUID(it->value["UUID"].GetUint64());
-                std::string filepath = it->value["filepath"].GetString();
-                //LoadAudio(audio_name, filepath);
-
-                AudioSystem& _audioSystem = Application::Get().GetAudioSystem();
-                _audioSystem.LoadAudio(audio_name, filepath);
-
-                m_audioMap[audioUUID] = audio_name;
-                
-                m_EditorMap[Asset_Type::ASSET_AUDIO][audioUUID].first = audio_name;
-                m_EditorMap[Asset_Type::ASSET_AUDIO][audioUUID].second = filepath;
+                requestLoad(assetUUID, getAssetPriority(assetUUID));
             }
-            ANALYTICS_INFO("Audios successfully initialized.");
         }
 
-        // Deserialize fonts
-        if (doc.HasMember("fonts"))
-        {
-            const rapidjson::Value& font_obj = doc["fonts"];
-            for (auto it = font_obj.MemberBegin(); it != font_obj.MemberEnd(); ++it)
-            {
-                std::string font_name = it->name.GetString();
-                UUID fontUUID(it->value["UUID"].GetUint64()); // Use provided UUID from json
-                std::string filepath = it->value["filepath"].GetString();
-
-                m_fontMap[fontUUID].first.LoadFont(filepath);
-                m_fontMap[fontUUID].second = font_name;
+        // Deferred loading only finishes the critical assets here, updateLoadQueue does the rest
+        updateLoadQueue(m_deferredLoading ? 0.0 : std::numeric_limits<double>::infinity());
+        ANALYTICS_INFO("Assets successfully deserialized, " + std::to_string(getPendingLoadCount()) + " deferred.");
 
-                m_EditorMap[Asset_Type::ASSET_TEXTURES][fontUUID].first = font_name;
-                m_EditorMap[Asset_Type::ASSET_TEXTURES][fontUUID].second = filepath;
-            }
-            ANALYTICS_INFO("Fonts successfully deserialized.");
-        }
+        m_initialized = true;
     }
 
     /*!**************************************************************************
@@ -180,9 +252,22 @@ namespace SOL
 
         // Clear all maps
         m_textureMap.clear();
+        m_pendingUploads.clear();
         m_audioMap.clear();
         m_fontMap.clear();
         m_EditorMap.clear();
+        for (const auto& [uuid, key] : m_sharedLeases)
+        {
+            m_sharedCache.release(key);
+        }
+        m_sharedLeases.clear();
+        m_loadQueue.clear();
+        m_queuedLoads.clear();
+        m_assetPriority.clear();
+        m_indexedTextureMap.clear();
+        m_paletteBank.clear();
+        m_thumbnailCache.clear();
+        m_initialized = false;
     }
 
     /*!**************************************************************************
@@ -211,8 +296,7 @@ namespace SOL
         if (!found)
         {
             UUID texUUID = UUID::generateUUID();
-            m_textureMap[texUUID].first.LoadTexture(_filepath);
-            m_textureMap[texUUID].second = _name;
+            loadTextureAsset(texUUID, _name, _filepath);
 
             m_EditorMap[Asset_Type::ASSET_TEXTURES][texUUID].first = _name;
             m_EditorMap[Asset_Type::ASSET_TEXTURES][texUUID].second = _filepath;
@@ -232,7 +316,12 @@ namespace SOL
     *****************************************************************************/
     void AssetManager::unloadTexture(UUID _uuid)
     {
+        cancelLoad(_uuid);
         m_textureMap.erase(_uuid);
+        m_pendingUploads.erase(_uuid);
+        m_indexedTextureMap.erase(_uuid);
+        releaseSharedTexture(_uuid);
+        m_thumbnailCache.invalidate(_uuid);
         m_EditorMap[Asset_Type::ASSET_TEXTURES].erase(_uuid);
     }
 
@@ -249,22 +338,33 @@ namespace SOL
     void AssetManager::modifyTexture(UUID _texUUID, std::string _filepath)
     {
         //unload texture wait for HAFIZ
-        m_textureMap[_texUUID].first.UnloadTexture();
+        if (!m_pendingUploads.erase(_texUUID))
+            m_textureMap[_texUUID].first.UnloadTexture();
 
-        m_textureMap[_texUUID].first.LoadTexture(_filepath);
         m_EditorMap[Asset_Type::ASSET_TEXTURES][_texUUID].second = _filepath;
+        m_indexedTextureMap.erase(_texUUID);
+        releaseSharedTexture(_texUUID);
+        importIndexedTexture(_texUUID, resolveAssetPath(_filepath));
+        if (getIndexedTexture(_texUUID))
+            m_pendingUploads.insert(_texUUID);
+        else
+            m_textureMap[_texUUID].first.LoadTexture(resolveAssetPath(_filepath));
+        m_thumbnailCache.invalidate(_texUUID);
         ANALYTICS_INFO(m_EditorMap[Asset_Type::ASSET_TEXTURES][_texUUID].first + "Textures successfully modified.");
     }
 
     /*!**************************************************************************
     @brief Get the texture map.
 
-    This function returns a map of texture UUIDs to texture path pairs.
+    This function returns a map of texture UUIDs to texture path pairs. Callers
+    read the handles straight from the map, so pending uploads are done first.
 
     @return A map containing texture UUIDs as keys and texture path pairs as values.
     *****************************************************************************/
     std::unordered_map<UUID, TexPathPair>& AssetManager::getTextureMap()
     {
+        while (!m_pendingUploads.empty())
+            uploadTexture(*m_pendingUploads.begin());
         return m_textureMap;
     }
 
@@ -272,15 +372,17 @@ namespace SOL
     @brief Get the UUID of a texture by name.
 
     This function searches for a texture by name and returns its UUID if found.
+    The editor map is searched, so textures not loaded yet by deferred loading
+    are found too.
 
     @param _name The name of the texture to search for.
     @return The UUID of the texture if found; otherwise, an empty UUID.
     *****************************************************************************/
     UUID AssetManager::getTextureUUID(std::string _name)
     {
-        for (auto it = m_textureMap.begin(); it != m_textureMap.end(); ++it)
+        for (auto it = m_EditorMap[Asset_Type::ASSET_TEXTURES].begin(); it != m_EditorMap[Asset_Type::ASSET_TEXTURES].end(); ++it)
         {
-            if ((*it).second.second == _name)
+            if ((*it).second.first == _name)
                 //ANALYTICS_ERROR((*it).first);
                 return (*it).first;
         }
@@ -297,16 +399,264 @@ namespace SOL
     *****************************************************************************/
     TexPathPair& AssetManager::getTexture(UUID _UUID)
     {
+        ensureLoaded(_UUID);
         m_TexPair = TexPathPair();
         if (m_textureMap.count(_UUID))
         {
             //ANALYTICS_CRITICAL(_UUID);
 
+            uploadTexture(_UUID);
             return m_textureMap[_UUID];
         }
         return m_TexPair;
     }
 
+    /*!**************************************************************************
+    @brief Get the palette-indexed form of a texture.
+
+    Textures with 256 colours or less are stored as 4 or 8 bit indices into a
+    shared palette when they are imported.
+
+    @param _UUID The UUID of the texture.
+    @return A pointer to the indexed texture, nullptr if the texture has too many
+            colours or is not loaded.
+    *****************************************************************************/
+    IndexedTexture* AssetManager::getIndexedTexture(UUID _UUID)
+    {
+        auto it = m_indexedTextureMap.find(_UUID);
+        if (it == m_indexedTextureMap.end() || !it->second.isIndexed())
+            return nullptr;
+        return &it->second;
+    }
+
+    /*!**************************************************************************
+    @brief Expand an indexed texture to RGBA8 pixels.
+
+    Only call this where full colour pixels are needed, the indexed form is what
+    is kept in memory.
+
+    @param _UUID The UUID of the texture.
+    @param _rgba Receives width * height * 4 bytes.
+    @param _palette Optional palette to expand with instead of the texture's own,
+                    used for palette-swap effects.
+    @return True if the texture was indexed and has been expanded.
+    *****************************************************************************/
+    bool AssetManager::expandTexture(UUID _UUID, std::vector<uint8_t>& _rgba, const Palette* _palette)
+    {
+        IndexedTexture* indexed = getIndexedTexture(_UUID);
+        if (!indexed)
+            return false;
+
+        expandIndexedTexture(*indexed, _palette ? *_palette : m_paletteBank.getPalette(indexed->m_PaletteID), _rgba);
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Replace the palette colours of a single indexed texture.
+
+    @param _UUID The UUID of the texture.
+    @param _palette The new colours, must not exceed the old palette size.
+    @return True if the texture was indexed and its palette has been replaced.
+    *****************************************************************************/
+    bool AssetManager::setTexturePalette(UUID _UUID, const Palette& _palette)
+    {
+        IndexedTexture* indexed = getIndexedTexture(_UUID);
+        if (!indexed)
+            return false;
+
+        // Copy on write, a deduplicated palette may be used by other textures
+        for (const auto& [uuid, other] : m_indexedTextureMap)
+        {
+            if (uuid != _UUID && other.isIndexed() && other.m_PaletteID == indexed->m_PaletteID)
+            {
+                indexed->m_PaletteID = m_paletteBank.addPrivatePalette(m_paletteBank.getPalette(indexed->m_PaletteID));
+                break;
+            }
+        }
+
+        m_paletteBank.setPalette(indexed->m_PaletteID, _palette);
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Get the asset browser preview of a texture.
+
+    Previews are generated on the worker pool and cached on disk by content
+    hash, so this never decodes on the calling thread. A placeholder is returned
+    until the preview is ready.
+
+    @param _UUID The UUID of the texture.
+    @return The preview, or the placeholder if it is not ready.
+    *****************************************************************************/
+    const Thumbnail& AssetManager::getThumbnail(UUID _UUID)
+    {
+        auto& textures = m_EditorMap[Asset_Type::ASSET_TEXTURES];
+        auto it = textures.find(_UUID);
+        if (it == textures.end())
+            return m_thumbnailCache.getPlaceholder();
+
+        return m_thumbnailCache.getThumbnail(_UUID, resolveAssetPath(it->second.second));
+    }
+
+    /*!**************************************************************************
+    @brief Import the palette-indexed form of a texture.
+
+    Reads the cooked .sidx file of the current source contents, otherwise
+    decodes the image, indexes it if it has 256 colours or less and writes the
+    cooked file for the next run. The cooked file is keyed by the hash of the
+    source, so pointing the UUID at another image never serves stale indices.
+
+    @param _texUUID The UUID of the texture.
+    @param _filepath The file path of the source image.
+    *****************************************************************************/
+    void AssetManager::importIndexedTexture(UUID _texUUID, const std::string& _filepath)
+    {
+        CookedTexture cooked;
+        if (cookIndexedTexture(_texUUID, _filepath, cooked, m_sharedCache.isOpen() ? &m_sharedCache : nullptr))
+        {
+            registerIndexedTexture(_texUUID, _filepath, cooked);
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Produce the palette-indexed form of a texture without touching the
+           AssetManager, so it can run on a worker thread.
+
+    @param _texUUID The UUID of the texture.
+    @param _filepath The file path of the source image.
+    @param _cooked Receives the indexed texture and its palette.
+    @param _shared The shared asset cache to attach to or publish in, may be nullptr.
+    @return True if the texture was read or decoded.
+    *****************************************************************************/
+    bool AssetManager::cookIndexedTexture(UUID _texUUID, const std::string& _filepath, CookedTexture& _cooked, SharedAssetCache* _shared)
+    {
+        // Read once, the same bytes are hashed and decoded on a miss
+        std::vector<uint8_t> source;
+        const ContentHash sourceHash = readFileBytes(_filepath, source) ? hashBytes(source.data(), source.size()) : 0;
+
+        // Another process may already hold the indices for the same image
+        ContentHash sharedKey{};
+        if (_shared)
+        {
+            sharedKey = sourceHash ? hashBytes("SIDX", 4, sourceHash) : 0;
+
+            size_t size{};
+            const uint8_t* payload = sharedKey ? _shared->acquire(sharedKey, size) : nullptr;
+            if (payload)
+            {
+                if (decodeIndexedTexture(payload, size, _cooked.m_Indexed, _cooked.m_Palette, true))
+                {
+                    _cooked.m_SharedKey = sharedKey;
+                    return true;
+                }
+                _shared->release(sharedKey);
+            }
+        }
+
+        namespace fs = std::filesystem;
+        const std::string cookedName = std::to_string(static_cast<uint64_t>(_texUUID)) + "-" + hashToString(sourceHash) + ".sidx";
+        const std::string cookedDir = getCookedDir();
+        const std::string cookedPath = cookedDir + cookedName;
+
+        IndexedTexture& indexed = _cooked.m_Indexed;
+        Palette& palette = _cooked.m_Palette;
+        std::error_code ec;
+
+        bool upToDate = sourceHash && fs::exists(cookedPath, ec);
+
+        if (!upToDate || !readIndexedTexture(cookedPath, indexed, palette))
+        {
+            int width{}, height{}, channels{};
+            stbi_uc* pixels = source.empty() ? nullptr
+                : stbi_load_from_memory(source.data(), static_cast<int>(source.size()), &width, &height, &channels, 4);
+            if (!pixels)
+            {
+                ANALYTICS_ERROR("Failed to decode " + _filepath + " for indexing.");
+                return false;
+            }
+
+            if (!buildIndexedTexture(pixels, width, height, palette, indexed))
+            {
+                indexed = IndexedTexture();
+                indexed.m_Width = width;
+                indexed.m_Height = height;
+            }
+            stbi_image_free(pixels);
+
+            fs::create_directories(cookedDir, ec);
+            removeCookedTextures(_texUUID, cookedName);
+            if (sourceHash)
+                writeIndexedTexture(cookedPath, indexed, palette);
+        }
+
+        if (sharedKey)
+        {
+            // Publish and point at the shared copy so this process does not keep its own
+            std::vector<uint8_t> bytes;
+            encodeIndexedTexture(indexed, palette, bytes);
+            if (const uint8_t* payload = _shared->publish(sharedKey, bytes.data(), bytes.size()))
+            {
+                decodeIndexedTexture(payload, bytes.size(), indexed, palette, true);
+                _cooked.m_SharedKey = sharedKey;
+            }
+        }
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Store a cooked indexed texture and add its palette to the bank.
+
+    @param _texUUID The UUID of the texture.
+    @param _filepath The file path of the source image.
+    @param _cooked The indexed texture and its palette.
+    *****************************************************************************/
+    void AssetManager::registerIndexedTexture(UUID _texUUID, const std::string& _filepath, CookedTexture& _cooked)
+    {
+        IndexedTexture& indexed = _cooked.m_Indexed;
+        if (_cooked.m_SharedKey)
+        {
+            releaseSharedTexture(_texUUID);
+            m_sharedLeases[_texUUID] = _cooked.m_SharedKey;
+        }
+        if (indexed.isIndexed())
+        {
+            indexed.m_PaletteID = m_paletteBank.addPalette(_cooked.m_Palette);
+            ANALYTICS_INFO(_filepath + " stored as " + std::to_string(indexed.m_BitsPerIndex) + " bit indices.");
+        }
+        m_indexedTextureMap[_texUUID] = std::move(indexed);
+    }
+
+    /*!**************************************************************************
+    @brief Drop the shared asset cache reference held for a texture, if any.
+
+    @param _texUUID The UUID of the texture.
+    *****************************************************************************/
+    void AssetManager::releaseSharedTexture(UUID _texUUID)
+    {
+        auto it = m_sharedLeases.find(_texUUID);
+        if (it == m_sharedLeases.end())
+            return;
+
+        m_sharedCache.release(it->second);
+        m_sharedLeases.erase(it);
+    }
+
+    /*!**************************************************************************
+    @brief Share decoded asset payloads with other engine processes.
+
+    Opt-in. The first process to call this creates the region, later ones attach
+    to it. Textures imported after this call are looked up in the region by
+    content hash before being decoded, and published there if they are not found.
+
+    @param _name The name of the region, the same in every process.
+    @param _capacity The number of payload bytes, only used by the creator.
+    @return True if the region is mapped.
+    *****************************************************************************/
+    bool AssetManager::enableSharedCache(const std::string& _name, size_t _capacity)
+    {
+        return m_sharedCache.open(_name, _capacity);
+    }
+
     /*!**************************************************************************
     @brief Load an audio asset.
 
@@ -331,10 +681,8 @@ namespace SOL
         }
         if (!found)
         {
-            AudioSystem& _audioSystem = Application::Get().GetAudioSystem();
-            _audioSystem.LoadAudio(_name, _filepath);
             UUID audioUUID = UUID::generateUUID();
-            m_audioMap[audioUUID] = _name;
+            loadAudioAsset(audioUUID, _name, _filepath);
 
             m_EditorMap[Asset_Type::ASSET_AUDIO][audioUUID].first = _name;
             m_EditorMap[Asset_Type::ASSET_AUDIO][audioUUID].second = _filepath;
@@ -354,6 +702,7 @@ namespace SOL
     *****************************************************************************/
     void AssetManager::unloadAudio(UUID _uuid)
     {
+        cancelLoad(_uuid);
         bool found{};
 
         for (auto it = m_EditorMap[Asset_Type::ASSET_AUDIO].begin(); it != m_EditorMap[Asset_Type::ASSET_AUDIO].end(); ++it)
@@ -394,15 +743,17 @@ namespace SOL
     @brief Get the UUID of an audio by name.
 
     This function searches for an audio by name and returns its UUID if found.
+    The editor map is searched, so audios not loaded yet by deferred loading
+    are found too.
 
     @param _name The name of the audio to search for.
     @return The UUID of the audio if found; otherwise, an empty UUID.
     *****************************************************************************/
     UUID AssetManager::getAudioUUID(std::string _name)
     {
-        for (auto it = m_audioMap.begin(); it != m_audioMap.end(); ++it)
+        for (auto it = m_EditorMap[Asset_Type::ASSET_AUDIO].begin(); it != m_EditorMap[Asset_Type::ASSET_AUDIO].end(); ++it)
         {
-            if ((*it).second == _name)
+            if ((*it).second.first == _name)
                 //ANALYTICS_ERROR((*it).first);
                 return (*it).first;
         }
@@ -435,8 +786,7 @@ namespace SOL
         if (!found)
         {
             UUID texUUID = UUID::generateUUID();
-            m_fontMap[texUUID].first.LoadFont(_filepath);
-            m_fontMap[texUUID].second = _name;
+            loadFontAsset(texUUID, _name, _filepath);
 
             m_EditorMap[Asset_Type::ASSET_FONT][texUUID].first = _name;
             m_EditorMap[Asset_Type::ASSET_FONT][texUUID].second = _filepath;
@@ -456,6 +806,7 @@ namespace SOL
     *****************************************************************************/
     void AssetManager::unloadFont(UUID _uuid)
     {
+        cancelLoad(_uuid);
         m_fontMap.erase(_uuid);
         m_EditorMap[Asset_Type::ASSET_FONT].erase(_uuid);
     }
@@ -475,7 +826,7 @@ namespace SOL
         //unload font wait for HAFIZ
         m_fontMap[_fontUUID].first.UnloadFont();
 
-        m_fontMap[_fontUUID].first.LoadFont(_filepath);
+        m_fontMap[_fontUUID].first.LoadFont(resolveAssetPath(_filepath));
         m_EditorMap[Asset_Type::ASSET_FONT][_fontUUID].second = _filepath;
         ANALYTICS_INFO(m_EditorMap[Asset_Type::ASSET_FONT][_fontUUID].first + "Textures successfully modified.");
     }
@@ -496,15 +847,17 @@ namespace SOL
     @brief Get the UUID of a font by name.
 
     This function searches for a font by name and returns its UUID if found.
+    The editor map is searched, so fonts not loaded yet by deferred loading
+    are found too.
 
     @param _name The name of the font to search for.
     @return The UUID of the font if found; otherwise, an empty UUID.
     *****************************************************************************/
     UUID AssetManager::getFontUUID(std::string _name)
     {
-        for (auto it = m_fontMap.begin(); it != m_fontMap.end(); ++it)
+        for (auto it = m_EditorMap[Asset_Type::ASSET_FONT].begin(); it != m_EditorMap[Asset_Type::ASSET_FONT].end(); ++it)
         {
-            if ((*it).second.second == _name)
+            if ((*it).second.first == _name)
                 //ANALYTICS_ERROR((*it).first);
                 return (*it).first;
         }
@@ -521,6 +874,7 @@ namespace SOL
     *****************************************************************************/
     FontPathPair& AssetManager::getFont(UUID _UUID)
     {
+        ensureLoaded(_UUID);
         m_FontPair = FontPathPair();
         if (m_fontMap.count(_UUID))
         {
@@ -530,6 +884,884 @@ namespace SOL
         }
         return m_FontPair;
     }
+    /*!**************************************************************************
+    @brief Load a texture under a known UUID.
+
+    @param _texUUID The UUID of the texture.
+    @param _name The name of the texture.
+    @param _filepath The file path of the texture as written in the manifest.
+    @param _cooked The indexed form if it was already cooked, nullptr to cook it here.
+    *****************************************************************************/
+    void AssetManager::loadTextureAsset(UUID _texUUID, const std::string& _name, const std::string& _filepath, CookedTexture* _cooked)
+    {
+        const std::string resolved = resolveAssetPath(_filepath);
+        m_textureMap[_texUUID].second = _name;
+        if (_cooked)
+            registerIndexedTexture(_texUUID, resolved, *_cooked);
+        else
+            importIndexedTexture(_texUUID, resolved);
+
+        // Indexed textures hold their pixels already, the RGBA copy waits until it is asked for
+        if (getIndexedTexture(_texUUID))
+            m_pendingUploads.insert(_texUUID);
+        else
+            m_textureMap[_texUUID].first.LoadTexture(resolved);
+
+        m_EditorMap[Asset_Type::ASSET_TEXTURES][_texUUID].first = _name;
+        m_EditorMap[Asset_Type::ASSET_TEXTURES][_texUUID].second = _filepath;
+    }
+
+    /*!**************************************************************************
+    @brief Upload the RGBA texture of an indexed texture if it is still pending.
+
+    @param _texUUID The UUID of the texture.
+    *****************************************************************************/
+    void AssetManager::uploadTexture(UUID _texUUID)
+    {
+        if (!m_pendingUploads.erase(_texUUID))
+            return;
+
+        m_textureMap[_texUUID].first.LoadTexture(resolveAssetPath(m_EditorMap[Asset_Type::ASSET_TEXTURES][_texUUID].second));
+    }
+
+    /*!**************************************************************************
+    @brief Load an audio under a known UUID.
+
+    @param _audioUUID The UUID of the audio.
+    @param _name The name of the audio.
+    @param _filepath The file path of the audio as written in the manifest.
+    *****************************************************************************/
+    void AssetManager::loadAudioAsset(UUID _audioUUID, const std::string& _name, const std::string& _filepath)
+    {
+        AudioSystem& _audioSystem = Application::Get().GetAudioSystem();
+        _audioSystem.LoadAudio(_name, resolveAssetPath(_filepath));
+        m_audioMap[_audioUUID] = _name;
+
+        m_EditorMap[Asset_Type::ASSET_AUDIO][_audioUUID].first = _name;
+        m_EditorMap[Asset_Type::ASSET_AUDIO][_audioUUID].second = _filepath;
+    }
+
+    /*!**************************************************************************
+    @brief Load a font under a known UUID.
+
+    @param _fontUUID The UUID of the font.
+    @param _name The name of the font.
+    @param _filepath The file path of the font as written in the manifest.
+    *****************************************************************************/
+    void AssetManager::loadFontAsset(UUID _fontUUID, const std::string& _name, const std::string& _filepath)
+    {
+        m_fontMap[_fontUUID].first.LoadFont(resolveAssetPath(_filepath));
+        m_fontMap[_fontUUID].second = _name;
+
+        m_EditorMap[Asset_Type::ASSET_FONT][_fontUUID].first = _name;
+        m_EditorMap[Asset_Type::ASSET_FONT][_fontUUID].second = _filepath;
+    }
+
+    /*!**************************************************************************
+    @brief Import every asset in a folder and its subfolders.
+
+    Files are classified and checked against the editor map in one pass, the
+    CPU side of each import runs on the worker pool, and the manifest is written
+    once at the end. Files whose contents match another file in the same import
+    are skipped. Progress is reported on the calling thread.
+
+    @param _directory The folder to import.
+    @param _onProgress Called as files are decoded and registered, may be empty.
+    @return The number of assets imported.
+    *****************************************************************************/
+    size_t AssetManager::importFolder(const std::string& _directory, const std::function<void(const ImportProgress&)>& _onProgress)
+    {
+        namespace fs = std::filesystem;
+
+        struct ImportJob
+        {
+            Asset_Type m_Type;
+            UUID m_UUID;
+            std::string m_Name;
+            std::string m_Filepath;   //as written in the manifest
+            std::string m_LoadPath;   //resolved through the VirtualFileSystem
+            ContentHash m_Hash{};
+            bool m_Cooked{};
+            CookedTexture m_Texture;
+        };
+
+        ImportProgress progress;
+        auto report = [&progress, &_onProgress]()
+            {
+                if (_onProgress)
+                    _onProgress(progress);
+            };
+
+        // Paths already registered, so each file is checked with one lookup
+        std::unordered_set<std::string> known;
+        for (const auto& [type, assets] : m_EditorMap)
+        {
+            for (const auto& [uuid, assetPair] : assets)
+            {
+                known.insert(normalizeAssetPath(assetPair.second));
+            }
+        }
+
+        std::vector<ImportJob> jobs;
+        std::error_code ec;
+        for (auto it = fs::recursive_directory_iterator(_directory, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+        {
+            const std::string fileName = it->path().filename().string();
+            if (it->is_directory(ec))
+            {
+                if (!fileName.empty() && fileName[0] == '.')
+                    it.disable_recursion_pending();
+                continue;
+            }
+
+            Asset_Type type = determineFileType(fileName);
+            if (type == Asset_Type::UNKNOWN_ASSET_TYPE)
+                continue;
+
+            // Keep manifest paths relative to the working directory like the rest of the editor map
+            fs::path relative = fs::relative(it->path(), fs::current_path(), ec);
+            std::string filepath = (!ec && !relative.empty() && *relative.begin() != "..")
+                ? "./" + relative.generic_string() : it->path().generic_string();
+
+            ++progress.m_Total;
+            if (!known.insert(normalizeAssetPath(filepath)).second)
+            {
+                ++progress.m_Skipped;
+                continue;
+            }
+
+            ImportJob job;
+            job.m_Type = type;
+            job.m_UUID = UUID::generateUUID();
+            job.m_Name = it->path().stem().string();
+            job.m_Filepath = filepath;
+            job.m_LoadPath = resolveAssetPath(filepath);
+            jobs.push_back(std::move(job));
+        }
+        std::sort(jobs.begin(), jobs.end(), [](const ImportJob& _lhs, const ImportJob& _rhs) { return _lhs.m_Filepath < _rhs.m_Filepath; });
+        report();
+
+        // Hash and cook on the worker pool, GPU and FMOD loads stay on this thread
+        std::mutex mutex;
+        std::condition_variable finished;
+        size_t decoded{};
+        SharedAssetCache* shared = m_sharedCache.isOpen() ? &m_sharedCache : nullptr;
+        for (ImportJob& job : jobs)
+        {
+            m_workerPool.submit([&job, &mutex, &finished, &decoded, shared]()
+                {
+                    job.m_Hash = hashFile(job.m_LoadPath);
+                    if (job.m_Hash && job.m_Type == Asset_Type::ASSET_TEXTURES)
+                    {
+                        job.m_Cooked = cookIndexedTexture(job.m_UUID, job.m_LoadPath, job.m_Texture, shared);
+                    }
+
+                    // Notify under the lock so the waiting thread cannot return while this job still touches its locals
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++decoded;
+                    finished.notify_all();
+                });
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (decoded < jobs.size())
+            {
+                finished.wait(lock);
+                progress.m_Decoded = decoded;
+                lock.unlock();
+                report();
+                lock.lock();
+            }
+        }
+
+        std::unordered_set<ContentHash> imported;
+        for (ImportJob& job : jobs)
+        {
+            if (!job.m_Hash)
+            {
+                ++progress.m_Failed;
+                ANALYTICS_ERROR("Failed to read " + job.m_Filepath);
+            }
+            else if (!imported.insert(job.m_Hash).second)
+            {
+                // The duplicate is not registered, so its lease and cooked file are never used
+                if (job.m_Texture.m_SharedKey && shared)
+                    shared->release(job.m_Texture.m_SharedKey);
+                if (job.m_Type == Asset_Type::ASSET_TEXTURES)
+                    removeCookedTextures(job.m_UUID);
+                ++progress.m_Skipped;
+            }
+            else
+            {
+                switch (job.m_Type)
+                {
+                case Asset_Type::ASSET_TEXTURES:
+                    loadTextureAsset(job.m_UUID, job.m_Name, job.m_Filepath, job.m_Cooked ? &job.m_Texture : nullptr);
+                    break;
+                case Asset_Type::ASSET_AUDIO:
+                    loadAudioAsset(job.m_UUID, job.m_Name, job.m_Filepath);
+                    break;
+                default:
+                    loadFontAsset(job.m_UUID, job.m_Name, job.m_Filepath);
+                    break;
+                }
+                ++progress.m_Registered;
+            }
+            report();
+        }
+
+        if (progress.m_Registered)
+        {
+            SerializeEditorMap(m_EditorMap);
+        }
+        ANALYTICS_INFO(std::to_string(progress.m_Registered) + " assets imported from " + _directory + ", " +
+                       std::to_string(progress.m_Skipped) + " skipped, " + std::to_string(progress.m_Failed) + " failed.");
+        return progress.m_Registered;
+    }
+
+    /*!**************************************************************************
+    @brief Queue an asset to be loaded by updateLoadQueue.
+
+    Requests are served by priority, then deadline, then request order. Asking
+    again for a queued asset only ever raises its priority or brings its
+    deadline forward.
+
+    @param _UUID The UUID of an asset in the editor map.
+    @param _priority How soon the asset is needed.
+    @param _deadline Time from now by which the asset should be loaded, zero for
+                     no deadline. Overdue requests are loaded regardless of budget.
+    *****************************************************************************/
+    void AssetManager::requestLoad(UUID _UUID, Load_Priority _priority, std::chrono::milliseconds _deadline)
+    {
+        Asset_Type type = getAssetType(_UUID);
+        if (type == Asset_Type::UNKNOWN_ASSET_TYPE || isAssetLoaded(_UUID))
+            return;
+
+        LoadRequest request{ _UUID, type, _priority, LoadClock::time_point::max(), m_loadSequence++ };
+        if (_deadline.count() > 0)
+            request.m_Deadline = LoadClock::now() + _deadline;
+
+        auto queued = m_queuedLoads.find(_UUID);
+        if (queued != m_queuedLoads.end())
+        {
+            const LoadRequest& current = *queued->second;
+            request.m_Priority = std::min(current.m_Priority, request.m_Priority);
+            request.m_Deadline = std::min(current.m_Deadline, request.m_Deadline);
+            request.m_Sequence = current.m_Sequence;
+            m_loadQueue.erase(queued->second);
+        }
+        m_queuedLoads[_UUID] = m_loadQueue.insert(request).first;
+    }
+
+    /*!**************************************************************************
+    @brief Move a queued asset to the front because something is waiting on it.
+
+    @param _UUID The UUID of the asset.
+    *****************************************************************************/
+    void AssetManager::boostLoad(UUID _UUID)
+    {
+        requestLoad(_UUID, Load_Priority::CRITICAL, std::chrono::milliseconds(1));
+    }
+
+    /*!**************************************************************************
+    @brief Load a queued asset now instead of waiting for its turn.
+
+    @param _UUID The UUID of the asset.
+    @return True if the asset is loaded.
+    *****************************************************************************/
+    bool AssetManager::ensureLoaded(UUID _UUID)
+    {
+        auto queued = m_queuedLoads.find(_UUID);
+        if (queued != m_queuedLoads.end())
+        {
+            LoadRequest request = *queued->second;
+            m_loadQueue.erase(queued->second);
+            m_queuedLoads.erase(queued);
+            loadRequested(request);
+        }
+        return isAssetLoaded(_UUID);
+    }
+
+    /*!**************************************************************************
+    @brief Load queued assets in priority order within a time budget.
+
+    Call once per frame. Critical and overdue requests are always loaded, wherever
+    they sit in the queue, the rest stop once the budget is spent.
+
+    @param _budgetMs The time this call may spend loading, in milliseconds.
+    @return The number of assets loaded.
+    *****************************************************************************/
+    size_t AssetManager::updateLoadQueue(double _budgetMs)
+    {
+        const LoadClock::time_point start = LoadClock::now();
+        size_t loaded{};
+
+        // Once the budget is spent the rest of the queue is still scanned, an overdue
+        // request may sit behind requests of higher priority that have no deadline
+        auto it = m_loadQueue.begin();
+        while (it != m_loadQueue.end())
+        {
+            const LoadRequest request = *it;
+            const LoadClock::time_point now = LoadClock::now();
+            const double elapsedMs = std::chrono::duration<double, std::milli>(now - start).count();
+            const bool mustLoad = request.m_Priority == Load_Priority::CRITICAL || request.m_Deadline <= now;
+            if (!mustLoad && elapsedMs >= _budgetMs)
+            {
+                ++it;
+                continue;
+            }
+
+            it = m_loadQueue.erase(it);
+            m_queuedLoads.erase(request.m_UUID);
+            loadRequested(request);
+            ++loaded;
+        }
+        return loaded;
+    }
+
+    /*!**************************************************************************
+    @brief Set the priority an asset is loaded with and saved under.
+
+    @param _UUID The UUID of the asset.
+    @param _priority The priority.
+    *****************************************************************************/
+    void AssetManager::setAssetPriority(UUID _UUID, Load_Priority _priority)
+    {
+        if (_priority == Load_Priority::SCENE)
+            m_assetPriority.erase(_UUID);
+        else
+            m_assetPriority[_UUID] = _priority;
+    }
+
+    /*!**************************************************************************
+    @brief Get the priority an asset is loaded with.
+
+    @param _UUID The UUID of the asset.
+    @return The priority, SCENE unless set otherwise.
+    *****************************************************************************/
+    AssetManager::Load_Priority AssetManager::getAssetPriority(UUID _UUID) const
+    {
+        auto it = m_assetPriority.find(_UUID);
+        return it != m_assetPriority.end() ? it->second : Load_Priority::SCENE;
+    }
+
+    /*!**************************************************************************
+    @brief Order load requests by priority, then deadline, then request order.
+    *****************************************************************************/
+    bool AssetManager::LoadRequest::operator<(const LoadRequest& _rhs) const
+    {
+        if (m_Priority != _rhs.m_Priority)
+            return m_Priority < _rhs.m_Priority;
+        if (m_Deadline != _rhs.m_Deadline)
+            return m_Deadline < _rhs.m_Deadline;
+        return m_Sequence < _rhs.m_Sequence;
+    }
+
+    /*!**************************************************************************
+    @brief Load the asset of a request taken off the queue.
+
+    @param _request The request.
+    *****************************************************************************/
+    void AssetManager::loadRequested(const LoadRequest& _request)
+    {
+        auto& assets = m_EditorMap[_request.m_Type];
+        auto it = assets.find(_request.m_UUID);
+        if (it == assets.end() || isAssetLoaded(_request.m_UUID))
+            return;
+
+        const std::pair<std::string, std::string> assetPair = it->second;
+        switch (_request.m_Type)
+        {
+        case Asset_Type::ASSET_TEXTURES: loadTextureAsset(_request.m_UUID, assetPair.first, assetPair.second); break;
+        case Asset_Type::ASSET_AUDIO:    loadAudioAsset(_request.m_UUID, assetPair.first, assetPair.second); break;
+        case Asset_Type::ASSET_FONT:     loadFontAsset(_request.m_UUID, assetPair.first, assetPair.second); break;
+        default: break;
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Remove an asset from the load queue.
+
+    @param _UUID The UUID of the asset.
+    *****************************************************************************/
+    void AssetManager::cancelLoad(UUID _UUID)
+    {
+        auto queued = m_queuedLoads.find(_UUID);
+        if (queued == m_queuedLoads.end())
+            return;
+
+        m_loadQueue.erase(queued->second);
+        m_queuedLoads.erase(queued);
+    }
+
+    /*!**************************************************************************
+    @brief Check if an asset has been loaded.
+
+    @param _UUID The UUID of the asset.
+    @return True if the texture, audio or font is loaded.
+    *****************************************************************************/
+    bool AssetManager::isAssetLoaded(UUID _UUID) const
+    {
+        return m_textureMap.count(_UUID) || m_audioMap.count(_UUID) || m_fontMap.count(_UUID);
+    }
+
+    /*!**************************************************************************
+    @brief Find the type of an asset in the editor map.
+
+    @param _UUID The UUID of the asset.
+    @return The asset type, UNKNOWN_ASSET_TYPE if it is not registered.
+    *****************************************************************************/
+    AssetManager::Asset_Type AssetManager::getAssetType(UUID _UUID) const
+    {
+        for (const auto& [type, assets] : m_EditorMap)
+        {
+            if (assets.count(_UUID))
+                return type;
+        }
+        return Asset_Type::UNKNOWN_ASSET_TYPE;
+    }
+
+    /*!**************************************************************************
+    @brief Get the assets of a type sorted by priority, then name.
+
+    Gives the manifest and the load queue a stable order instead of the order
+    of the unordered editor map.
+
+    @param _type The asset type.
+    @param _editorMap The editor map to read.
+    @return The sorted UUIDs.
+    *****************************************************************************/
+    std::vector<UUID> AssetManager::getSortedAssets(Asset_Type _type, const EditorMap& _editorMap) const
+    {
+        std::vector<UUID> sorted;
+        auto section = _editorMap.find(_type);
+        if (section == _editorMap.end())
+            return sorted;
+
+        const auto& assets = section->second;
+        for (const auto& [uuid, assetPair] : assets)
+        {
+            sorted.push_back(uuid);
+        }
+        std::sort(sorted.begin(), sorted.end(), [this, &assets](UUID _lhs, UUID _rhs)
+            {
+                Load_Priority lhsPriority = getAssetPriority(_lhs);
+                Load_Priority rhsPriority = getAssetPriority(_rhs);
+                if (lhsPriority != rhsPriority)
+                    return lhsPriority < rhsPriority;
+                const std::string& lhsName = assets.at(_lhs).first;
+                const std::string& rhsName = assets.at(_rhs).first;
+                if (lhsName != rhsName)
+                    return lhsName < rhsName;
+                return static_cast<uint64_t>(_lhs) < static_cast<uint64_t>(_rhs);
+            });
+        return sorted;
+    }
+
+    /*!**************************************************************************
+    @brief Get the assets of a type sorted by priority, then name.
+
+    @param _type The asset type.
+    @return The sorted UUIDs.
+    *****************************************************************************/
+    std::vector<UUID> AssetManager::getSortedAssets(Asset_Type _type) const
+    {
+        return getSortedAssets(_type, m_EditorMap);
+    }
+
+    /*!**************************************************************************
+    @brief Convert a load priority to the name used in the manifest.
+
+    @param _priority The priority.
+    @return "critical", "scene" or "background".
+    *****************************************************************************/
+    const char* AssetManager::priorityToString(Load_Priority _priority)
+    {
+        switch (_priority)
+        {
+        case Load_Priority::CRITICAL:   return "critical";
+        case Load_Priority::BACKGROUND: return "background";
+        default:                        return "scene";
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Convert a manifest priority name to a load priority.
+
+    @param _name The name.
+    @return The priority, SCENE for unknown names.
+    *****************************************************************************/
+    AssetManager::Load_Priority AssetManager::priorityFromString(const std::string& _name)
+    {
+        if (_name == "critical")
+            return Load_Priority::CRITICAL;
+        if (_name == "background")
+            return Load_Priority::BACKGROUND;
+        return Load_Priority::SCENE;
+    }
+
+    /*!**************************************************************************
+    @brief Get the manifest section name of an asset type.
+
+    @param _type The asset type.
+    @return "textures", "audios" or "fonts", nullptr for other types.
+    *****************************************************************************/
+    const char* AssetManager::getManifestSection(Asset_Type _type)
+    {
+        switch (_type)
+        {
+        case Asset_Type::ASSET_TEXTURES: return "textures";
+        case Asset_Type::ASSET_AUDIO:    return "audios";
+        case Asset_Type::ASSET_FONT:     return "fonts";
+        default:                         return nullptr;
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Read one section of an asset manifest into the editor map.
+
+    Nothing is loaded, the entries are only registered. Entries without a
+    numeric UUID or a string file path are skipped.
+
+    @param _doc The parsed manifest.
+    @param _type The asset type of the section to read.
+    @return The UUIDs of the entries read.
+    *****************************************************************************/
+    std::vector<UUID> AssetManager::readManifestSection(const rapidjson::Value& _doc, Asset_Type _type)
+    {
+        std::vector<UUID> uuids;
+        const char* section = getManifestSection(_type);
+        if (!section || !_doc.IsObject() || !_doc.HasMember(section))
+            return uuids;
+
+        const rapidjson::Value& assets = _doc[section];
+        if (!assets.IsObject())
+        {
+            ANALYTICS_ERROR(std::string("Manifest section ") + section + " is not an object.");
+            return uuids;
+        }
+
+        for (auto it = assets.MemberBegin(); it != assets.MemberEnd(); ++it)
+        {
+            if (!it->value.IsObject() || !it->value.HasMember("UUID") || !it->value["UUID"].IsUint64() ||
+                !it->value.HasMember("filepath") || !it->value["filepath"].IsString())
+            {
+                ANALYTICS_ERROR(std::string("Manifest entry ") + it->name.GetString() + " is malformed, skipped.");
+                continue;
+            }
+
+            UUID assetUUID(it->value["UUID"].GetUint64()); // Use provided UUID from json
+            m_EditorMap[_type][assetUUID].first = it->name.GetString();
+            m_EditorMap[_type][assetUUID].second = it->value["filepath"].GetString();
+            if (it->value.HasMember("priority") && it->value["priority"].IsString())
+            {
+                setAssetPriority(assetUUID, priorityFromString(it->value["priority"].GetString()));
+            }
+            uuids.push_back(assetUUID);
+        }
+        return uuids;
+    }
+
+    /*!**************************************************************************
+    @brief Apply a manifest delta from a patch pack to the editor map.
+
+    The delta has the same sections as assets_serialized.json, plus a "removed"
+    array of UUIDs. If the AssetManager is already initialized, changed assets
+    are reloaded and removed assets are unloaded.
+
+    @param _delta The manifest delta as JSON.
+    *****************************************************************************/
+    void AssetManager::applyManifestDelta(const std::string& _delta)
+    {
+        rapidjson::Document doc;
+        if (doc.Parse(_delta.c_str()).HasParseError() || !doc.IsObject())
+        {
+            ANALYTICS_ERROR("Failed to parse patch manifest delta.");
+            return;
+        }
+
+        if (doc.HasMember("removed") && doc["removed"].IsArray())
+        {
+            for (const auto& removed : doc["removed"].GetArray())
+            {
+                if (!removed.IsUint64())
+                    continue;
+
+                UUID assetUUID(removed.GetUint64());
+                if (m_initialized)
+                {
+                    if (m_textureMap.count(assetUUID)) unloadTexture(assetUUID);
+                    if (m_audioMap.count(assetUUID)) unloadAudio(assetUUID);
+                    if (m_fontMap.count(assetUUID)) unloadFont(assetUUID);
+                }
+                for (auto& [type, assets] : m_EditorMap)
+                {
+                    assets.erase(assetUUID);
+                }
+            }
+        }
+
+        for (Asset_Type type : { Asset_Type::ASSET_TEXTURES, Asset_Type::ASSET_AUDIO, Asset_Type::ASSET_FONT })
+        {
+            std::vector<UUID> changed = readManifestSection(doc, type);
+            if (!m_initialized)
+                continue;
+
+            for (UUID assetUUID : changed)
+            {
+                const auto assetPair = m_EditorMap[type][assetUUID];
+                if (type == Asset_Type::ASSET_TEXTURES)
+                {
+                    if (m_textureMap.count(assetUUID) && !m_pendingUploads.erase(assetUUID)) m_textureMap[assetUUID].first.UnloadTexture();
+                    loadTextureAsset(assetUUID, assetPair.first, assetPair.second);
+                    m_thumbnailCache.invalidate(assetUUID);
+                }
+                else if (type == Asset_Type::ASSET_AUDIO)
+                {
+                    if (m_audioMap.count(assetUUID)) Application::Get().GetAudioSystem().UnLoadAudio(m_audioMap[assetUUID]);
+                    loadAudioAsset(assetUUID, assetPair.first, assetPair.second);
+                }
+                else
+                {
+                    if (m_fontMap.count(assetUUID)) m_fontMap[assetUUID].first.UnloadFont();
+                    loadFontAsset(assetUUID, assetPair.first, assetPair.second);
+                }
+            }
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Resolve a manifest file path to the file that should be loaded.
+
+    Goes through the VirtualFileSystem, so files provided by a pack or patch
+    resolve to the copy extracted from it.
+
+    @param _filepath The file path as written in the manifest.
+    @return The file path to load from.
+    *****************************************************************************/
+    std::string AssetManager::resolveAssetPath(const std::string& _filepath) const
+    {
+        return VirtualFileSystem::Get().getLoadPath(_filepath);
+    }
+
+    /*!**************************************************************************
+    @brief Write the hash manifest used as the base for patch packs.
+
+    Records the UUID, type, name, file path and content hash of every registered
+    asset, together with a manifest version number.
+
+    @param _manifestPath The manifest file to write.
+    @param _version The version number of this manifest.
+    @return True if the manifest was written.
+    *****************************************************************************/
+    bool AssetManager::writeAssetManifest(const std::string& _manifestPath, uint32_t _version)
+    {
+        rapidjson::StringBuffer buffer;
+        rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+
+        writer.StartObject();
+        writer.String("version");
+        writer.Uint(_version);
+        writer.String("assets");
+        writer.StartArray();
+        for (Asset_Type type : { Asset_Type::ASSET_TEXTURES, Asset_Type::ASSET_AUDIO, Asset_Type::ASSET_FONT })
+        {
+            for (const auto& [uuid, assetPair] : m_EditorMap[type])
+            {
+                writer.StartObject();
+                writer.String("UUID");
+                writer.Uint64(uuid);
+                writer.String("type");
+                writer.String(getManifestSection(type));
+                writer.String("name");
+                writer.String(assetPair.first.c_str());
+                writer.String("filepath");
+                writer.String(assetPair.second.c_str());
+                writer.String("hash");
+                writer.String(hashToString(hashFile(resolveAssetPath(assetPair.second))).c_str());
+                writer.EndObject();
+            }
+        }
+        writer.EndArray();
+        writer.EndObject();
+
+        std::ofstream file(VirtualFileSystem::Get().getWritePath(_manifestPath));
+        if (!file.is_open())
+        {
+            ANALYTICS_ERROR("Failed to open " + _manifestPath + " for writing.");
+            return false;
+        }
+        file << buffer.GetString();
+        m_manifestVersion = _version;
+        ANALYTICS_INFO("Asset manifest version " + std::to_string(_version) + " written.");
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Build a patch pack against a base hash manifest.
+
+    Only assets whose content hash, name or file path changed since the base
+    manifest are written, together with a manifest delta that also lists the
+    assets removed since then.
+
+    @param _baseManifestPath The hash manifest of the version players have.
+    @param _packPath The patch pack to write.
+    @param _targetVersion The manifest version after the patch is applied.
+    @return True if the patch pack was written.
+    *****************************************************************************/
+    bool AssetManager::buildPatchPack(const std::string& _baseManifestPath, const std::string& _packPath, uint32_t _targetVersion)
+    {
+        struct BaseAsset
+        {
+            std::string m_Name;
+            std::string m_Filepath;
+            std::string m_Hash;
+        };
+
+        MappedJson baseManifest;
+        const bool opened = baseManifest.Open(_baseManifestPath);
+        const JsonParseContext::Document& base = baseManifest.GetDocument();
+        if (!opened || base.HasParseError() || !base.IsObject() ||
+            !base.HasMember("assets") || !base["assets"].IsArray())
+        {
+            ANALYTICS_ERROR("Failed to parse base manifest " + _baseManifestPath);
+            return false;
+        }
+
+        // Version 0 means unversioned to mountPatch, a patch built on it could never be verified
+        if (!base.HasMember("version") || !base["version"].IsUint() || base["version"].GetUint() == 0)
+        {
+            ANALYTICS_ERROR("Base manifest " + _baseManifestPath + " has no version.");
+            return false;
+        }
+
+        std::unordered_map<UUID, BaseAsset> baseAssets;
+        for (const auto& asset : base["assets"].GetArray())
+        {
+            if (!asset.IsObject() || !asset.HasMember("UUID") || !asset["UUID"].IsUint64() ||
+                !asset.HasMember("name") || !asset["name"].IsString() ||
+                !asset.HasMember("filepath") || !asset["filepath"].IsString() ||
+                !asset.HasMember("hash") || !asset["hash"].IsString())
+            {
+                ANALYTICS_ERROR("Base manifest " + _baseManifestPath + " has a malformed asset entry.");
+                return false;
+            }
+            baseAssets[UUID(asset["UUID"].GetUint64())] =
+                BaseAsset{ asset["name"].GetString(), asset["filepath"].GetString(), asset["hash"].GetString() };
+        }
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        std::vector<AssetPack::Source> sources;
+        std::unordered_map<std::string, bool> packedPaths;
+
+        writer.StartObject();
+        for (Asset_Type type : { Asset_Type::ASSET_TEXTURES, Asset_Type::ASSET_AUDIO, Asset_Type::ASSET_FONT })
+        {
+            writer.String(getManifestSection(type));
+            writer.StartObject();
+            for (const auto& [uuid, assetPair] : m_EditorMap[type])
+            {
+                const std::string filepath = resolveAssetPath(assetPair.second);
+                const std::string hash = hashToString(hashFile(filepath));
+
+                auto it = baseAssets.find(uuid);
+                bool contentChanged = it == baseAssets.end() || it->second.m_Hash != hash;
+                if (!contentChanged && it->second.m_Name == assetPair.first && it->second.m_Filepath == assetPair.second)
+                    continue;
+
+                writer.String(assetPair.first.c_str());
+                writer.StartObject();
+                writer.String("UUID");
+                writer.Uint64(uuid);
+                writer.String("filepath");
+                writer.String(assetPair.second.c_str());
+                writer.EndObject();
+
+                if (contentChanged && !packedPaths[normalizeAssetPath(assetPair.second)])
+                {
+                    packedPaths[normalizeAssetPath(assetPair.second)] = true;
+                    sources.push_back(AssetPack::Source{ assetPair.second, filepath });
+                }
+            }
+            writer.EndObject();
+        }
+
+        writer.String("removed");
+        writer.StartArray();
+        for (const auto& [uuid, baseAsset] : baseAssets)
+        {
+            bool exists = false;
+            for (auto& [type, assets] : m_EditorMap)
+            {
+                exists = exists || assets.count(uuid);
+            }
+            if (!exists)
+                writer.Uint64(uuid);
+        }
+        writer.EndArray();
+        writer.EndObject();
+
+        if (!AssetPack::write(_packPath, base["version"].GetUint(), _targetVersion, sources, buffer.GetString()))
+            return false;
+
+        ANALYTICS_INFO("Patch pack written with " + std::to_string(sources.size()) + " changed assets.");
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Mount a patch pack over the base assets.
+
+    The pack is mounted in the VirtualFileSystem above the loose files, so the
+    cost is proportional to the number of changed assets. Patches
+    mounted before initAssetManager are applied as the manifest is read,
+    patches mounted later reload the assets they change.
+
+    The patch is refused unless its base version matches the current manifest
+    version, read from the hash manifest if no version is known yet. A patch is
+    never mounted over a base whose version cannot be verified.
+
+    @param _packPath The patch pack to mount.
+    @return True if the patch was mounted.
+    *****************************************************************************/
+    bool AssetManager::mountPatch(const std::string& _packPath)
+    {
+        AssetPack patch;
+        if (!patch.open(_packPath))
+            return false;
+
+        if (m_manifestVersion == 0)
+        {
+            m_manifestVersion = readManifestVersion(m_hashManifestFilepath);
+        }
+
+        if (m_manifestVersion == 0)
+        {
+            ANALYTICS_ERROR(_packPath + " not mounted, the base manifest version cannot be verified.");
+            return false;
+        }
+
+        if (patch.getBaseVersion() != m_manifestVersion)
+        {
+            ANALYTICS_ERROR(_packPath + " does not apply to manifest version " + std::to_string(m_manifestVersion));
+            return false;
+        }
+
+        if (!VirtualFileSystem::Get().mountPack(_packPath, VirtualFileSystem::s_PatchPriority))
+            return false;
+
+        m_manifestVersion = patch.getTargetVersion();
+        if (m_initialized)
+        {
+            applyManifestDelta(patch.getManifestDelta());
+        }
+        m_patches.push_back(std::move(patch));
+
+        ANALYTICS_INFO(_packPath + " mounted, manifest now at version " + std::to_string(m_manifestVersion));
+        return true;
+    }
+
      /*!**************************************************************************
     @brief Log information about loaded objects.
 
@@ -581,11 +1813,14 @@ namespace SOL
         // Serialize textures
         if (_editormap.count(Asset_Type::ASSET_TEXTURES)) 
         {
-            for (const auto& [uuid, assetPair] : _editormap.at(Asset_Type::ASSET_TEXTURES)) 
+            for (UUID uuid : getSortedAssets(Asset_Type::ASSET_TEXTURES, _editormap)) 
             {
+                const auto& assetPair = _editormap.at(Asset_Type::ASSET_TEXTURES).at(uuid);
                 rapidjson::Value textureObj(rapidjson::kObjectType);
                 textureObj.AddMember("UUID", rapidjson::Value(static_cast<uint64_t>(uuid)), allocator);
                 textureObj.AddMember("filepath", rapidjson::Value(assetPair.second.c_str(), allocator), allocator);
+                if (getAssetPriority(uuid) != Load_Priority::SCENE)
+                    textureObj.AddMember("priority", rapidjson::StringRef(priorityToString(getAssetPriority(uuid))), allocator);
                 textures.AddMember(rapidjson::Value(assetPair.first.c_str(), allocator), textureObj, allocator);
             }
             doc.AddMember("textures", textures, allocator);
@@ -595,11 +1830,14 @@ namespace SOL
         // Serialize audios
         if (_editormap.count(Asset_Type::ASSET_AUDIO)) 
         {
-            for (const auto& [uuid, assetPair] : _editormap.at(Asset_Type::ASSET_AUDIO)) 
+            for (UUID uuid : getSortedAssets(Asset_Type::ASSET_AUDIO, _editormap)) 
             {
+                const auto& assetPair = _editormap.at(Asset_Type::ASSET_AUDIO).at(uuid);
                 rapidjson::Value audioObj(rapidjson::kObjectType);
                 audioObj.AddMember("UUID", rapidjson::Value(static_cast<uint64_t>(uuid)), allocator);
                 audioObj.AddMember("filepath", rapidjson::Value(assetPair.second.c_str(), allocator), allocator);
+                if (getAssetPriority(uuid) != Load_Priority::SCENE)
+                    audioObj.AddMember("priority", rapidjson::StringRef(priorityToString(getAssetPriority(uuid))), allocator);
                 audios.AddMember(rapidjson::Value(assetPair.first.c_str(), allocator), audioObj, allocator);
             }
             doc.AddMember("audios", audios, allocator);
@@ -608,11 +1846,14 @@ namespace SOL
         // Serialize fonts
         if (_editormap.count(Asset_Type::ASSET_FONT)) 
         {
-            for (const auto& [uuid, assetPair] : _editormap.at(Asset_Type::ASSET_FONT)) 
+            for (UUID uuid : getSortedAssets(Asset_Type::ASSET_FONT, _editormap)) 
             {
+                const auto& assetPair = _editormap.at(Asset_Type::ASSET_FONT).at(uuid);
                 rapidjson::Value fontObj(rapidjson::kObjectType);
                 fontObj.AddMember("UUID", rapidjson::Value(static_cast<uint64_t>(uuid)), allocator);
                 fontObj.AddMember("filepath", rapidjson::Value(assetPair.second.c_str(), allocator), allocator);
+                if (getAssetPriority(uuid) != Load_Priority::SCENE)
+                    fontObj.AddMember("priority", rapidjson::StringRef(priorityToString(getAssetPriority(uuid))), allocator);
                 fonts.AddMember(rapidjson::Value(assetPair.first.c_str(), allocator), fontObj, allocator);
             }
             doc.AddMember("fonts", fonts, allocator);
@@ -624,7 +1865,7 @@ namespace SOL
         doc.Accept(writer);
 
         // Write the string to a file.
-        std::ofstream file("./Json/assets_serialized.json");
+        std::ofstream file(VirtualFileSystem::Get().getWritePath(m_assetFilepath));
         if (file.is_open()) 
         {
             file << buffer.GetString();
@@ -17,6 +17,10 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <iostream>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <set>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <filesystem>
 #include <cstdlib>
@@ -26,6 +30,11 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <SOL/Graphics/Font.h>
 #include <AudioSystem/AudioSystem.h>
 #include <SOL/AssetManager/AssetManager.h>
+#include <SOL/AssetManager/IndexedTexture.h>
+#include <SOL/AssetManager/WorkerPool.h>
+#include <SOL/AssetManager/ThumbnailCache.h>
+#include <SOL/AssetManager/AssetPack.h>
+#include <SOL/AssetManager/SharedAssetCache.h>
 
 namespace SOL
 {
@@ -128,6 +137,24 @@ namespace SOL
             UNKNOWN_ASSET_TYPE
         };
 
+        enum class Load_Priority
+        {
+            CRITICAL,     //needed by the first visible frame, never deferred
+            SCENE,        //needed by the scene being loaded
+            BACKGROUND    //loaded when there is time left over
+        };
+
+        using EditorMap = std::unordered_map<Asset_Type, std::unordered_map<UUID, std::pair<std::string, std::string>>>;
+
+        struct ImportProgress
+        {
+            size_t m_Total{};        //supported files found
+            size_t m_Decoded{};      //files hashed and cooked on the worker pool
+            size_t m_Registered{};   //assets added to the editor map
+            size_t m_Skipped{};      //already registered or duplicate contents
+            size_t m_Failed{};       //files that could not be read
+        };
+
         AudioImplementation m_audioObj;
 
         /*!**************************************************************************
@@ -162,9 +189,11 @@ namespace SOL
         @return An instance of the AssetManager class.
         *****************************************************************************/
         AssetManager() 
+            : m_thumbnailCache(m_workerPool)
         {
             //m_assetFilepath = "./Json/asset.json";
             m_assetFilepath = "./Json/assets_serialized.json";
+            m_hashManifestFilepath = "./Json/assets_manifest.json";
         }
 
         /*!**************************************************************************
@@ -214,7 +243,8 @@ namespace SOL
         /*!**************************************************************************
         @brief Get the texture map.
 
-        This function returns a map of texture UUIDs to texture path pairs.
+        This function returns a map of texture UUIDs to texture path pairs. Any
+        indexed texture whose RGBA upload is still pending is uploaded first.
 
         @return A map containing texture UUIDs as keys and texture path pairs as values.
         *****************************************************************************/
@@ -239,6 +269,226 @@ namespace SOL
         @return A reference to the texture asset if found; otherwise, a default texture path pair.
         *****************************************************************************/
         TexPathPair& getTexture(UUID _UUID);
+
+        /*!**************************************************************************
+        @brief Get the palette-indexed form of a texture.
+
+        Textures with 256 colours or less are stored as 4 or 8 bit indices into a
+        shared palette when they are imported.
+
+        @param _UUID The UUID of the texture.
+        @return A pointer to the indexed texture, nullptr if the texture has too many
+                colours or is not loaded.
+        *****************************************************************************/
+        IndexedTexture* getIndexedTexture(UUID _UUID);
+
+        /*!**************************************************************************
+        @brief Expand an indexed texture to RGBA8 pixels.
+
+        Only call this where full colour pixels are needed, the indexed form is what
+        is kept in memory.
+
+        @param _UUID The UUID of the texture.
+        @param _rgba Receives width * height * 4 bytes.
+        @param _palette Optional palette to expand with instead of the texture's own,
+                        used for palette-swap effects.
+        @return True if the texture was indexed and has been expanded.
+        *****************************************************************************/
+        bool expandTexture(UUID _UUID, std::vector<uint8_t>& _rgba, const Palette* _palette = nullptr);
+
+        /*!**************************************************************************
+        @brief Replace the palette colours of a single indexed texture.
+
+        If other textures share the palette the texture is given its own copy
+        first, so only this texture is recoloured. Use PaletteBank::setPalette to
+        swap every texture sharing a palette.
+
+        @param _UUID The UUID of the texture.
+        @param _palette The new colours, must not exceed the old palette size.
+        @return True if the texture was indexed and its palette has been replaced.
+        *****************************************************************************/
+        bool setTexturePalette(UUID _UUID, const Palette& _palette);
+
+        /*!**************************************************************************
+        @brief Get the palette bank shared by all indexed textures.
+
+        @return A reference to the palette bank.
+        *****************************************************************************/
+        PaletteBank& getPaletteBank() { return m_paletteBank; }
+
+        /*!**************************************************************************
+        @brief Share decoded asset payloads with other engine processes.
+
+        Opt-in. The first process to call this creates the region, later ones attach
+        to it. Textures imported after this call are looked up in the region by
+        content hash before being decoded, and published there if they are not found.
+
+        @param _name The name of the region, the same in every process.
+        @param _capacity The number of payload bytes, only used by the creator.
+        @return True if the region is mapped.
+        *****************************************************************************/
+        bool enableSharedCache(const std::string& _name = "SOL_SharedAssetCache", size_t _capacity = 256u << 20);
+
+        /*!**************************************************************************
+        @brief Get the asset browser preview of a texture.
+
+        Previews are generated on the worker pool and cached on disk by content
+        hash, so this never decodes on the calling thread. A placeholder is returned
+        until the preview is ready.
+
+        @param _UUID The UUID of the texture.
+        @return The preview, or the placeholder if it is not ready.
+        *****************************************************************************/
+        const Thumbnail& getThumbnail(UUID _UUID);
+
+        /*!**************************************************************************
+        @brief Collect previews finished since the last call.
+
+        Call once per frame while the asset browser is open.
+        *****************************************************************************/
+        void updateThumbnails() { m_thumbnailCache.update(); }
+
+//______________________________________LOAD QUEUE____________________________________________________//
+        /*!**************************************************************************
+        @brief Queue an asset to be loaded by updateLoadQueue.
+
+        Requests are served by priority, then deadline, then request order. Asking
+        again for a queued asset only ever raises its priority or brings its
+        deadline forward.
+
+        @param _UUID The UUID of an asset in the editor map.
+        @param _priority How soon the asset is needed.
+        @param _deadline Time from now by which the asset should be loaded, zero for
+                         no deadline. Overdue requests are loaded regardless of budget.
+        *****************************************************************************/
+        void requestLoad(UUID _UUID, Load_Priority _priority, std::chrono::milliseconds _deadline = std::chrono::milliseconds(0));
+
+        /*!**************************************************************************
+        @brief Move a queued asset to the front because something is waiting on it.
+
+        @param _UUID The UUID of the asset.
+        *****************************************************************************/
+        void boostLoad(UUID _UUID);
+
+        /*!**************************************************************************
+        @brief Load a queued asset now instead of waiting for its turn.
+
+        @param _UUID The UUID of the asset.
+        @return True if the asset is loaded.
+        *****************************************************************************/
+        bool ensureLoaded(UUID _UUID);
+
+        /*!**************************************************************************
+        @brief Load queued assets in priority order within a time budget.
+
+        Call once per frame. Critical and overdue requests are always loaded, wherever
+        they sit in the queue, the rest stop once the budget is spent.
+
+        @param _budgetMs The time this call may spend loading, in milliseconds.
+        @return The number of assets loaded.
+        *****************************************************************************/
+        size_t updateLoadQueue(double _budgetMs);
+
+        /*!**************************************************************************
+        @brief Get the number of assets still waiting in the load queue.
+
+        @return The number of queued requests.
+        *****************************************************************************/
+        size_t getPendingLoadCount() const { return m_loadQueue.size(); }
+
+        /*!**************************************************************************
+        @brief Choose whether initAssetManager loads everything or only the
+               critical assets, leaving the rest to updateLoadQueue.
+
+        @param _deferred True to defer everything but critical assets.
+        *****************************************************************************/
+        void setDeferredLoading(bool _deferred) { m_deferredLoading = _deferred; }
+
+        /*!**************************************************************************
+        @brief Set the priority an asset is loaded with and saved under.
+
+        @param _UUID The UUID of the asset.
+        @param _priority The priority.
+        *****************************************************************************/
+        void setAssetPriority(UUID _UUID, Load_Priority _priority);
+
+        /*!**************************************************************************
+        @brief Get the priority an asset is loaded with.
+
+        @param _UUID The UUID of the asset.
+        @return The priority, SCENE unless set otherwise.
+        *****************************************************************************/
+        Load_Priority getAssetPriority(UUID _UUID) const;
+
+//______________________________________BULK IMPORT___________________________________________________//
+        /*!**************************************************************************
+        @brief Import every asset in a folder and its subfolders.
+
+        Files are classified and checked against the editor map in one pass, the
+        CPU side of each import runs on the worker pool, and the manifest is written
+        once at the end. Files whose contents match another file in the same import
+        are skipped. Progress is reported on the calling thread.
+
+        @param _directory The folder to import.
+        @param _onProgress Called as files are decoded and registered, may be empty.
+        @return The number of assets imported.
+        *****************************************************************************/
+        size_t importFolder(const std::string& _directory, const std::function<void(const ImportProgress&)>& _onProgress = nullptr);
+
+//______________________________________PATCH PACKS___________________________________________________//
+        /*!**************************************************************************
+        @brief Write the hash manifest used as the base for patch packs.
+
+        Records the UUID, type, name, file path and content hash of every registered
+        asset, together with a manifest version number.
+
+        @param _manifestPath The manifest file to write.
+        @param _version The version number of this manifest.
+        @return True if the manifest was written.
+        *****************************************************************************/
+        bool writeAssetManifest(const std::string& _manifestPath, uint32_t _version);
+
+        /*!**************************************************************************
+        @brief Build a patch pack against a base hash manifest.
+
+        Only assets whose content hash, name or file path changed since the base
+        manifest are written, together with a manifest delta that also lists the
+        assets removed since then.
+
+        @param _baseManifestPath The hash manifest of the version players have.
+        @param _packPath The patch pack to write.
+        @param _targetVersion The manifest version after the patch is applied.
+        @return True if the patch pack was written.
+        *****************************************************************************/
+        bool buildPatchPack(const std::string& _baseManifestPath, const std::string& _packPath, uint32_t _targetVersion);
+
+        /*!**************************************************************************
+        @brief Mount a patch pack over the base assets.
+
+        The pack is mounted in the VirtualFileSystem above the loose files, so the
+        cost is proportional to the number of changed assets. Patches
+        mounted before initAssetManager are applied as the manifest is read,
+        patches mounted later reload the assets they change.
+
+        The patch is refused unless its base version matches the current manifest
+        version, read from the hash manifest if no version is known yet. A patch is
+        never mounted over a base whose version cannot be verified.
+
+        @param _packPath The patch pack to mount.
+        @return True if the patch was mounted.
+        *****************************************************************************/
+        bool mountPatch(const std::string& _packPath);
+
+        /*!**************************************************************************
+        @brief Resolve a manifest file path to the file that should be loaded.
+
+        Goes through the VirtualFileSystem, so files provided by a pack or patch
+        resolve to the copy extracted from it.
+
+        @param _filepath The file path as written in the manifest.
+        @return The file path to load from.
+        *****************************************************************************/
+        std::string resolveAssetPath(const std::string& _filepath) const;
  
 //________________________________________AUDIOS_____________________________________________________//
         /*!**************************************************************************
@@ -359,11 +609,228 @@ namespace SOL
 
         std::unordered_map<Asset_Type, std::unordered_map<UUID, std::pair<std::string, std::string>>> m_EditorMap; //filepath last
 
+        using LoadClock = std::chrono::steady_clock;
+
+        struct LoadRequest
+        {
+            UUID m_UUID;
+            Asset_Type m_Type;
+            Load_Priority m_Priority;
+            LoadClock::time_point m_Deadline;   //time_point::max() if there is none
+            uint64_t m_Sequence;                //keeps requests of equal urgency in request order
+
+            /*!**************************************************************************
+            @brief Order load requests by priority, then deadline, then request order.
+            *****************************************************************************/
+            bool operator<(const LoadRequest& _rhs) const;
+        };
+
+        std::set<LoadRequest> m_loadQueue;
+        std::unordered_map<UUID, std::set<LoadRequest>::iterator> m_queuedLoads;  //UUID:QUEUE POSITION
+        std::unordered_map<UUID, Load_Priority> m_assetPriority;                   //only assets that are not SCENE
+        uint64_t m_loadSequence{};
+        bool m_deferredLoading{};
+
+        SharedAssetCache m_sharedCache;                               //must outlive the textures pointing into it
+        std::unordered_map<UUID, ContentHash> m_sharedLeases;         //UUID:SHARED PAYLOAD KEY
+        std::unordered_map<UUID, IndexedTexture> m_indexedTextureMap; //UUID:INDICES
+        std::unordered_set<UUID> m_pendingUploads;                    //indexed textures not uploaded as RGBA yet
+        PaletteBank m_paletteBank;
+
+        WorkerPool m_workerPool;         //must be declared before anything that submits to it
+        ThumbnailCache m_thumbnailCache;
+
+        std::vector<AssetPack> m_patches;                                 //mounted in order
+        std::string m_hashManifestFilepath;
+        uint32_t m_manifestVersion{};
+        bool m_initialized{};
+
         std::string m_assetFilepath;
 
         FontPathPair m_FontPair;
         TexPathPair m_TexPair;
 
+        struct CookedTexture
+        {
+            IndexedTexture m_Indexed;
+            Palette m_Palette;
+            ContentHash m_SharedKey{};   //non zero if m_Indexed points into the SharedAssetCache
+        };
+
+        /*!**************************************************************************
+        @brief Import the palette-indexed form of a texture.
+
+        Reads the cooked .sidx file of the current source contents, otherwise
+        decodes the image, indexes it if it has 256 colours or less and writes the
+        cooked file for the next run.
+
+        @param _texUUID The UUID of the texture.
+        @param _filepath The file path of the source image.
+        *****************************************************************************/
+        void importIndexedTexture(UUID _texUUID, const std::string& _filepath);
+
+        /*!**************************************************************************
+        @brief Produce the palette-indexed form of a texture without touching the
+               AssetManager, so it can run on a worker thread.
+
+        @param _texUUID The UUID of the texture.
+        @param _filepath The file path of the source image.
+        @param _cooked Receives the indexed texture and its palette.
+        @param _shared The shared asset cache to attach to or publish in, may be nullptr.
+        @return True if the texture was read or decoded.
+        *****************************************************************************/
+        static bool cookIndexedTexture(UUID _texUUID, const std::string& _filepath, CookedTexture& _cooked, SharedAssetCache* _shared);
+
+        /*!**************************************************************************
+        @brief Drop the shared asset cache reference held for a texture, if any.
+
+        @param _texUUID The UUID of the texture.
+        *****************************************************************************/
+        void releaseSharedTexture(UUID _texUUID);
+
+        /*!**************************************************************************
+        @brief Store a cooked indexed texture and add its palette to the bank.
+
+        @param _texUUID The UUID of the texture.
+        @param _filepath The file path of the source image.
+        @param _cooked The indexed texture and its palette.
+        *****************************************************************************/
+        void registerIndexedTexture(UUID _texUUID, const std::string& _filepath, CookedTexture& _cooked);
+
+        /*!**************************************************************************
+        @brief Load a texture under a known UUID.
+
+        @param _texUUID The UUID of the texture.
+        @param _name The name of the texture.
+        @param _filepath The file path of the texture as written in the manifest.
+        @param _cooked The indexed form if it was already cooked, nullptr to cook it here.
+        *****************************************************************************/
+        void loadTextureAsset(UUID _texUUID, const std::string& _name, const std::string& _filepath, CookedTexture* _cooked = nullptr);
+
+        /*!**************************************************************************
+        @brief Upload the RGBA texture of an indexed texture if it is still pending.
+
+        Indexed textures skip the RGBA load when they are imported, it is done the
+        first time the texture itself is asked for.
+
+        @param _texUUID The UUID of the texture.
+        *****************************************************************************/
+        void uploadTexture(UUID _texUUID);
+
+        /*!**************************************************************************
+        @brief Load an audio under a known UUID.
+
+        @param _audioUUID The UUID of the audio.
+        @param _name The name of the audio.
+        @param _filepath The file path of the audio as written in the manifest.
+        *****************************************************************************/
+        void loadAudioAsset(UUID _audioUUID, const std::string& _name, const std::string& _filepath);
+
+        /*!**************************************************************************
+        @brief Load a font under a known UUID.
+
+        @param _fontUUID The UUID of the font.
+        @param _name The name of the font.
+        @param _filepath The file path of the font as written in the manifest.
+        *****************************************************************************/
+        void loadFontAsset(UUID _fontUUID, const std::string& _name, const std::string& _filepath);
+
+        /*!**************************************************************************
+        @brief Get the manifest section name of an asset type.
+
+        @param _type The asset type.
+        @return "textures", "audios" or "fonts", nullptr for other types.
+        *****************************************************************************/
+        static const char* getManifestSection(Asset_Type _type);
+
+        /*!**************************************************************************
+        @brief Load the asset of a request taken off the queue.
+
+        @param _request The request.
+        *****************************************************************************/
+        void loadRequested(const LoadRequest& _request);
+
+        /*!**************************************************************************
+        @brief Remove an asset from the load queue.
+
+        @param _UUID The UUID of the asset.
+        *****************************************************************************/
+        void cancelLoad(UUID _UUID);
+
+        /*!**************************************************************************
+        @brief Check if an asset has been loaded.
+
+        @param _UUID The UUID of the asset.
+        @return True if the texture, audio or font is loaded.
+        *****************************************************************************/
+        bool isAssetLoaded(UUID _UUID) const;
+
+        /*!**************************************************************************
+        @brief Find the type of an asset in the editor map.
+
+        @param _UUID The UUID of the asset.
+        @return The asset type, UNKNOWN_ASSET_TYPE if it is not registered.
+        *****************************************************************************/
+        Asset_Type getAssetType(UUID _UUID) const;
+
+        /*!**************************************************************************
+        @brief Get the assets of a type sorted by priority, then name.
+
+        Gives the manifest and the load queue a stable order instead of the order
+        of the unordered editor map.
+
+        @param _type The asset type.
+        @param _editorMap The editor map to read.
+        @return The sorted UUIDs.
+        *****************************************************************************/
+        std::vector<UUID> getSortedAssets(Asset_Type _type, const EditorMap& _editorMap) const;
+
+        /*!**************************************************************************
+        @brief Get the assets of a type sorted by priority, then name.
+
+        @param _type The asset type.
+        @return The sorted UUIDs.
+        *****************************************************************************/
+        std::vector<UUID> getSortedAssets(Asset_Type _type) const;
+
+        /*!**************************************************************************
+        @brief Convert a load priority to the name used in the manifest.
+
+        @param _priority The priority.
+        @return "critical", "scene" or "background".
+        *****************************************************************************/
+        static const char* priorityToString(Load_Priority _priority);
+
+        /*!**************************************************************************
+        @brief Convert a manifest priority name to a load priority.
+
+        @param _name The name.
+        @return The priority, SCENE for unknown names.
+        *****************************************************************************/
+        static Load_Priority priorityFromString(const std::string& _name);
+
+        /*!**************************************************************************
+        @brief Read one section of an asset manifest into the editor map.
+
+        Nothing is loaded, the entries are only registered.
+
+        @param _doc The parsed manifest.
+        @param _type The asset type of the section to read.
+        @return The UUIDs of the entries read.
+        *****************************************************************************/
+        std::vector<UUID> readManifestSection(const rapidjson::Value& _doc, Asset_Type _type);
+
+        /*!**************************************************************************
+        @brief Apply a manifest delta from a patch pack to the editor map.
+
+        The delta has the same sections as assets_serialized.json, plus a "removed"
+        array of UUIDs. If the AssetManager is already initialized, changed assets
+        are reloaded and removed assets are unloaded.
+
+        @param _delta The manifest delta as JSON.
+        *****************************************************************************/
+        void applyManifestDelta(const std::string& _delta);
+
     public:
 
         //_________________________________________________SHARED FUNCTION________________________________________________________________________
@@ -0,0 +1,216 @@
+/******************************************************************************/
+/*!
+\file		AssetPack.cpp
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the definitions for the AssetPack class, the
+            .solpatch container used to ship only the assets that changed since
+            a base manifest version
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#include "SOLpch.h"
+#include "SOL/AssetManager/AssetPack.h"
+
+namespace SOL
+{
+    namespace
+    {
+        const char s_PackMagic[4] = { 'S', 'P', 'A', 'K' };
+
+        #pragma pack(push, 1)
+        struct PackHeader
+        {
+            char m_Magic[4];
+            uint16_t m_Version;
+            uint16_t m_Reserved;
+            uint32_t m_BaseVersion;
+            uint32_t m_TargetVersion;
+            uint32_t m_EntryCount;
+            uint32_t m_ManifestDeltaSize;
+        };
+
+        struct PackTableEntry
+        {
+            uint64_t m_Hash;
+            uint64_t m_Offset;
+            uint64_t m_Size;
+            uint16_t m_PathLength; //followed by the path bytes
+        };
+        #pragma pack(pop)
+    }
+
+    /*!**************************************************************************
+    @brief Normalize an asset path so it can be used as a lookup key.
+
+    Converts backslashes to slashes and strips a leading "./", so
+    "./Assets/Gem_16.png" and "Assets\\Gem_16.png" map to the same entry.
+
+    @param _filepath The path to normalize.
+    @return The normalized path.
+    *****************************************************************************/
+    std::string normalizeAssetPath(const std::string& _filepath)
+    {
+        std::string path = _filepath;
+        std::replace(path.begin(), path.end(), '\\', '/');
+        while (path.compare(0, 2, "./") == 0)
+        {
+            path.erase(0, 2);
+        }
+        return path;
+    }
+
+    /*!**************************************************************************
+    @brief Write a pack file.
+
+    Layout: header, entry table, manifest delta, then the file contents.
+
+    @param _packPath The pack file to write.
+    @param _baseVersion The manifest version the pack applies on top of.
+    @param _targetVersion The manifest version after the pack is applied.
+    @param _sources The files to store.
+    @param _manifestDelta The manifest delta as JSON.
+    @return True if the pack was written.
+    *****************************************************************************/
+    bool AssetPack::write(const std::string& _packPath, uint32_t _baseVersion, uint32_t _targetVersion,
+                          const std::vector<Source>& _sources, const std::string& _manifestDelta)
+    {
+        std::vector<std::vector<uint8_t>> contents(_sources.size());
+        std::vector<std::string> paths(_sources.size());
+        uint64_t dataOffset = sizeof(PackHeader) + _manifestDelta.size();
+
+        for (size_t i = 0; i < _sources.size(); ++i)
+        {
+            if (!readFileBytes(_sources[i].m_Filepath, contents[i]))
+            {
+                ANALYTICS_ERROR("Failed to read " + _sources[i].m_Filepath + " into pack.");
+                return false;
+            }
+            paths[i] = normalizeAssetPath(_sources[i].m_LogicalPath);
+            dataOffset += sizeof(PackTableEntry) + paths[i].size();
+        }
+
+        std::ofstream file(_packPath, std::ios::binary);
+        if (!file.is_open())
+        {
+            ANALYTICS_ERROR("Failed to open " + _packPath + " for writing.");
+            return false;
+        }
+
+        PackHeader header{};
+        std::memcpy(header.m_Magic, s_PackMagic, sizeof(s_PackMagic));
+        header.m_Version = s_PackVersion;
+        header.m_BaseVersion = _baseVersion;
+        header.m_TargetVersion = _targetVersion;
+        header.m_EntryCount = static_cast<uint32_t>(_sources.size());
+        header.m_ManifestDeltaSize = static_cast<uint32_t>(_manifestDelta.size());
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        for (size_t i = 0; i < _sources.size(); ++i)
+        {
+            PackTableEntry entry{};
+            entry.m_Hash = hashBytes(contents[i].data(), contents[i].size());
+            entry.m_Offset = dataOffset;
+            entry.m_Size = contents[i].size();
+            entry.m_PathLength = static_cast<uint16_t>(paths[i].size());
+            file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+            file.write(paths[i].data(), paths[i].size());
+            dataOffset += contents[i].size();
+        }
+
+        file.write(_manifestDelta.data(), _manifestDelta.size());
+        for (const std::vector<uint8_t>& bytes : contents)
+        {
+            file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        }
+        return file.good();
+    }
+
+    /*!**************************************************************************
+    @brief Open a pack file.
+
+    Reads the header, entry table and manifest delta, and builds the lookup
+    table. File contents are not read.
+
+    @param _packPath The pack file to open.
+    @return True if the pack is valid.
+    *****************************************************************************/
+    bool AssetPack::open(const std::string& _packPath)
+    {
+        std::ifstream file(_packPath, std::ios::binary);
+        if (!file.is_open())
+        {
+            ANALYTICS_ERROR("Failed to open pack " + _packPath);
+            return false;
+        }
+
+        PackHeader header{};
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            std::memcmp(header.m_Magic, s_PackMagic, sizeof(s_PackMagic)) != 0 ||
+            header.m_Version != s_PackVersion)
+        {
+            ANALYTICS_ERROR(_packPath + " is not a valid asset pack.");
+            return false;
+        }
+
+        m_packPath = _packPath;
+        m_baseVersion = header.m_BaseVersion;
+        m_targetVersion = header.m_TargetVersion;
+        m_entries.clear();
+        m_entries.reserve(header.m_EntryCount);
+
+        for (uint32_t i = 0; i < header.m_EntryCount; ++i)
+        {
+            PackTableEntry entry{};
+            std::string path;
+            file.read(reinterpret_cast<char*>(&entry), sizeof(entry));
+            path.resize(entry.m_PathLength);
+            file.read(&path[0], path.size());
+            if (!file)
+            {
+                ANALYTICS_ERROR(_packPath + " has a truncated entry table.");
+                return false;
+            }
+            m_entries[path] = PackEntry{ entry.m_Hash, entry.m_Offset, entry.m_Size };
+        }
+
+        m_manifestDelta.resize(header.m_ManifestDeltaSize);
+        file.read(&m_manifestDelta[0], m_manifestDelta.size());
+        return static_cast<bool>(file);
+    }
+
+    /*!**************************************************************************
+    @brief Find an entry by path.
+
+    @param _logicalPath The path of the asset.
+    @return A pointer to the entry, nullptr if the pack does not contain it.
+    *****************************************************************************/
+    const PackEntry* AssetPack::findEntry(const std::string& _logicalPath) const
+    {
+        auto it = m_entries.find(normalizeAssetPath(_logicalPath));
+        return it != m_entries.end() ? &it->second : nullptr;
+    }
+
+    /*!**************************************************************************
+    @brief Read the contents of an entry.
+
+    @param _entry The entry to read.
+    @param _bytes Receives the file contents.
+    @return True if the contents were read.
+    *****************************************************************************/
+    bool AssetPack::readEntry(const PackEntry& _entry, std::vector<uint8_t>& _bytes) const
+    {
+        std::ifstream file(m_packPath, std::ios::binary);
+        if (!file.is_open())
+            return false;
+
+        _bytes.resize(static_cast<size_t>(_entry.m_Size));
+        file.seekg(static_cast<std::streamoff>(_entry.m_Offset));
+        file.read(reinterpret_cast<char*>(_bytes.data()), _bytes.size());
+        return static_cast<bool>(file);
+    }
+}
@@ -0,0 +1,127 @@
+/******************************************************************************/
+/*!
+\file		AssetPack.h
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the declarations for the AssetPack class, the
+            .solpatch container used to ship only the assets that changed since
+            a base manifest version
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#ifndef _ASSETPACK_H_
+#define _ASSETPACK_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <SOL/AssetManager/ContentHash.h>
+
+namespace SOL
+{
+    struct PackEntry
+    {
+        ContentHash m_Hash{};
+        uint64_t m_Offset{}; //from the start of the pack file
+        uint64_t m_Size{};
+    };
+
+    /*!**************************************************************************
+    @brief Normalize an asset path so it can be used as a lookup key.
+
+    Converts backslashes to slashes and strips a leading "./", so
+    "./Assets/Gem_16.png" and "Assets\\Gem_16.png" map to the same entry.
+
+    @param _filepath The path to normalize.
+    @return The normalized path.
+    *****************************************************************************/
+    std::string normalizeAssetPath(const std::string& _filepath);
+
+    class AssetPack
+    {
+    public:
+
+        static const uint16_t s_PackVersion = 1;
+
+        struct Source
+        {
+            std::string m_LogicalPath; //path the asset is looked up by, as written in the manifest
+            std::string m_Filepath;    //file the bytes are read from when the pack is built
+        };
+
+        /*!**************************************************************************
+        @brief Write a pack file.
+
+        Layout: header, entry table, manifest delta, then the file contents.
+
+        @param _packPath The pack file to write.
+        @param _baseVersion The manifest version the pack applies on top of.
+        @param _targetVersion The manifest version after the pack is applied.
+        @param _sources The files to store.
+        @param _manifestDelta The manifest delta as JSON.
+        @return True if the pack was written.
+        *****************************************************************************/
+        static bool write(const std::string& _packPath, uint32_t _baseVersion, uint32_t _targetVersion,
+                          const std::vector<Source>& _sources, const std::string& _manifestDelta);
+
+        /*!**************************************************************************
+        @brief Open a pack file.
+
+        Reads the header, entry table and manifest delta, and builds the lookup
+        table. File contents are not read.
+
+        @param _packPath The pack file to open.
+        @return True if the pack is valid.
+        *****************************************************************************/
+        bool open(const std::string& _packPath);
+
+        /*!**************************************************************************
+        @brief Find an entry by path.
+
+        @param _logicalPath The path of the asset.
+        @return A pointer to the entry, nullptr if the pack does not contain it.
+        *****************************************************************************/
+        const PackEntry* findEntry(const std::string& _logicalPath) const;
+
+        /*!**************************************************************************
+        @brief Read the contents of an entry.
+
+        @param _entry The entry to read.
+        @param _bytes Receives the file contents.
+        @return True if the contents were read.
+        *****************************************************************************/
+        bool readEntry(const PackEntry& _entry, std::vector<uint8_t>& _bytes) const;
+
+        /*!**************************************************************************
+        @brief Get every entry in the pack.
+
+        @return A map of normalized paths to entries.
+        *****************************************************************************/
+        const std::unordered_map<std::string, PackEntry>& getEntries() const { return m_entries; }
+
+        /*!**************************************************************************
+        @brief Get the manifest delta stored in the pack.
+
+        @return The manifest delta as JSON.
+        *****************************************************************************/
+        const std::string& getManifestDelta() const { return m_manifestDelta; }
+
+        uint32_t getBaseVersion() const { return m_baseVersion; }
+        uint32_t getTargetVersion() const { return m_targetVersion; }
+        const std::string& getPackPath() const { return m_packPath; }
+
+    private:
+
+        std::string m_packPath;
+        uint32_t m_baseVersion{};
+        uint32_t m_targetVersion{};
+        std::unordered_map<std::string, PackEntry> m_entries; //NORMALIZED PATH:ENTRY
+        std::string m_manifestDelta;
+    };
+}
+#endif // _ASSETPACK_H_
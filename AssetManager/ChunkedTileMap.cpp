@@ -0,0 +1,638 @@
+/******************************************************************************/
+/*!
+\file		ChunkedTileMap.cpp
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the definitions for the ChunkedTileMap class,
+            the .soltiles chunked form of the Json/map.txt tile grid
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#include "SOLpch.h"
+#include "SOL/AssetManager/ChunkedTileMap.h"
+#include "SOL/AssetManager/VirtualFileSystem.h"
+
+namespace SOL
+{
+    namespace
+    {
+        const char s_TileMapMagic[4] = { 'S', 'T', 'I', 'L' };
+        const char* const s_TileMapExtension = ".soltiles";
+        const uint32_t s_MaxChunkSize = 1024;
+
+        #pragma pack(push, 1)
+        struct TileMapHeader
+        {
+            char m_Magic[4];
+            uint16_t m_Version;
+            uint16_t m_ChunkSize;
+            uint32_t m_Width;
+            uint32_t m_Height;
+            uint32_t m_EmptyValue;
+            uint32_t m_Reserved;
+            uint64_t m_ChunkCount;  //stored chunks, the directory entries that follow
+        };
+
+        struct ChunkEntry
+        {
+            uint64_t m_Index;       //chunkY * chunksX + chunkX, entries are sorted by it
+            uint64_t m_Offset;      //from the end of the directory
+            uint32_t m_Size;
+            uint8_t m_Encoding;
+            uint8_t m_Reserved[3];
+        };
+        #pragma pack(pop)
+
+        //How a stored chunk is encoded
+        enum ChunkEncoding : uint8_t
+        {
+            CHUNK_RLE = 1,          //varint (run length, value) pairs
+            CHUNK_PACKED = 2        //uint8 bit width, uint32 base, then every value minus base in that many bits
+        };
+
+        /*!**************************************************************************
+        @brief Append a value in 7 bit groups.
+        *****************************************************************************/
+        void writeVarint(std::vector<uint8_t>& _bytes, uint64_t _value)
+        {
+            while (_value >= 0x80)
+            {
+                _bytes.push_back(static_cast<uint8_t>(_value | 0x80));
+                _value >>= 7;
+            }
+            _bytes.push_back(static_cast<uint8_t>(_value));
+        }
+
+        /*!**************************************************************************
+        @brief Read a value written by writeVarint.
+        *****************************************************************************/
+        bool readVarint(const uint8_t*& _data, const uint8_t* _end, uint64_t& _value)
+        {
+            _value = 0;
+            for (uint32_t shift = 0; shift < 64 && _data < _end; shift += 7)
+            {
+                const uint8_t byte = *_data++;
+                _value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                    return true;
+            }
+            return false;
+        }
+
+        /*!**************************************************************************
+        @brief Collects the stored chunks of a tile map while it is encoded.
+        *****************************************************************************/
+        class ChunkWriter
+        {
+        public:
+            ChunkWriter(uint32_t _width, uint32_t _height, uint32_t _chunkSize, ChunkedTileMap::TileValue _emptyValue)
+                : m_width(_width), m_height(_height), m_chunkSize(_chunkSize), m_emptyValue(_emptyValue),
+                  m_chunksX((_width + _chunkSize - 1) / _chunkSize)
+            {
+            }
+
+            /*!**************************************************************************
+            @brief Encode every chunk of a band of chunk rows.
+
+            @param _rows The rows of the band in row-major order, shorter than a
+                         full band for the last one.
+            @param _rowCount The number of rows in _rows.
+            @param _chunkY The chunk row of the band.
+            *****************************************************************************/
+            void addBand(const ChunkedTileMap::TileValue* _rows, uint32_t _rowCount, uint32_t _chunkY)
+            {
+                std::vector<ChunkedTileMap::TileValue> cells(static_cast<size_t>(m_chunkSize) * m_chunkSize);
+                for (uint32_t chunkX = 0; chunkX < m_chunksX; ++chunkX)
+                {
+                    bool empty = true;
+                    std::fill(cells.begin(), cells.end(), m_emptyValue);
+                    for (uint32_t y = 0; y < _rowCount; ++y)
+                    {
+                        const uint32_t x0 = chunkX * m_chunkSize;
+                        const uint32_t columns = std::min(m_chunkSize, m_width - x0);
+                        const ChunkedTileMap::TileValue* row = _rows + static_cast<size_t>(y) * m_width + x0;
+                        for (uint32_t x = 0; x < columns; ++x)
+                        {
+                            cells[static_cast<size_t>(y) * m_chunkSize + x] = row[x];
+                            empty = empty && row[x] == m_emptyValue;
+                        }
+                    }
+                    if (!empty)
+                        addChunk(static_cast<uint64_t>(_chunkY) * m_chunksX + chunkX, cells);
+                }
+            }
+
+            /*!**************************************************************************
+            @brief Lay out the header, directory and chunk bytes.
+
+            @param _bytes Receives the file contents.
+            *****************************************************************************/
+            void finish(std::vector<uint8_t>& _bytes) const
+            {
+                TileMapHeader header{};
+                std::memcpy(header.m_Magic, s_TileMapMagic, sizeof(s_TileMapMagic));
+                header.m_Version = ChunkedTileMap::s_TileMapVersion;
+                header.m_ChunkSize = static_cast<uint16_t>(m_chunkSize);
+                header.m_Width = m_width;
+                header.m_Height = m_height;
+                header.m_EmptyValue = m_emptyValue;
+                header.m_ChunkCount = m_entries.size();
+
+                const size_t directorySize = m_entries.size() * sizeof(ChunkEntry);
+                _bytes.resize(sizeof(header) + directorySize + m_data.size());
+                std::memcpy(_bytes.data(), &header, sizeof(header));
+                if (directorySize != 0)
+                    std::memcpy(_bytes.data() + sizeof(header), m_entries.data(), directorySize);
+                if (!m_data.empty())
+                    std::memcpy(_bytes.data() + sizeof(header) + directorySize, m_data.data(), m_data.size());
+            }
+
+        private:
+
+            /*!**************************************************************************
+            @brief Store a chunk in whichever encoding is smaller.
+            *****************************************************************************/
+            void addChunk(uint64_t _index, const std::vector<ChunkedTileMap::TileValue>& _cells)
+            {
+                std::vector<uint8_t> rle;
+                for (size_t i = 0; i < _cells.size();)
+                {
+                    size_t next = i + 1;
+                    while (next < _cells.size() && _cells[next] == _cells[i])
+                    {
+                        ++next;
+                    }
+                    writeVarint(rle, next - i);
+                    writeVarint(rle, _cells[i]);
+                    i = next;
+                }
+
+                const auto range = std::minmax_element(_cells.begin(), _cells.end());
+                const uint32_t base = *range.first;
+                const uint32_t spread = *range.second - base;
+                uint8_t bits = 0;
+                while (bits < 32 && (spread >> bits) != 0)
+                {
+                    ++bits;
+                }
+                const size_t packedSize = 1 + sizeof(uint32_t) + (_cells.size() * bits + 7) / 8;
+
+                ChunkEntry entry{};
+                entry.m_Index = _index;
+                entry.m_Offset = m_data.size();
+                if (rle.size() <= packedSize)
+                {
+                    entry.m_Encoding = CHUNK_RLE;
+                    m_data.insert(m_data.end(), rle.begin(), rle.end());
+                }
+                else
+                {
+                    entry.m_Encoding = CHUNK_PACKED;
+                    m_data.push_back(bits);
+                    const uint8_t* baseBytes = reinterpret_cast<const uint8_t*>(&base);
+                    m_data.insert(m_data.end(), baseBytes, baseBytes + sizeof(base));
+
+                    uint64_t buffer = 0;
+                    uint32_t filled = 0;
+                    for (ChunkedTileMap::TileValue value : _cells)
+                    {
+                        buffer |= static_cast<uint64_t>(value - base) << filled;
+                        filled += bits;
+                        while (filled >= 8)
+                        {
+                            m_data.push_back(static_cast<uint8_t>(buffer));
+                            buffer >>= 8;
+                            filled -= 8;
+                        }
+                    }
+                    if (filled != 0)
+                        m_data.push_back(static_cast<uint8_t>(buffer));
+                }
+                entry.m_Size = static_cast<uint32_t>(m_data.size() - entry.m_Offset);
+                m_entries.push_back(entry);
+            }
+
+            uint32_t m_width;
+            uint32_t m_height;
+            uint32_t m_chunkSize;
+            ChunkedTileMap::TileValue m_emptyValue;
+            uint32_t m_chunksX;
+            std::vector<ChunkEntry> m_entries;  //added in index order, so already sorted
+            std::vector<uint8_t> m_data;
+        };
+
+        /*!**************************************************************************
+        @brief Decode a stored chunk, stopping once cell _last has been written.
+        *****************************************************************************/
+        bool decodeChunk(const uint8_t* _data, size_t _size, uint8_t _encoding, ChunkedTileMap::TileValue* _cells, size_t _last)
+        {
+            const uint8_t* end = _data + _size;
+            if (_encoding == CHUNK_RLE)
+            {
+                size_t cell = 0;
+                while (cell <= _last)
+                {
+                    uint64_t run{}, value{};
+                    if (!readVarint(_data, end, run) || !readVarint(_data, end, value) || run == 0)
+                        return false;
+                    // A run may go past _last when only part of the chunk is wanted
+                    const size_t count = static_cast<size_t>(std::min<uint64_t>(run, _last + 1 - cell));
+                    std::fill_n(_cells + cell, count, static_cast<ChunkedTileMap::TileValue>(value));
+                    cell += count;
+                }
+                return true;
+            }
+
+            if (_encoding == CHUNK_PACKED)
+            {
+                if (_size < 1 + sizeof(uint32_t))
+                    return false;
+                const uint8_t bits = *_data++;
+                uint32_t base{};
+                std::memcpy(&base, _data, sizeof(base));
+                _data += sizeof(base);
+                if (bits > 32 || static_cast<size_t>(end - _data) < ((_last + 1) * bits + 7) / 8)
+                    return false;
+
+                const uint64_t mask = (uint64_t(1) << bits) - 1;
+                uint64_t buffer = 0;
+                uint32_t available = 0;
+                for (size_t cell = 0; cell <= _last; ++cell)
+                {
+                    while (available < bits)
+                    {
+                        buffer |= static_cast<uint64_t>(*_data++) << available;
+                        available += 8;
+                    }
+                    _cells[cell] = base + static_cast<ChunkedTileMap::TileValue>(buffer & mask);
+                    buffer >>= bits;
+                    available -= bits;
+                }
+                return true;
+            }
+            return false;
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Get the .soltiles path for a text map path.
+
+    @param _textPath The text map, such as Json/map.txt.
+    @return The same path with a .soltiles extension.
+    *****************************************************************************/
+    std::string ChunkedTileMap::getChunkedPath(const std::string& _textPath)
+    {
+        return std::filesystem::path(_textPath).replace_extension(s_TileMapExtension).string();
+    }
+
+    /*!**************************************************************************
+    @brief Encode a grid.
+
+    @param _cells The cells in row-major order, _width * _height of them.
+    @param _width The grid width.
+    @param _height The grid height.
+    @param _bytes Receives the file contents.
+    @param _chunkSize The cells per chunk side.
+    @param _emptyValue The value of cells in chunks that are not stored.
+    @return False if the cell count does not match the size.
+    *****************************************************************************/
+    bool ChunkedTileMap::encode(const std::vector<TileValue>& _cells, uint32_t _width, uint32_t _height, std::vector<uint8_t>& _bytes,
+                                uint32_t _chunkSize, TileValue _emptyValue)
+    {
+        if (_chunkSize == 0 || _chunkSize > s_MaxChunkSize || _cells.size() != static_cast<size_t>(_width) * _height)
+            return false;
+
+        ChunkWriter writer(_width, _height, _chunkSize, _emptyValue);
+        for (uint32_t y = 0, chunkY = 0; y < _height; y += _chunkSize, ++chunkY)
+        {
+            writer.addBand(_cells.data() + static_cast<size_t>(y) * _width, std::min(_chunkSize, _height - y), chunkY);
+        }
+        writer.finish(_bytes);
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Convert a text map of whitespace separated values, one row per line.
+
+    The text is read one band of chunk rows at a time, so maps far larger than
+    memory allows as a whole can be converted.
+
+    @param _textPath The text map, resolved through the VirtualFileSystem mounts.
+    @param _outputPath The .soltiles file to write.
+    @param _chunkSize The cells per chunk side.
+    @return True if the file was written.
+    *****************************************************************************/
+    bool ChunkedTileMap::convertTextMap(const std::string& _textPath, const std::string& _outputPath, uint32_t _chunkSize)
+    {
+        if (_chunkSize == 0 || _chunkSize > s_MaxChunkSize)
+            return false;
+
+        MappedFile text;
+        if (!VirtualFileSystem::Get().mapFile(_textPath, text))
+        {
+            ANALYTICS_ERROR("Failed to open " + _textPath);
+            return false;
+        }
+
+        std::unique_ptr<ChunkWriter> writer;
+        std::vector<TileValue> band;
+        std::vector<TileValue> row;
+        uint32_t width = 0, height = 0, bandRows = 0;
+
+        const char* cursor = text.data();
+        const char* end = text.data() + text.size();
+        while (cursor < end)
+        {
+            // One line of values
+            row.clear();
+            while (cursor < end && *cursor != '\n')
+            {
+                if (*cursor >= '0' && *cursor <= '9')
+                {
+                    uint64_t value = 0;
+                    while (cursor < end && *cursor >= '0' && *cursor <= '9')
+                    {
+                        value = value * 10 + static_cast<uint64_t>(*cursor++ - '0');
+                        if (value > UINT32_MAX)
+                        {
+                            ANALYTICS_ERROR(_textPath + " has a value that does not fit a tile.");
+                            return false;
+                        }
+                    }
+                    row.push_back(static_cast<TileValue>(value));
+                }
+                else if (*cursor == ' ' || *cursor == '\t' || *cursor == '\r')
+                {
+                    ++cursor;
+                }
+                else
+                {
+                    ANALYTICS_ERROR(_textPath + " is not a grid of unsigned values.");
+                    return false;
+                }
+            }
+            ++cursor;
+            if (row.empty())
+                continue;
+
+            if (!writer)
+            {
+                width = static_cast<uint32_t>(row.size());
+                writer = std::make_unique<ChunkWriter>(width, UINT32_MAX, _chunkSize, 0);
+                band.resize(static_cast<size_t>(width) * _chunkSize);
+            }
+            if (row.size() != width)
+            {
+                ANALYTICS_ERROR(_textPath + " has rows of different lengths.");
+                return false;
+            }
+
+            std::copy(row.begin(), row.end(), band.begin() + static_cast<size_t>(bandRows) * width);
+            ++height;
+            if (++bandRows == _chunkSize)
+            {
+                writer->addBand(band.data(), bandRows, height / _chunkSize - 1);
+                bandRows = 0;
+            }
+        }
+
+        if (!writer)
+        {
+            ANALYTICS_ERROR(_textPath + " has no rows.");
+            return false;
+        }
+        if (bandRows != 0)
+            writer->addBand(band.data(), bandRows, height / _chunkSize);
+
+        // The height is only known now, the header is written last
+        std::vector<uint8_t> bytes;
+        writer->finish(bytes);
+        TileMapHeader header{};
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        header.m_Height = height;
+        std::memcpy(bytes.data(), &header, sizeof(header));
+
+        std::ofstream file(_outputPath, std::ios::binary);
+        if (!file.is_open())
+        {
+            ANALYTICS_ERROR("Failed to open " + _outputPath + " for writing.");
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+        ANALYTICS_INFO(_textPath + ": " + std::to_string(text.size()) + " bytes of text, " + std::to_string(bytes.size()) + " bytes chunked");
+        return file.good();
+    }
+
+    /*!**************************************************************************
+    @brief Map a .soltiles file and check its directory.
+
+    @param _filepath The file, resolved through the VirtualFileSystem mounts.
+    @return True if the file is a valid tile map.
+    *****************************************************************************/
+    bool ChunkedTileMap::open(const std::string& _filepath)
+    {
+        close();
+        if (!VirtualFileSystem::Get().mapFile(_filepath, m_file))
+        {
+            ANALYTICS_ERROR("Failed to open " + _filepath);
+            return false;
+        }
+        if (!readHeader())
+        {
+            ANALYTICS_ERROR(_filepath + " is not a valid tile map.");
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Take ownership of a tile map in memory.
+
+    @param _bytes The file contents.
+    @return True if the contents are a valid tile map.
+    *****************************************************************************/
+    bool ChunkedTileMap::load(std::vector<uint8_t>&& _bytes)
+    {
+        close();
+        m_file.adopt(std::move(_bytes));
+        if (!readHeader())
+        {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Release the file.
+    *****************************************************************************/
+    void ChunkedTileMap::close()
+    {
+        m_file.close();
+        m_directory = nullptr;
+        m_chunkData = nullptr;
+        m_chunkDataSize = 0;
+        m_chunkCount = 0;
+        m_width = m_height = m_chunkSize = m_chunksX = m_chunksY = 0;
+        m_emptyValue = 0;
+    }
+
+    /*!**************************************************************************
+    @brief Check the header and directory of the contents in m_file.
+
+    @return True if the contents are a valid tile map.
+    *****************************************************************************/
+    bool ChunkedTileMap::readHeader()
+    {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(m_file.data());
+        const size_t size = m_file.size();
+
+        TileMapHeader header{};
+        if (size < sizeof(header))
+            return false;
+        std::memcpy(&header, data, sizeof(header));
+        if (std::memcmp(header.m_Magic, s_TileMapMagic, sizeof(s_TileMapMagic)) != 0 || header.m_Version != s_TileMapVersion ||
+            header.m_ChunkSize == 0 || header.m_ChunkSize > s_MaxChunkSize ||
+            header.m_ChunkCount > (size - sizeof(header)) / sizeof(ChunkEntry))
+        {
+            return false;
+        }
+
+        m_width = header.m_Width;
+        m_height = header.m_Height;
+        m_chunkSize = header.m_ChunkSize;
+        m_chunksX = (m_width + m_chunkSize - 1) / m_chunkSize;
+        m_chunksY = (m_height + m_chunkSize - 1) / m_chunkSize;
+        m_emptyValue = header.m_EmptyValue;
+        m_chunkCount = static_cast<size_t>(header.m_ChunkCount);
+        m_directory = data + sizeof(header);
+        m_chunkData = m_directory + m_chunkCount * sizeof(ChunkEntry);
+        m_chunkDataSize = size - sizeof(header) - m_chunkCount * sizeof(ChunkEntry);
+
+        // Every chunk has to be in the grid, in order and inside the file
+        const uint64_t gridChunks = static_cast<uint64_t>(m_chunksX) * m_chunksY;
+        uint64_t previous = 0;
+        for (size_t i = 0; i < m_chunkCount; ++i)
+        {
+            ChunkEntry entry{};
+            std::memcpy(&entry, m_directory + i * sizeof(ChunkEntry), sizeof(entry));
+            if (entry.m_Index >= gridChunks || (i != 0 && entry.m_Index <= previous) ||
+                entry.m_Offset > m_chunkDataSize || entry.m_Size > m_chunkDataSize - entry.m_Offset)
+            {
+                return false;
+            }
+            previous = entry.m_Index;
+        }
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Find the stored bytes of a chunk.
+
+    @param _chunkX The chunk column.
+    @param _chunkY The chunk row.
+    @param _encoding Receives how the chunk is stored.
+    @param _size Receives the size of the bytes.
+    @return The bytes, nullptr if the chunk is not stored.
+    *****************************************************************************/
+    const uint8_t* ChunkedTileMap::findChunk(uint32_t _chunkX, uint32_t _chunkY, uint8_t& _encoding, size_t& _size) const
+    {
+        if (_chunkX >= m_chunksX || _chunkY >= m_chunksY)
+            return nullptr;
+
+        const uint64_t index = static_cast<uint64_t>(_chunkY) * m_chunksX + _chunkX;
+        size_t low = 0, high = m_chunkCount;
+        while (low < high)
+        {
+            const size_t middle = low + (high - low) / 2;
+            ChunkEntry entry{};
+            std::memcpy(&entry, m_directory + middle * sizeof(ChunkEntry), sizeof(entry));
+            if (entry.m_Index < index)
+            {
+                low = middle + 1;
+            }
+            else if (entry.m_Index > index)
+            {
+                high = middle;
+            }
+            else
+            {
+                _encoding = entry.m_Encoding;
+                _size = entry.m_Size;
+                return m_chunkData + entry.m_Offset;
+            }
+        }
+        return nullptr;
+    }
+
+    /*!**************************************************************************
+    @brief Check if a chunk is stored, chunks that are not hold only the empty value.
+
+    @param _chunkX The chunk column.
+    @param _chunkY The chunk row.
+    @return True if the chunk is stored.
+    *****************************************************************************/
+    bool ChunkedTileMap::hasChunk(uint32_t _chunkX, uint32_t _chunkY) const
+    {
+        uint8_t encoding{};
+        size_t size{};
+        return findChunk(_chunkX, _chunkY, encoding, size) != nullptr;
+    }
+
+    /*!**************************************************************************
+    @brief Decode one chunk. Safe to call from several threads at once.
+
+    @param _chunkX The chunk column.
+    @param _chunkY The chunk row.
+    @param _cells Receives getChunkSize() squared cells in row-major order,
+                  cells past the edge of the grid hold the empty value.
+    @return False if the chunk is outside the grid or corrupt.
+    *****************************************************************************/
+    bool ChunkedTileMap::readChunk(uint32_t _chunkX, uint32_t _chunkY, std::vector<TileValue>& _cells) const
+    {
+        if (_chunkX >= m_chunksX || _chunkY >= m_chunksY)
+            return false;
+
+        const size_t cellCount = static_cast<size_t>(m_chunkSize) * m_chunkSize;
+        uint8_t encoding{};
+        size_t size{};
+        const uint8_t* data = findChunk(_chunkX, _chunkY, encoding, size);
+        if (data == nullptr)
+        {
+            _cells.assign(cellCount, m_emptyValue);
+            return true;
+        }
+
+        _cells.resize(cellCount);
+        return decodeChunk(data, size, encoding, _cells.data(), cellCount - 1);
+    }
+
+    /*!**************************************************************************
+    @brief Get a single cell, decoding only as much of its chunk as needed.
+
+    @param _x The cell column.
+    @param _y The cell row.
+    @return The cell value, the empty value outside the grid.
+    *****************************************************************************/
+    ChunkedTileMap::TileValue ChunkedTileMap::getTile(uint32_t _x, uint32_t _y) const
+    {
+        if (_x >= m_width || _y >= m_height)
+            return m_emptyValue;
+
+        uint8_t encoding{};
+        size_t size{};
+        const uint8_t* data = findChunk(_x / m_chunkSize, _y / m_chunkSize, encoding, size);
+        if (data == nullptr)
+            return m_emptyValue;
+
+        const size_t cell = static_cast<size_t>(_y % m_chunkSize) * m_chunkSize + _x % m_chunkSize;
+        std::vector<TileValue> cells(cell + 1);
+        return decodeChunk(data, size, encoding, cells.data(), cell) ? cells[cell] : m_emptyValue;
+    }
+}
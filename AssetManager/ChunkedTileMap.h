@@ -0,0 +1,180 @@
+/******************************************************************************/
+/*!
+\file		ChunkedTileMap.h
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the declarations for the ChunkedTileMap class,
+            the .soltiles chunked form of the Json/map.txt tile grid
+
+            The grid is cut into square chunks. Only chunks holding a cell
+            other than the empty value are stored, each run length encoded
+            or bit packed, whichever is smaller, and a directory sorted by
+            chunk index finds any chunk without touching the others. Opening
+            maps the file and checks the directory, nothing is decoded until
+            a chunk is read, so an empty 1000x1000 map is a 32 byte header.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#ifndef _CHUNKEDTILEMAP_H_
+#define _CHUNKEDTILEMAP_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <SOL/AssetManager/MappedFile.h>
+
+namespace SOL
+{
+    class ChunkedTileMap
+    {
+    public:
+
+        using TileValue = uint32_t;
+
+        static const uint16_t s_TileMapVersion = 1;
+        static const uint32_t s_DefaultChunkSize = 32; //cells per chunk side
+
+        /*!**************************************************************************
+        @brief Get the .soltiles path for a text map path.
+
+        @param _textPath The text map, such as Json/map.txt.
+        @return The same path with a .soltiles extension.
+        *****************************************************************************/
+        static std::string getChunkedPath(const std::string& _textPath);
+
+        /*!**************************************************************************
+        @brief Encode a grid.
+
+        @param _cells The cells in row-major order, _width * _height of them.
+        @param _width The grid width.
+        @param _height The grid height.
+        @param _bytes Receives the file contents.
+        @param _chunkSize The cells per chunk side.
+        @param _emptyValue The value of cells in chunks that are not stored.
+        @return False if the cell count does not match the size.
+        *****************************************************************************/
+        static bool encode(const std::vector<TileValue>& _cells, uint32_t _width, uint32_t _height, std::vector<uint8_t>& _bytes,
+                           uint32_t _chunkSize = s_DefaultChunkSize, TileValue _emptyValue = 0);
+
+        /*!**************************************************************************
+        @brief Convert a text map of whitespace separated values, one row per line.
+
+        The text is read one band of chunk rows at a time, so maps far larger than
+        memory allows as a whole can be converted.
+
+        @param _textPath The text map, resolved through the VirtualFileSystem mounts.
+        @param _outputPath The .soltiles file to write.
+        @param _chunkSize The cells per chunk side.
+        @return True if the file was written.
+        *****************************************************************************/
+        static bool convertTextMap(const std::string& _textPath, const std::string& _outputPath,
+                                   uint32_t _chunkSize = s_DefaultChunkSize);
+
+        /*!**************************************************************************
+        @brief Map a .soltiles file and check its directory.
+
+        @param _filepath The file, resolved through the VirtualFileSystem mounts.
+        @return True if the file is a valid tile map.
+        *****************************************************************************/
+        bool open(const std::string& _filepath);
+
+        /*!**************************************************************************
+        @brief Take ownership of a tile map in memory.
+
+        @param _bytes The file contents.
+        @return True if the contents are a valid tile map.
+        *****************************************************************************/
+        bool load(std::vector<uint8_t>&& _bytes);
+
+        /*!**************************************************************************
+        @brief Release the file.
+        *****************************************************************************/
+        void close();
+
+        /*!**************************************************************************
+        @brief Get the size of the grid in cells and in chunks.
+        *****************************************************************************/
+        uint32_t getWidth() const { return m_width; }
+        uint32_t getHeight() const { return m_height; }
+        uint32_t getChunkSize() const { return m_chunkSize; }
+        uint32_t getChunksX() const { return m_chunksX; }
+        uint32_t getChunksY() const { return m_chunksY; }
+
+        /*!**************************************************************************
+        @brief Get the value of cells in chunks that are not stored.
+        *****************************************************************************/
+        TileValue getEmptyValue() const { return m_emptyValue; }
+
+        /*!**************************************************************************
+        @brief Get the number of chunks stored in the file.
+        *****************************************************************************/
+        size_t getStoredChunkCount() const { return m_chunkCount; }
+
+        /*!**************************************************************************
+        @brief Check if a chunk is stored, chunks that are not hold only the empty value.
+
+        @param _chunkX The chunk column.
+        @param _chunkY The chunk row.
+        @return True if the chunk is stored.
+        *****************************************************************************/
+        bool hasChunk(uint32_t _chunkX, uint32_t _chunkY) const;
+
+        /*!**************************************************************************
+        @brief Decode one chunk. Safe to call from several threads at once.
+
+        @param _chunkX The chunk column.
+        @param _chunkY The chunk row.
+        @param _cells Receives getChunkSize() squared cells in row-major order,
+                      cells past the edge of the grid hold the empty value.
+        @return False if the chunk is outside the grid or corrupt.
+        *****************************************************************************/
+        bool readChunk(uint32_t _chunkX, uint32_t _chunkY, std::vector<TileValue>& _cells) const;
+
+        /*!**************************************************************************
+        @brief Get a single cell, decoding only as much of its chunk as needed.
+
+        @param _x The cell column.
+        @param _y The cell row.
+        @return The cell value, the empty value outside the grid.
+        *****************************************************************************/
+        TileValue getTile(uint32_t _x, uint32_t _y) const;
+
+    private:
+
+        /*!**************************************************************************
+        @brief Check the header and directory of the contents in m_file.
+
+        @return True if the contents are a valid tile map.
+        *****************************************************************************/
+        bool readHeader();
+
+        /*!**************************************************************************
+        @brief Find the stored bytes of a chunk.
+
+        @param _chunkX The chunk column.
+        @param _chunkY The chunk row.
+        @param _encoding Receives how the chunk is stored.
+        @param _size Receives the size of the bytes.
+        @return The bytes, nullptr if the chunk is not stored.
+        *****************************************************************************/
+        const uint8_t* findChunk(uint32_t _chunkX, uint32_t _chunkY, uint8_t& _encoding, size_t& _size) const;
+
+        MappedFile m_file;
+        const uint8_t* m_directory{};
+        const uint8_t* m_chunkData{};
+        size_t m_chunkDataSize{};
+        size_t m_chunkCount{};
+        uint32_t m_width{};
+        uint32_t m_height{};
+        uint32_t m_chunkSize{};
+        uint32_t m_chunksX{};
+        uint32_t m_chunksY{};
+        TileValue m_emptyValue{};
+    };
+}
+
+#endif  //_CHUNKEDTILEMAP_H_
@@ -0,0 +1,90 @@
+/******************************************************************************/
+/*!
+\file		ContentHash.cpp
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of function definitions for hashing asset
+            contents, used to key the on-disk caches of the AssetManager
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#include "SOLpch.h"
+#include "SOL/AssetManager/ContentHash.h"
+
+namespace SOL
+{
+    /*!**************************************************************************
+    @brief Hash a block of memory with 64 bit FNV-1a.
+
+    @param _data The bytes to hash.
+    @param _size The number of bytes.
+    @param _seed The hash to continue from, lets several blocks be hashed as one.
+    @return The hash of the bytes.
+    *****************************************************************************/
+    ContentHash hashBytes(const void* _data, size_t _size, ContentHash _seed)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(_data);
+        ContentHash hash = _seed;
+        for (size_t i = 0; i < _size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /*!**************************************************************************
+    @brief Read a whole file into memory.
+
+    @param _filepath The file to read.
+    @param _bytes Receives the file contents.
+    @return True if the file was read.
+    *****************************************************************************/
+    bool readFileBytes(const std::string& _filepath, std::vector<uint8_t>& _bytes)
+    {
+        std::ifstream file(_filepath, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+            return false;
+
+        std::streamsize size = file.tellg();
+        file.seekg(0, std::ios::beg);
+        _bytes.resize(static_cast<size_t>(size));
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(_bytes.data()), size));
+    }
+
+    /*!**************************************************************************
+    @brief Hash the contents of a file.
+
+    @param _filepath The file to hash.
+    @return The hash of the file contents, 0 if the file could not be read.
+    *****************************************************************************/
+    ContentHash hashFile(const std::string& _filepath)
+    {
+        std::vector<uint8_t> bytes;
+        if (!readFileBytes(_filepath, bytes))
+            return 0;
+        return hashBytes(bytes.data(), bytes.size());
+    }
+
+    /*!**************************************************************************
+    @brief Convert a hash to a 16 character hexadecimal string.
+
+    @param _hash The hash to convert.
+    @return The hash in hexadecimal, used as a cache file name.
+    *****************************************************************************/
+    std::string hashToString(ContentHash _hash)
+    {
+        static const char s_Digits[] = "0123456789abcdef";
+        std::string text(16, '0');
+        for (int i = 15; i >= 0; --i)
+        {
+            text[i] = s_Digits[_hash & 0xF];
+            _hash >>= 4;
+        }
+        return text;
+    }
+}
@@ -0,0 +1,61 @@
+/******************************************************************************/
+/*!
+\file		ContentHash.h
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of function declarations for hashing asset
+            contents, used to key the on-disk caches of the AssetManager
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#ifndef _CONTENTHASH_H_
+#define _CONTENTHASH_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace SOL
+{
+    using ContentHash = uint64_t;
+
+    /*!**************************************************************************
+    @brief Hash a block of memory with 64 bit FNV-1a.
+
+    @param _data The bytes to hash.
+    @param _size The number of bytes.
+    @param _seed The hash to continue from, lets several blocks be hashed as one.
+    @return The hash of the bytes.
+    *****************************************************************************/
+    ContentHash hashBytes(const void* _data, size_t _size, ContentHash _seed = 14695981039346656037ull);
+
+    /*!**************************************************************************
+    @brief Read a whole file into memory.
+
+    @param _filepath The file to read.
+    @param _bytes Receives the file contents.
+    @return True if the file was read.
+    *****************************************************************************/
+    bool readFileBytes(const std::string& _filepath, std::vector<uint8_t>& _bytes);
+
+    /*!**************************************************************************
+    @brief Hash the contents of a file.
+
+    @param _filepath The file to hash.
+    @return The hash of the file contents, 0 if the file could not be read.
+    *****************************************************************************/
+    ContentHash hashFile(const std::string& _filepath);
+
+    /*!**************************************************************************
+    @brief Convert a hash to a 16 character hexadecimal string.
+
+    @param _hash The hash to convert.
+    @return The hash in hexadecimal, used as a cache file name.
+    *****************************************************************************/
+    std::string hashToString(ContentHash _hash);
+}
+#endif // _CONTENTHASH_H_
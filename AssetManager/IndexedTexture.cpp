@@ -0,0 +1,335 @@
+/******************************************************************************/
+/*!
+\file		IndexedTexture.cpp
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of definitions for palette-indexed textures and
+            the shared palette bank used by the AssetManager
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#include "SOLpch.h"
+#include "SOL/AssetManager/IndexedTexture.h"
+#include "SOL/AssetManager/ContentHash.h"
+
+namespace SOL
+{
+    namespace
+    {
+        const char s_IndexedMagic[4] = { 'S', 'I', 'D', 'X' };
+        const uint16_t s_IndexedVersion = 1;
+
+        #pragma pack(push, 1)
+        struct IndexedHeader
+        {
+            char m_Magic[4];
+            uint16_t m_Version;
+            uint8_t m_BitsPerIndex;
+            uint8_t m_Reserved;
+            uint32_t m_Width;
+            uint32_t m_Height;
+            uint32_t m_PaletteSize;
+        };
+        #pragma pack(pop)
+
+        /*!**************************************************************************
+        @brief Hash a palette with 64 bit FNV-1a.
+
+        @param _palette The palette to hash.
+        @return The hash of the palette colours.
+        *****************************************************************************/
+        uint64_t hashPalette(const Palette& _palette)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (uint32_t colour : _palette)
+            {
+                for (int byte = 0; byte < 4; ++byte)
+                {
+                    hash ^= (colour >> (byte * 8)) & 0xFF;
+                    hash *= 1099511628211ull;
+                }
+            }
+            return hash;
+        }
+
+        /*!**************************************************************************
+        @brief Get the number of bytes needed to store the indices of a texture.
+        *****************************************************************************/
+        size_t indexBytes(int _width, int _height, uint8_t _bits)
+        {
+            return (static_cast<size_t>(_width) * _height * _bits + 7) / 8;
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Add a palette to the bank.
+
+    Palettes with identical content are shared, so textures drawn from the same
+    colour set end up pointing at the same palette ID.
+
+    @param _palette The palette to add.
+    @return The ID of the stored palette.
+    *****************************************************************************/
+    uint32_t PaletteBank::addPalette(const Palette& _palette)
+    {
+        uint64_t hash = hashPalette(_palette);
+        auto range = m_lookup.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (m_palettes[it->second] == _palette)
+                return it->second;
+        }
+
+        uint32_t paletteID = static_cast<uint32_t>(m_palettes.size());
+        m_palettes.push_back(_palette);
+        m_lookup.emplace(hash, paletteID);
+        return paletteID;
+    }
+
+    /*!**************************************************************************
+    @brief Add a palette that is never shared with other textures.
+
+    @param _palette The palette to add.
+    @return The ID of the stored palette.
+    *****************************************************************************/
+    uint32_t PaletteBank::addPrivatePalette(const Palette& _palette)
+    {
+        uint32_t paletteID = static_cast<uint32_t>(m_palettes.size());
+        m_palettes.push_back(_palette);
+        return paletteID;
+    }
+
+    /*!**************************************************************************
+    @brief Replace the colours of a palette.
+
+    Every texture sharing the palette picks up the new colours on its next
+    expansion, which is how palette-swap effects are done. The palette is taken
+    out of the lookup so later imports do not attach to the swapped colours.
+
+    @param _paletteID The ID of the palette to modify.
+    @param _palette The new colours, must not exceed the old palette size.
+    *****************************************************************************/
+    void PaletteBank::setPalette(uint32_t _paletteID, const Palette& _palette)
+    {
+        Palette& current = m_palettes.at(_paletteID);
+        if (_palette.size() > current.size())
+        {
+            ANALYTICS_ERROR("Palette swap has more colours than the original palette.");
+            return;
+        }
+
+        auto range = m_lookup.equal_range(hashPalette(current));
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == _paletteID)
+            {
+                m_lookup.erase(it);
+                break;
+            }
+        }
+
+        std::copy(_palette.begin(), _palette.end(), current.begin());
+    }
+
+    /*!**************************************************************************
+    @brief Build an indexed texture from RGBA8 pixels.
+
+    Counts the unique colours in the image. Images with 16 colours or less are
+    stored as 4 bit indices, images with 256 colours or less as 8 bit indices.
+
+    @param _rgba The RGBA8 pixels.
+    @param _width The image width.
+    @param _height The image height.
+    @param _palette Receives the colours used by the image.
+    @param _out Receives the indices, m_PaletteID is left untouched.
+    @return False if the image uses more than 256 colours.
+    *****************************************************************************/
+    bool buildIndexedTexture(const uint8_t* _rgba, int _width, int _height, Palette& _palette, IndexedTexture& _out)
+    {
+        const size_t texelCount = static_cast<size_t>(_width) * _height;
+        std::unordered_map<uint32_t, uint8_t> colourToIndex;
+        std::vector<uint8_t> indices(texelCount);
+
+        _palette.clear();
+        for (size_t texel = 0; texel < texelCount; ++texel)
+        {
+            uint32_t colour{};
+            std::memcpy(&colour, _rgba + texel * 4, sizeof(colour));
+
+            auto it = colourToIndex.find(colour);
+            if (it == colourToIndex.end())
+            {
+                if (_palette.size() == 256)
+                    return false;
+
+                it = colourToIndex.emplace(colour, static_cast<uint8_t>(_palette.size())).first;
+                _palette.push_back(colour);
+            }
+            indices[texel] = it->second;
+        }
+
+        _out.m_Width = _width;
+        _out.m_Height = _height;
+        _out.m_BitsPerIndex = _palette.size() <= 16 ? 4 : 8;
+
+        if (_out.m_BitsPerIndex == 8)
+        {
+            _out.m_Indices = std::move(indices);
+            return true;
+        }
+
+        _out.m_Indices.assign(indexBytes(_width, _height, 4), 0);
+        for (size_t texel = 0; texel < texelCount; ++texel)
+        {
+            _out.m_Indices[texel >> 1] |= static_cast<uint8_t>(indices[texel] << ((texel & 1) * 4));
+        }
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Expand an indexed texture back to RGBA8 pixels.
+
+    @param _texture The indexed texture.
+    @param _palette The palette to expand with.
+    @param _rgba Receives width * height * 4 bytes.
+    *****************************************************************************/
+    void expandIndexedTexture(const IndexedTexture& _texture, const Palette& _palette, std::vector<uint8_t>& _rgba)
+    {
+        const size_t texelCount = static_cast<size_t>(_texture.m_Width) * _texture.m_Height;
+        _rgba.resize(texelCount * 4);
+
+        for (size_t texel = 0; texel < texelCount; ++texel)
+        {
+            uint8_t index = _texture.getIndex(texel);
+            uint32_t colour = index < _palette.size() ? _palette[index] : 0;
+            std::memcpy(_rgba.data() + texel * 4, &colour, sizeof(colour));
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Write an indexed texture and its palette to a .sidx file.
+
+    A texture that could not be indexed is written as a header with zero bits per
+    index, so the importer does not have to decode the image again next run.
+
+    @param _filepath The file to write.
+    @param _texture The indexed texture.
+    @param _palette The palette used by the texture.
+    @return True if the file was written.
+    *****************************************************************************/
+    bool writeIndexedTexture(const std::string& _filepath, const IndexedTexture& _texture, const Palette& _palette)
+    {
+        std::ofstream file(_filepath, std::ios::binary);
+        if (!file.is_open())
+        {
+            ANALYTICS_ERROR("Failed to open " + _filepath + " for writing.");
+            return false;
+        }
+
+        std::vector<uint8_t> bytes;
+        encodeIndexedTexture(_texture, _palette, bytes);
+        file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        return file.good();
+    }
+
+    /*!**************************************************************************
+    @brief Read an indexed texture and its palette from a .sidx file.
+
+    @param _filepath The file to read.
+    @param _texture Receives the indexed texture.
+    @param _palette Receives the palette.
+    @return True if the file was read and is valid.
+    *****************************************************************************/
+    bool readIndexedTexture(const std::string& _filepath, IndexedTexture& _texture, Palette& _palette)
+    {
+        std::vector<uint8_t> bytes;
+        if (!readFileBytes(_filepath, bytes))
+            return false;
+
+        return decodeIndexedTexture(bytes.data(), bytes.size(), _texture, _palette);
+    }
+
+    /*!**************************************************************************
+    @brief Encode an indexed texture and its palette in the .sidx layout.
+
+    @param _texture The indexed texture.
+    @param _palette The palette used by the texture.
+    @param _bytes Receives the encoded texture.
+    *****************************************************************************/
+    void encodeIndexedTexture(const IndexedTexture& _texture, const Palette& _palette, std::vector<uint8_t>& _bytes)
+    {
+        IndexedHeader header{};
+        std::memcpy(header.m_Magic, s_IndexedMagic, sizeof(s_IndexedMagic));
+        header.m_Version = s_IndexedVersion;
+        header.m_BitsPerIndex = _texture.m_BitsPerIndex;
+        header.m_Width = static_cast<uint32_t>(_texture.m_Width);
+        header.m_Height = static_cast<uint32_t>(_texture.m_Height);
+        header.m_PaletteSize = _texture.isIndexed() ? static_cast<uint32_t>(_palette.size()) : 0;
+
+        const size_t paletteBytes = header.m_PaletteSize * sizeof(uint32_t);
+        const size_t indexCount = _texture.isIndexed() ? indexBytes(_texture.m_Width, _texture.m_Height, _texture.m_BitsPerIndex) : 0;
+        _bytes.resize(sizeof(header) + paletteBytes + indexCount);
+
+        std::memcpy(_bytes.data(), &header, sizeof(header));
+        if (_texture.isIndexed())
+        {
+            std::memcpy(_bytes.data() + sizeof(header), _palette.data(), paletteBytes);
+            std::memcpy(_bytes.data() + sizeof(header) + paletteBytes, _texture.getIndexData(), indexCount);
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Decode an indexed texture and its palette from the .sidx layout.
+
+    @param _data The encoded texture.
+    @param _size The number of bytes.
+    @param _texture Receives the indexed texture.
+    @param _palette Receives the palette.
+    @param _borrowIndices Point m_SharedIndices into _data instead of copying, the
+                          caller keeps _data alive for as long as the texture.
+    @return True if the data is valid.
+    *****************************************************************************/
+    bool decodeIndexedTexture(const uint8_t* _data, size_t _size, IndexedTexture& _texture, Palette& _palette, bool _borrowIndices)
+    {
+        IndexedHeader header{};
+        if (_size < sizeof(header))
+            return false;
+
+        std::memcpy(&header, _data, sizeof(header));
+        if (std::memcmp(header.m_Magic, s_IndexedMagic, sizeof(s_IndexedMagic)) != 0 ||
+            header.m_Version != s_IndexedVersion ||
+            (header.m_BitsPerIndex != 0 && header.m_BitsPerIndex != 4 && header.m_BitsPerIndex != 8) ||
+            header.m_PaletteSize > 256)
+        {
+            return false;
+        }
+
+        _texture.m_Width = static_cast<int>(header.m_Width);
+        _texture.m_Height = static_cast<int>(header.m_Height);
+        _texture.m_BitsPerIndex = header.m_BitsPerIndex;
+        _texture.m_Indices.clear();
+        _texture.m_SharedIndices = nullptr;
+        _palette.clear();
+
+        if (!_texture.isIndexed())
+            return true;
+
+        const size_t paletteBytes = header.m_PaletteSize * sizeof(uint32_t);
+        const size_t indexCount = indexBytes(_texture.m_Width, _texture.m_Height, _texture.m_BitsPerIndex);
+        if (_size < sizeof(header) + paletteBytes + indexCount)
+            return false;
+
+        const uint8_t* indices = _data + sizeof(header) + paletteBytes;
+        _palette.resize(header.m_PaletteSize);
+        std::memcpy(_palette.data(), _data + sizeof(header), paletteBytes);
+        if (_borrowIndices)
+            _texture.m_SharedIndices = indices;
+        else
+            _texture.m_Indices.assign(indices, indices + indexCount);
+        return true;
+    }
+}
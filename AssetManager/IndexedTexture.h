@@ -0,0 +1,195 @@
+/******************************************************************************/
+/*!
+\file		IndexedTexture.h
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of declarations for palette-indexed textures and
+            the shared palette bank used by the AssetManager
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#ifndef _INDEXEDTEXTURE_H_
+#define _INDEXEDTEXTURE_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace SOL
+{
+    using Palette = std::vector<uint32_t>; //packed RGBA8, one entry per colour
+
+    struct IndexedTexture
+    {
+        int m_Width{};
+        int m_Height{};
+        uint8_t m_BitsPerIndex{};       //4 or 8, 0 if the image has too many colours
+        uint32_t m_PaletteID{};         //index into the PaletteBank
+        std::vector<uint8_t> m_Indices; //row-major, 4 bpp packs two texels per byte (low nibble first)
+        const uint8_t* m_SharedIndices{}; //set instead of m_Indices when the data lives in the SharedAssetCache
+
+        /*!**************************************************************************
+        @brief Get the index data, wherever it is stored.
+
+        @return A pointer to the packed indices.
+        *****************************************************************************/
+        const uint8_t* getIndexData() const { return m_SharedIndices ? m_SharedIndices : m_Indices.data(); }
+
+        /*!**************************************************************************
+        @brief Check if the texture holds indexed data.
+
+        @return True if the texture was stored as 4 or 8 bit indices.
+        *****************************************************************************/
+        bool isIndexed() const { return m_BitsPerIndex != 0; }
+
+        /*!**************************************************************************
+        @brief Get the palette index of a texel.
+
+        @param _texel The linear texel position (y * width + x).
+        @return The palette index stored for that texel.
+        *****************************************************************************/
+        uint8_t getIndex(size_t _texel) const
+        {
+            const uint8_t* indices = getIndexData();
+            if (m_BitsPerIndex == 8)
+                return indices[_texel];
+            return (indices[_texel >> 1] >> ((_texel & 1) * 4)) & 0x0F;
+        }
+    };
+
+    class PaletteBank
+    {
+    public:
+
+        /*!**************************************************************************
+        @brief Add a palette to the bank.
+
+        Palettes with identical content are shared, so textures drawn from the same
+        colour set end up pointing at the same palette ID.
+
+        @param _palette The palette to add.
+        @return The ID of the stored palette.
+        *****************************************************************************/
+        uint32_t addPalette(const Palette& _palette);
+
+        /*!**************************************************************************
+        @brief Add a palette that is never shared with other textures.
+
+        Used to give a texture its own copy before its colours are changed.
+
+        @param _palette The palette to add.
+        @return The ID of the stored palette.
+        *****************************************************************************/
+        uint32_t addPrivatePalette(const Palette& _palette);
+
+        /*!**************************************************************************
+        @brief Get a palette by ID.
+
+        @param _paletteID The ID returned by addPalette.
+        @return A reference to the palette.
+        *****************************************************************************/
+        Palette& getPalette(uint32_t _paletteID) { return m_palettes.at(_paletteID); }
+
+        /*!**************************************************************************
+        @brief Replace the colours of a palette.
+
+        Every texture sharing the palette picks up the new colours on its next
+        expansion, which is how palette-swap effects are done. Use
+        AssetManager::setTexturePalette to change a single texture. The palette is
+        no longer handed out by addPalette once it has been swapped.
+
+        @param _paletteID The ID of the palette to modify.
+        @param _palette The new colours, must not exceed the old palette size.
+        *****************************************************************************/
+        void setPalette(uint32_t _paletteID, const Palette& _palette);
+
+        /*!**************************************************************************
+        @brief Get the number of palettes in the bank.
+
+        @return The palette count.
+        *****************************************************************************/
+        size_t size() const { return m_palettes.size(); }
+
+        /*!**************************************************************************
+        @brief Remove every palette from the bank.
+        *****************************************************************************/
+        void clear() { m_palettes.clear(); m_lookup.clear(); }
+
+    private:
+
+        std::vector<Palette> m_palettes;
+        std::unordered_multimap<uint64_t, uint32_t> m_lookup; //palette hash:palette ID
+    };
+
+    /*!**************************************************************************
+    @brief Build an indexed texture from RGBA8 pixels.
+
+    Counts the unique colours in the image. Images with 16 colours or less are
+    stored as 4 bit indices, images with 256 colours or less as 8 bit indices.
+
+    @param _rgba The RGBA8 pixels.
+    @param _width The image width.
+    @param _height The image height.
+    @param _palette Receives the colours used by the image.
+    @param _out Receives the indices, m_PaletteID is left untouched.
+    @return False if the image uses more than 256 colours.
+    *****************************************************************************/
+    bool buildIndexedTexture(const uint8_t* _rgba, int _width, int _height, Palette& _palette, IndexedTexture& _out);
+
+    /*!**************************************************************************
+    @brief Expand an indexed texture back to RGBA8 pixels.
+
+    @param _texture The indexed texture.
+    @param _palette The palette to expand with.
+    @param _rgba Receives width * height * 4 bytes.
+    *****************************************************************************/
+    void expandIndexedTexture(const IndexedTexture& _texture, const Palette& _palette, std::vector<uint8_t>& _rgba);
+
+    /*!**************************************************************************
+    @brief Write an indexed texture and its palette to a .sidx file.
+
+    @param _filepath The file to write.
+    @param _texture The indexed texture.
+    @param _palette The palette used by the texture.
+    @return True if the file was written.
+    *****************************************************************************/
+    bool writeIndexedTexture(const std::string& _filepath, const IndexedTexture& _texture, const Palette& _palette);
+
+    /*!**************************************************************************
+    @brief Read an indexed texture and its palette from a .sidx file.
+
+    @param _filepath The file to read.
+    @param _texture Receives the indexed texture.
+    @param _palette Receives the palette.
+    @return True if the file was read and is valid.
+    *****************************************************************************/
+    bool readIndexedTexture(const std::string& _filepath, IndexedTexture& _texture, Palette& _palette);
+
+    /*!**************************************************************************
+    @brief Encode an indexed texture and its palette in the .sidx layout.
+
+    @param _texture The indexed texture.
+    @param _palette The palette used by the texture.
+    @param _bytes Receives the encoded texture.
+    *****************************************************************************/
+    void encodeIndexedTexture(const IndexedTexture& _texture, const Palette& _palette, std::vector<uint8_t>& _bytes);
+
+    /*!**************************************************************************
+    @brief Decode an indexed texture and its palette from the .sidx layout.
+
+    @param _data The encoded texture.
+    @param _size The number of bytes.
+    @param _texture Receives the indexed texture.
+    @param _palette Receives the palette.
+    @param _borrowIndices Point m_SharedIndices into _data instead of copying, the
+                          caller keeps _data alive for as long as the texture.
+    @return True if the data is valid.
+    *****************************************************************************/
+    bool decodeIndexedTexture(const uint8_t* _data, size_t _size, IndexedTexture& _texture, Palette& _palette, bool _borrowIndices = false);
+}
+#endif // _INDEXEDTEXTURE_H_
@@ -0,0 +1,216 @@
+/******************************************************************************/
+/*!
+\file		MappedFile.cpp
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the definitions for the MappedFile class,
+            a private copy on write mapping of a file that parsers may modify
+            in place without touching the file on disk
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#include "SOLpch.h"
+#include "SOL/AssetManager/MappedFile.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace SOL
+{
+    /*!**************************************************************************
+    @brief Move constructor for the MappedFile class.
+    *****************************************************************************/
+    MappedFile::MappedFile(MappedFile&& _other) noexcept
+    {
+        *this = std::move(_other);
+    }
+
+    /*!**************************************************************************
+    @brief Move assignment for the MappedFile class, unmaps the current file.
+    *****************************************************************************/
+    MappedFile& MappedFile::operator=(MappedFile&& _other) noexcept
+    {
+        if (this != &_other)
+        {
+            close();
+            m_heap = std::move(_other.m_heap);
+            m_data = _other.m_view ? _other.m_data : m_heap.data();
+            m_size = _other.m_size;
+            m_view = _other.m_view;
+            m_mappedSize = _other.m_mappedSize;
+            m_mapping = _other.m_mapping;
+
+            _other.m_data = nullptr;
+            _other.m_size = 0;
+            _other.m_view = nullptr;
+            _other.m_mappedSize = 0;
+            _other.m_mapping = nullptr;
+        }
+        return *this;
+    }
+
+    /*!**************************************************************************
+    @brief Map a file on disk.
+
+    Writes go to private pages and are never written back. The contents are
+    always followed by a readable '\0': the zero fill after the end of the
+    file in its last page, or a heap copy when the file ends exactly on a
+    page boundary.
+
+    @param _filepath The file on disk.
+    @return True if the file is mapped.
+    *****************************************************************************/
+    bool MappedFile::open(const std::string& _filepath)
+    {
+        close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(_filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            return false;
+        }
+        const size_t size = static_cast<size_t>(fileSize.QuadPart);
+
+        SYSTEM_INFO system{};
+        GetSystemInfo(&system);
+        const size_t pageSize = system.dwPageSize;
+
+        if (size != 0 && size % pageSize != 0)
+        {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0) : nullptr;
+            if (view)
+            {
+                CloseHandle(file);
+                m_mapping = mapping;
+                m_view = view;
+                m_mappedSize = size;
+                m_data = static_cast<char*>(view);
+                m_size = size;
+                return true;
+            }
+            if (mapping)
+                CloseHandle(mapping);
+        }
+
+        // Empty files and files with no slack in their last page are read instead
+        m_heap.resize(size + 1);
+        DWORD read = 0;
+        size_t offset = 0;
+        while (offset < size && ReadFile(file, m_heap.data() + offset,
+            static_cast<DWORD>(std::min<size_t>(size - offset, 1u << 30)), &read, nullptr) && read != 0)
+        {
+            offset += read;
+        }
+        CloseHandle(file);
+#else
+        const int fd = ::open(_filepath.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+
+        struct stat info {};
+        if (fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        const size_t size = static_cast<size_t>(info.st_size);
+        const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+        if (size != 0 && size % pageSize != 0)
+        {
+            void* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (view != MAP_FAILED)
+            {
+                ::close(fd);
+                m_view = view;
+                m_mappedSize = size;
+                m_data = static_cast<char*>(view);
+                m_size = size;
+                return true;
+            }
+        }
+
+        // Empty files and files with no slack in their last page are read instead
+        m_heap.resize(size + 1);
+        size_t offset = 0;
+        while (offset < size)
+        {
+            const ssize_t read = ::read(fd, m_heap.data() + offset, size - offset);
+            if (read <= 0)
+                break;
+            offset += static_cast<size_t>(read);
+        }
+        ::close(fd);
+#endif
+
+        if (offset != size)
+        {
+            m_heap.clear();
+            return false;
+        }
+        m_heap[size] = '\0';
+        m_data = m_heap.data();
+        m_size = size;
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Take ownership of contents that are not on disk, such as pack entries.
+
+    @param _bytes The contents.
+    *****************************************************************************/
+    void MappedFile::adopt(std::vector<uint8_t>&& _bytes)
+    {
+        close();
+        m_heap.assign(_bytes.begin(), _bytes.end());
+        m_heap.push_back('\0');
+        _bytes.clear();
+        m_data = m_heap.data();
+        m_size = m_heap.size() - 1;
+    }
+
+    /*!**************************************************************************
+    @brief Unmap the file.
+    *****************************************************************************/
+    void MappedFile::close()
+    {
+        if (m_view)
+        {
+#ifdef _WIN32
+            UnmapViewOfFile(m_view);
+            CloseHandle(static_cast<HANDLE>(m_mapping));
+#else
+            munmap(m_view, m_mappedSize);
+#endif
+        }
+
+        m_heap.clear();
+        m_heap.shrink_to_fit();
+        m_data = nullptr;
+        m_size = 0;
+        m_view = nullptr;
+        m_mappedSize = 0;
+        m_mapping = nullptr;
+    }
+}
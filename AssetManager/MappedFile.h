@@ -0,0 +1,91 @@
+/******************************************************************************/
+/*!
+\file		MappedFile.h
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the declarations for the MappedFile class,
+            a private copy on write mapping of a file that parsers may modify
+            in place without touching the file on disk
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#ifndef _MAPPEDFILE_H_
+#define _MAPPEDFILE_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace SOL
+{
+    class MappedFile
+    {
+    public:
+
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& _other) noexcept;
+        MappedFile& operator=(MappedFile&& _other) noexcept;
+
+        /*!**************************************************************************
+        @brief Destructor for the MappedFile class, unmaps the file.
+        *****************************************************************************/
+        ~MappedFile() { close(); }
+
+        /*!**************************************************************************
+        @brief Map a file on disk.
+
+        Writes go to private pages and are never written back. The contents are
+        always followed by a readable '\0': the zero fill after the end of the
+        file in its last page, or a heap copy when the file ends exactly on a
+        page boundary.
+
+        @param _filepath The file on disk.
+        @return True if the file is mapped.
+        *****************************************************************************/
+        bool open(const std::string& _filepath);
+
+        /*!**************************************************************************
+        @brief Take ownership of contents that are not on disk, such as pack entries.
+
+        @param _bytes The contents.
+        *****************************************************************************/
+        void adopt(std::vector<uint8_t>&& _bytes);
+
+        /*!**************************************************************************
+        @brief Unmap the file.
+        *****************************************************************************/
+        void close();
+
+        /*!**************************************************************************
+        @brief Get the contents, writable and terminated by '\0'.
+        *****************************************************************************/
+        char* data() { return m_data; }
+        const char* data() const { return m_data; }
+
+        /*!**************************************************************************
+        @brief Get the size of the contents, excluding the terminator.
+        *****************************************************************************/
+        size_t size() const { return m_size; }
+
+        /*!**************************************************************************
+        @brief Check if the contents are mapped rather than copied to the heap.
+        *****************************************************************************/
+        bool isMapped() const { return m_view != nullptr; }
+
+    private:
+        char* m_data{};
+        size_t m_size{};
+        void* m_view{};                 //start of the mapping, nullptr for heap contents
+        size_t m_mappedSize{};
+        void* m_mapping{};              //file mapping handle on Windows
+        std::vector<char> m_heap;       //contents when they are not mapped
+    };
+}
+
+#endif  //_MAPPEDFILE_H_
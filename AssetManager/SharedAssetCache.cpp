@@ -0,0 +1,514 @@
+/******************************************************************************/
+/*!
+\file		SharedAssetCache.cpp
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the definitions for the SharedAssetCache
+            class, a named shared memory region that lets SOLEditor and Sandbox
+            running side by side reuse each other's decoded asset payloads
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#include "SOLpch.h"
+#include "SOL/AssetManager/SharedAssetCache.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <cerrno>
+#endif
+
+namespace SOL
+{
+    namespace
+    {
+        const char s_SharedMagic[4] = { 'S', 'S', 'A', 'C' };
+        const uint32_t s_SharedVersion = 2;
+        const size_t s_BlockAlignment = 64;
+
+        /*!**************************************************************************
+        @brief Get the id of this process.
+
+        @return The process id.
+        *****************************************************************************/
+        uint32_t currentProcessID()
+        {
+#ifdef _WIN32
+            return static_cast<uint32_t>(GetCurrentProcessId());
+#else
+            return static_cast<uint32_t>(getpid());
+#endif
+        }
+
+        /*!**************************************************************************
+        @brief Check if a process is still running.
+
+        @param _pid The process id.
+        @return True if the process exists, or may exist but cannot be queried.
+        *****************************************************************************/
+        bool isProcessAlive(uint32_t _pid)
+        {
+#ifdef _WIN32
+            HANDLE process = OpenProcess(SYNCHRONIZE, FALSE, static_cast<DWORD>(_pid));
+            if (!process)
+                return GetLastError() == ERROR_ACCESS_DENIED;
+
+            const bool alive = WaitForSingleObject(process, 0) == WAIT_TIMEOUT;
+            CloseHandle(process);
+            return alive;
+#else
+            return kill(static_cast<pid_t>(_pid), 0) == 0 || errno == EPERM;
+#endif
+        }
+    }
+
+    //Lives at the start of the region, every process sees the same bytes
+    struct SharedAssetCache::Header
+    {
+        char m_Magic[4];
+        uint32_t m_Version;
+        std::atomic<uint32_t> m_Ready;    //set by the creator once the header is filled in
+        uint32_t m_EntryCount;
+        uint64_t m_Capacity;              //payload bytes after the directory
+        uint64_t m_DataUsed;
+        uint32_t m_Processes[s_ProcessSlots]; //id of the process in each slot, 0 if free
+#ifndef _WIN32
+        pthread_mutex_t m_Mutex;          //robust and process shared, the owner dying releases it
+#endif
+    };
+
+    struct SharedAssetCache::Entry
+    {
+        ContentHash m_Key;
+        uint64_t m_Offset;                //from the start of the payload area
+        uint64_t m_Size;                  //0 while the block is free or being written
+        uint64_t m_BlockSize;             //may be larger than m_Size once the block is reused
+        uint32_t m_RefCounts[s_ProcessSlots]; //references held by the process in each slot
+
+        /*!**************************************************************************
+        @brief Check if any process holds a reference to the payload.
+
+        @return True if the payload is referenced.
+        *****************************************************************************/
+        bool isReferenced() const
+        {
+            for (uint32_t count : m_RefCounts)
+            {
+                if (count)
+                    return true;
+            }
+            return false;
+        }
+    };
+
+    /*!**************************************************************************
+    @brief Create or attach to the shared region.
+
+    @param _name The name of the region, the same in every process.
+    @param _capacity The number of payload bytes, only used by the creator.
+    @param _replaceStale Replace a region nobody can use instead of failing.
+    @return True if the region is mapped.
+    *****************************************************************************/
+    bool SharedAssetCache::openRegion(const std::string& _name, size_t _capacity, bool _replaceStale)
+    {
+        if (isOpen())
+            return true;
+
+        const size_t mappedSize = sizeof(Header) + sizeof(Entry) * s_DirectorySize + _capacity;
+        bool created = false;
+        void* view = nullptr;
+
+#ifdef _WIN32
+        // Windows drops the mapping with its last handle, even after a crash, so it is never stale
+        (void)_replaceStale;
+        const std::string mappingName = "Local\\" + _name;
+        m_lock = CreateMutexA(nullptr, FALSE, (mappingName + ".lock").c_str());
+        if (!m_lock)
+        {
+            ANALYTICS_ERROR("Failed to create the lock of shared asset cache " + _name);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+            static_cast<DWORD>(static_cast<uint64_t>(mappedSize) >> 32), static_cast<DWORD>(mappedSize & 0xFFFFFFFF),
+            mappingName.c_str());
+        if (!mapping)
+        {
+            CloseHandle(static_cast<HANDLE>(m_lock));
+            m_lock = nullptr;
+            ANALYTICS_ERROR("Failed to create shared asset cache " + _name);
+            return false;
+        }
+        created = GetLastError() != ERROR_ALREADY_EXISTS;
+
+        view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+        if (!view)
+        {
+            CloseHandle(mapping);
+            CloseHandle(static_cast<HANDLE>(m_lock));
+            m_lock = nullptr;
+            ANALYTICS_ERROR("Failed to map shared asset cache " + _name);
+            return false;
+        }
+
+        MEMORY_BASIC_INFORMATION info{};
+        VirtualQuery(view, &info, sizeof(info));
+        m_mappedSize = info.RegionSize;
+        m_mapping = mapping;
+#else
+        const std::string objectName = "/" + _name;
+        int fd = shm_open(objectName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        created = fd >= 0;
+        if (created)
+        {
+            if (ftruncate(fd, static_cast<off_t>(mappedSize)) != 0)
+            {
+                ::close(fd);
+                shm_unlink(objectName.c_str());
+                ANALYTICS_ERROR("Failed to size shared asset cache " + _name);
+                return false;
+            }
+        }
+        else
+        {
+            fd = shm_open(objectName.c_str(), O_RDWR, 0600);
+        }
+
+        struct stat info {};
+        if (fd < 0 || fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(Header))
+        {
+            if (fd >= 0)
+                ::close(fd);
+            ANALYTICS_ERROR("Failed to open shared asset cache " + _name);
+            return false;
+        }
+
+        m_mappedSize = static_cast<size_t>(info.st_size);
+        view = mmap(nullptr, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (view == MAP_FAILED)
+        {
+            ::close(fd);
+            ANALYTICS_ERROR("Failed to map shared asset cache " + _name);
+            return false;
+        }
+        m_fd = fd;
+#endif
+
+        m_name = _name;
+        m_header = static_cast<Header*>(view);
+        m_directory = reinterpret_cast<Entry*>(m_header + 1);
+        m_data = reinterpret_cast<uint8_t*>(m_directory + s_DirectorySize);
+
+        if (created)
+        {
+            // Fresh mappings are zero filled, only the fields that are not zero need setting
+            new (&m_header->m_Ready) std::atomic<uint32_t>(0);
+#ifndef _WIN32
+            pthread_mutexattr_t attributes;
+            pthread_mutexattr_init(&attributes);
+            pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+            pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+            pthread_mutex_init(&m_header->m_Mutex, &attributes);
+            pthread_mutexattr_destroy(&attributes);
+#endif
+            std::memcpy(m_header->m_Magic, s_SharedMagic, sizeof(s_SharedMagic));
+            m_header->m_Version = s_SharedVersion;
+            m_header->m_Capacity = _capacity;
+            m_header->m_Ready.store(1, std::memory_order_release);
+        }
+        else
+        {
+            // The creator may still be filling in the header
+            for (int attempt = 0; attempt < 1000 && m_header->m_Ready.load(std::memory_order_acquire) == 0; ++attempt)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            if (m_header->m_Ready.load(std::memory_order_acquire) == 0 ||
+                std::memcmp(m_header->m_Magic, s_SharedMagic, sizeof(s_SharedMagic)) != 0 ||
+                m_header->m_Version != s_SharedVersion ||
+                sizeof(Header) + sizeof(Entry) * s_DirectorySize + m_header->m_Capacity > m_mappedSize)
+            {
+                close();
+#ifndef _WIN32
+                // Left behind by a creator that died or an older build, unlink it so a new one is made
+                if (_replaceStale)
+                {
+                    ANALYTICS_INFO("Replacing stale shared asset cache " + _name);
+                    shm_unlink(("/" + _name).c_str());
+                    return openRegion(_name, _capacity, false);
+                }
+#endif
+                ANALYTICS_ERROR("Shared asset cache " + _name + " was created by an incompatible build.");
+                return false;
+            }
+        }
+
+        // Processes that crashed never detached, their slots and references are freed here
+        lockRegion();
+        reclaimDeadProcesses();
+        for (uint32_t slot = 0; slot < s_ProcessSlots && m_slot == s_ProcessSlots; ++slot)
+        {
+            if (m_header->m_Processes[slot] == 0)
+            {
+                m_header->m_Processes[slot] = currentProcessID();
+                m_slot = slot;
+            }
+        }
+        unlockRegion();
+
+        if (m_slot == s_ProcessSlots)
+        {
+            ANALYTICS_ERROR("Shared asset cache " + _name + " has no free process slot.");
+            close();
+            return false;
+        }
+
+        ANALYTICS_INFO(std::string(created ? "Created" : "Attached to") + " shared asset cache " + _name);
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Drop every reference held by this process and detach from the region.
+
+    The region is destroyed when the last live process detaches.
+    *****************************************************************************/
+    void SharedAssetCache::close()
+    {
+        if (!m_header)
+            return;
+
+        bool last = false;
+        if (m_slot < s_ProcessSlots)
+        {
+            lockRegion();
+            for (uint32_t i = 0; i < m_header->m_EntryCount; ++i)
+            {
+                m_directory[i].m_RefCounts[m_slot] = 0;
+            }
+            m_header->m_Processes[m_slot] = 0;
+            m_slot = s_ProcessSlots;
+
+            reclaimDeadProcesses();
+            last = true;
+            for (uint32_t pid : m_header->m_Processes)
+            {
+                last = last && pid == 0;
+            }
+            unlockRegion();
+        }
+
+#ifdef _WIN32
+        (void)last;
+        UnmapViewOfFile(m_header);
+        CloseHandle(static_cast<HANDLE>(m_mapping));
+        CloseHandle(static_cast<HANDLE>(m_lock));
+        m_mapping = nullptr;
+        m_lock = nullptr;
+#else
+        munmap(m_header, m_mappedSize);
+        ::close(m_fd);
+        m_fd = -1;
+        if (last)
+            shm_unlink(("/" + m_name).c_str());
+#endif
+
+        m_header = nullptr;
+        m_directory = nullptr;
+        m_data = nullptr;
+        m_mappedSize = 0;
+    }
+
+    /*!**************************************************************************
+    @brief Take a reference to a payload another process may have published.
+
+    @param _key The content hash of the payload.
+    @param _size Receives the payload size.
+    @return The payload, nullptr if it is not in the region.
+    *****************************************************************************/
+    const uint8_t* SharedAssetCache::acquire(ContentHash _key, size_t& _size)
+    {
+        if (!m_header)
+            return nullptr;
+
+        lockRegion();
+        Entry* entry = findEntry(_key);
+        const uint8_t* payload = nullptr;
+        if (entry)
+        {
+            ++entry->m_RefCounts[m_slot];
+            _size = static_cast<size_t>(entry->m_Size);
+            payload = m_data + entry->m_Offset;
+        }
+        unlockRegion();
+        return payload;
+    }
+
+    /*!**************************************************************************
+    @brief Copy a payload into the region and take a reference to it.
+
+    If another process published the same key first its copy is used.
+    Blocks of payloads nobody references are reused when the region is full.
+
+    @param _key The content hash of the payload.
+    @param _data The payload.
+    @param _size The payload size.
+    @return The payload in the region, nullptr if there is no room.
+    *****************************************************************************/
+    const uint8_t* SharedAssetCache::publish(ContentHash _key, const void* _data, size_t _size)
+    {
+        if (!m_header)
+            return nullptr;
+
+        lockRegion();
+
+        Entry* entry = findEntry(_key);
+        if (!entry)
+        {
+            const uint64_t blockSize = (_size + s_BlockAlignment - 1) / s_BlockAlignment * s_BlockAlignment;
+            if (m_header->m_DataUsed + blockSize <= m_header->m_Capacity && m_header->m_EntryCount < s_DirectorySize)
+            {
+                entry = &m_directory[m_header->m_EntryCount++];
+                entry->m_Offset = m_header->m_DataUsed;
+                entry->m_BlockSize = blockSize;
+                m_header->m_DataUsed += blockSize;
+            }
+            else
+            {
+                // Blocks held only by processes that crashed can be taken over too
+                reclaimDeadProcesses();
+
+                // Take over the smallest unreferenced block that fits
+                for (uint32_t i = 0; i < m_header->m_EntryCount; ++i)
+                {
+                    Entry& candidate = m_directory[i];
+                    if (!candidate.isReferenced() && candidate.m_BlockSize >= _size &&
+                        (!entry || candidate.m_BlockSize < entry->m_BlockSize))
+                    {
+                        entry = &candidate;
+                    }
+                }
+            }
+
+            if (!entry)
+            {
+                unlockRegion();
+                return nullptr;
+            }
+
+            // Hidden from findEntry until the copy is complete, so a crash here leaves a free block
+            entry->m_Size = 0;
+            std::memcpy(m_data + entry->m_Offset, _data, _size);
+            entry->m_Key = _key;
+            entry->m_Size = _size;
+        }
+
+        ++entry->m_RefCounts[m_slot];
+        const uint8_t* payload = m_data + entry->m_Offset;
+        unlockRegion();
+        return payload;
+    }
+
+    /*!**************************************************************************
+    @brief Drop a reference taken by acquire or publish.
+
+    @param _key The content hash of the payload.
+    *****************************************************************************/
+    void SharedAssetCache::release(ContentHash _key)
+    {
+        if (!m_header)
+            return;
+
+        lockRegion();
+        if (Entry* entry = findEntry(_key))
+        {
+            if (entry->m_RefCounts[m_slot])
+                --entry->m_RefCounts[m_slot];
+        }
+        unlockRegion();
+    }
+
+    /*!**************************************************************************
+    @brief Take the lock shared by every attached process.
+
+    If the previous owner died holding it, the references of dead processes
+    are dropped before returning.
+    *****************************************************************************/
+    void SharedAssetCache::lockRegion()
+    {
+#ifdef _WIN32
+        const bool abandoned = WaitForSingleObject(static_cast<HANDLE>(m_lock), INFINITE) == WAIT_ABANDONED;
+#else
+        const bool abandoned = pthread_mutex_lock(&m_header->m_Mutex) == EOWNERDEAD;
+        if (abandoned)
+            pthread_mutex_consistent(&m_header->m_Mutex);
+#endif
+        if (abandoned)
+        {
+            ANALYTICS_INFO("A process died holding the lock of shared asset cache " + m_name);
+            reclaimDeadProcesses();
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Release the lock shared by every attached process.
+    *****************************************************************************/
+    void SharedAssetCache::unlockRegion()
+    {
+#ifdef _WIN32
+        ReleaseMutex(static_cast<HANDLE>(m_lock));
+#else
+        pthread_mutex_unlock(&m_header->m_Mutex);
+#endif
+    }
+
+    /*!**************************************************************************
+    @brief Find the directory entry of a payload, the region must be locked.
+
+    @param _key The content hash of the payload.
+    @return The entry, nullptr if the payload is not in the region.
+    *****************************************************************************/
+    SharedAssetCache::Entry* SharedAssetCache::findEntry(ContentHash _key)
+    {
+        for (uint32_t i = 0; i < m_header->m_EntryCount; ++i)
+        {
+            if (m_directory[i].m_Key == _key && m_directory[i].m_Size != 0)
+                return &m_directory[i];
+        }
+        return nullptr;
+    }
+
+    /*!**************************************************************************
+    @brief Free the slots and references of processes that are no longer
+           running, the region must be locked.
+    *****************************************************************************/
+    void SharedAssetCache::reclaimDeadProcesses()
+    {
+        for (uint32_t slot = 0; slot < s_ProcessSlots; ++slot)
+        {
+            const uint32_t pid = m_header->m_Processes[slot];
+            if (pid == 0 || slot == m_slot || isProcessAlive(pid))
+                continue;
+
+            for (uint32_t i = 0; i < m_header->m_EntryCount; ++i)
+            {
+                m_directory[i].m_RefCounts[slot] = 0;
+            }
+            m_header->m_Processes[slot] = 0;
+            ANALYTICS_INFO("Dropped the shared asset cache references of exited process " + std::to_string(pid));
+        }
+    }
+}
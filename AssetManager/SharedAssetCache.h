@@ -0,0 +1,158 @@
+/******************************************************************************/
+/*!
+\file		SharedAssetCache.h
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the declarations for the SharedAssetCache
+            class, a named shared memory region that lets SOLEditor and Sandbox
+            running side by side reuse each other's decoded asset payloads
+
+            The region is locked with a robust process shared mutex, or a named
+            mutex on Windows, so a process that dies holding the lock does not
+            block the others. Every attached process owns a slot and each payload
+            counts references per slot, so the references of a process that died
+            are dropped by the next process to take the lock after noticing.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#ifndef _SHAREDASSETCACHE_H_
+#define _SHAREDASSETCACHE_H_
+
+#include <string>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+#include <SOL/AssetManager/ContentHash.h>
+
+namespace SOL
+{
+    class SharedAssetCache
+    {
+    public:
+
+        static const uint32_t s_DirectorySize = 4096;   //maximum number of payloads in the region
+        static const uint32_t s_ProcessSlots = 8;       //maximum number of processes attached at once
+
+        SharedAssetCache() = default;
+        SharedAssetCache(const SharedAssetCache&) = delete;
+        SharedAssetCache& operator=(const SharedAssetCache&) = delete;
+
+        /*!**************************************************************************
+        @brief Destructor for the SharedAssetCache class, detaches from the region.
+        *****************************************************************************/
+        ~SharedAssetCache() { close(); }
+
+        /*!**************************************************************************
+        @brief Create the shared region, or attach to it if another process already
+               created it.
+
+        A region left behind by a crashed creator or an incompatible build is
+        replaced on platforms where it outlives its processes.
+
+        @param _name The name of the region, the same in every process.
+        @param _capacity The number of payload bytes, only used by the creator.
+        @return True if the region is mapped.
+        *****************************************************************************/
+        bool open(const std::string& _name, size_t _capacity) { return openRegion(_name, _capacity, true); }
+
+        /*!**************************************************************************
+        @brief Drop every reference held by this process and detach from the region.
+
+        The region is destroyed when the last live process detaches.
+        *****************************************************************************/
+        void close();
+
+        /*!**************************************************************************
+        @brief Check if the region is mapped.
+
+        @return True if open succeeded.
+        *****************************************************************************/
+        bool isOpen() const { return m_header != nullptr; }
+
+        /*!**************************************************************************
+        @brief Take a reference to a payload another process may have published.
+
+        @param _key The content hash of the payload.
+        @param _size Receives the payload size.
+        @return The payload, nullptr if it is not in the region.
+        *****************************************************************************/
+        const uint8_t* acquire(ContentHash _key, size_t& _size);
+
+        /*!**************************************************************************
+        @brief Copy a payload into the region and take a reference to it.
+
+        If another process published the same key first its copy is used.
+        Blocks of payloads nobody references are reused when the region is full.
+
+        @param _key The content hash of the payload.
+        @param _data The payload.
+        @param _size The payload size.
+        @return The payload in the region, nullptr if there is no room.
+        *****************************************************************************/
+        const uint8_t* publish(ContentHash _key, const void* _data, size_t _size);
+
+        /*!**************************************************************************
+        @brief Drop a reference taken by acquire or publish.
+
+        @param _key The content hash of the payload.
+        *****************************************************************************/
+        void release(ContentHash _key);
+
+    private:
+
+        struct Header;
+        struct Entry;
+
+        /*!**************************************************************************
+        @brief Create or attach to the shared region.
+
+        @param _name The name of the region, the same in every process.
+        @param _capacity The number of payload bytes, only used by the creator.
+        @param _replaceStale Replace a region nobody can use instead of failing.
+        @return True if the region is mapped.
+        *****************************************************************************/
+        bool openRegion(const std::string& _name, size_t _capacity, bool _replaceStale);
+
+        /*!**************************************************************************
+        @brief Take the lock shared by every attached process.
+
+        If the previous owner died holding it, the references of dead processes
+        are dropped before returning.
+        *****************************************************************************/
+        void lockRegion();
+
+        /*!**************************************************************************
+        @brief Release the lock shared by every attached process.
+        *****************************************************************************/
+        void unlockRegion();
+
+        /*!**************************************************************************
+        @brief Find the directory entry of a payload, the region must be locked.
+
+        @param _key The content hash of the payload.
+        @return The entry, nullptr if the payload is not in the region.
+        *****************************************************************************/
+        Entry* findEntry(ContentHash _key);
+
+        /*!**************************************************************************
+        @brief Free the slots and references of processes that are no longer
+               running, the region must be locked.
+        *****************************************************************************/
+        void reclaimDeadProcesses();
+
+        Header* m_header{};
+        Entry* m_directory{};
+        uint8_t* m_data{};
+        size_t m_mappedSize{};
+        std::string m_name;
+        void* m_mapping{};                                   //file mapping handle on Windows
+        void* m_lock{};                                      //named mutex on Windows
+        int m_fd{ -1 };                                      //shared memory object elsewhere
+        uint32_t m_slot{ s_ProcessSlots };                   //process slot, s_ProcessSlots until attached
+    };
+}
+#endif // _SHAREDASSETCACHE_H_
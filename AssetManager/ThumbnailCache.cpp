@@ -0,0 +1,286 @@
+/******************************************************************************/
+/*!
+\file		ThumbnailCache.cpp
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the definitions for the ThumbnailCache class,
+            which generates asset browser previews on the worker pool and keeps
+            them in an on-disk cache keyed by content hash
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#include "SOLpch.h"
+#include "SOL/AssetManager/ThumbnailCache.h"
+#include "SOL/AssetManager/ContentHash.h"
+#include <stb_image.h>
+
+namespace SOL
+{
+    namespace
+    {
+        const char s_ThumbnailMagic[4] = { 'S', 'T', 'H', 'M' };
+
+        /*!**************************************************************************
+        @brief Read a cached preview.
+
+        @param _filepath The cache file.
+        @param _thumbnail Receives the preview.
+        @return True if the cache file exists and is valid.
+        *****************************************************************************/
+        bool readCachedThumbnail(const std::string& _filepath, Thumbnail& _thumbnail)
+        {
+            std::ifstream file(_filepath, std::ios::binary);
+            if (!file.is_open())
+                return false;
+
+            char magic[4]{};
+            int32_t size[2]{};
+            file.read(magic, sizeof(magic));
+            file.read(reinterpret_cast<char*>(size), sizeof(size));
+            if (!file || std::memcmp(magic, s_ThumbnailMagic, sizeof(magic)) != 0 ||
+                size[0] <= 0 || size[1] <= 0 ||
+                size[0] > ThumbnailCache::s_ThumbnailSize || size[1] > ThumbnailCache::s_ThumbnailSize)
+            {
+                return false;
+            }
+
+            _thumbnail.m_Width = size[0];
+            _thumbnail.m_Height = size[1];
+            _thumbnail.m_Pixels.resize(static_cast<size_t>(size[0]) * size[1] * 4);
+            file.read(reinterpret_cast<char*>(_thumbnail.m_Pixels.data()), _thumbnail.m_Pixels.size());
+            return static_cast<bool>(file);
+        }
+
+        /*!**************************************************************************
+        @brief Write a preview to the cache.
+
+        Writes to a temporary file first so a reader never sees half a preview.
+
+        @param _filepath The cache file.
+        @param _thumbnail The preview to write.
+        *****************************************************************************/
+        void writeCachedThumbnail(const std::string& _filepath, const Thumbnail& _thumbnail)
+        {
+            const std::string tempPath = _filepath + "." +
+                std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+            {
+                std::ofstream file(tempPath, std::ios::binary);
+                if (!file.is_open())
+                    return;
+
+                int32_t size[2] = { _thumbnail.m_Width, _thumbnail.m_Height };
+                file.write(s_ThumbnailMagic, sizeof(s_ThumbnailMagic));
+                file.write(reinterpret_cast<const char*>(size), sizeof(size));
+                file.write(reinterpret_cast<const char*>(_thumbnail.m_Pixels.data()), _thumbnail.m_Pixels.size());
+            }
+
+            std::error_code ec;
+            std::filesystem::rename(tempPath, _filepath, ec);
+        }
+
+        /*!**************************************************************************
+        @brief Box filter an image down to fit inside the preview size.
+
+        Images already smaller than the preview are copied as they are.
+
+        @param _pixels The RGBA8 source pixels.
+        @param _width The source width.
+        @param _height The source height.
+        @param _thumbnail Receives the preview.
+        *****************************************************************************/
+        void downsample(const uint8_t* _pixels, int _width, int _height, Thumbnail& _thumbnail)
+        {
+            const int maxSide = std::max(_width, _height);
+            const int limit = ThumbnailCache::s_ThumbnailSize;
+            _thumbnail.m_Width = maxSide > limit ? std::max(1, _width * limit / maxSide) : _width;
+            _thumbnail.m_Height = maxSide > limit ? std::max(1, _height * limit / maxSide) : _height;
+            _thumbnail.m_Pixels.resize(static_cast<size_t>(_thumbnail.m_Width) * _thumbnail.m_Height * 4);
+
+            for (int y = 0; y < _thumbnail.m_Height; ++y)
+            {
+                const int y0 = y * _height / _thumbnail.m_Height;
+                const int y1 = std::max(y0 + 1, (y + 1) * _height / _thumbnail.m_Height);
+                for (int x = 0; x < _thumbnail.m_Width; ++x)
+                {
+                    const int x0 = x * _width / _thumbnail.m_Width;
+                    const int x1 = std::max(x0 + 1, (x + 1) * _width / _thumbnail.m_Width);
+
+                    uint32_t sum[4]{};
+                    for (int sy = y0; sy < y1; ++sy)
+                    {
+                        const uint8_t* row = _pixels + (static_cast<size_t>(sy) * _width + x0) * 4;
+                        for (int sx = x0; sx < x1; ++sx, row += 4)
+                        {
+                            sum[0] += row[0];
+                            sum[1] += row[1];
+                            sum[2] += row[2];
+                            sum[3] += row[3];
+                        }
+                    }
+
+                    const uint32_t count = static_cast<uint32_t>((x1 - x0) * (y1 - y0));
+                    uint8_t* out = _thumbnail.m_Pixels.data() + (static_cast<size_t>(y) * _thumbnail.m_Width + x) * 4;
+                    for (int channel = 0; channel < 4; ++channel)
+                    {
+                        out[channel] = static_cast<uint8_t>(sum[channel] / count);
+                    }
+                }
+            }
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Constructor for the ThumbnailCache class.
+
+    @param _pool The worker pool previews are generated on.
+    @param _cacheDir The directory the cached previews are stored in.
+    *****************************************************************************/
+    ThumbnailCache::ThumbnailCache(WorkerPool& _pool, const std::string& _cacheDir)
+        : m_pool(_pool), m_cacheDir(_cacheDir), m_completed(std::make_shared<CompletedQueue>())
+    {
+        // Grey checkerboard shown until the real preview arrives
+        const int cell = s_ThumbnailSize / 8;
+        m_placeholder.m_State = Thumbnail::State::READY;
+        m_placeholder.m_Width = s_ThumbnailSize;
+        m_placeholder.m_Height = s_ThumbnailSize;
+        m_placeholder.m_Pixels.resize(static_cast<size_t>(s_ThumbnailSize) * s_ThumbnailSize * 4);
+        for (int y = 0; y < s_ThumbnailSize; ++y)
+        {
+            for (int x = 0; x < s_ThumbnailSize; ++x)
+            {
+                uint8_t shade = ((x / cell + y / cell) & 1) ? 96 : 64;
+                uint8_t* out = m_placeholder.m_Pixels.data() + (static_cast<size_t>(y) * s_ThumbnailSize + x) * 4;
+                out[0] = out[1] = out[2] = shade;
+                out[3] = 255;
+            }
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Get the preview of an asset.
+
+    The first call for an asset queues its preview on the worker pool. The
+    placeholder is returned until the preview is ready.
+
+    @param _assetID The UUID of the asset.
+    @param _filepath The file path of the asset.
+    @return The preview, or the placeholder if it is not ready.
+    *****************************************************************************/
+    const Thumbnail& ThumbnailCache::getThumbnail(uint64_t _assetID, const std::string& _filepath)
+    {
+        auto it = m_thumbnails.find(_assetID);
+        if (it != m_thumbnails.end())
+        {
+            return it->second.m_State == Thumbnail::State::READY ? it->second : m_placeholder;
+        }
+
+        m_thumbnails[_assetID].m_State = Thumbnail::State::PENDING;
+
+        // Results of jobs queued before an invalidate carry an older generation and are dropped
+        const uint64_t generation = ++m_generation;
+        m_requests[_assetID] = generation;
+
+        std::shared_ptr<CompletedQueue> completed = m_completed;
+        std::string cacheDir = m_cacheDir;
+        m_pool.submit([completed, cacheDir, _assetID, generation, _filepath]()
+            {
+                Result result{ _assetID, generation, Thumbnail() };
+                generateThumbnail(_filepath, cacheDir, result.m_Thumbnail);
+
+                std::lock_guard<std::mutex> lock(completed->m_Mutex);
+                completed->m_Results.push_back(std::move(result));
+            });
+
+        return m_placeholder;
+    }
+
+    /*!**************************************************************************
+    @brief Collect previews finished by the worker pool.
+
+    Call once per frame on the main thread.
+    *****************************************************************************/
+    void ThumbnailCache::update()
+    {
+        std::vector<Result> results;
+        {
+            std::lock_guard<std::mutex> lock(m_completed->m_Mutex);
+            results.swap(m_completed->m_Results);
+        }
+
+        for (Result& result : results)
+        {
+            auto request = m_requests.find(result.m_AssetID);
+            if (request == m_requests.end() || request->second != result.m_Generation)
+                continue; //invalidated while the job was running
+            m_requests.erase(request);
+
+            auto it = m_thumbnails.find(result.m_AssetID);
+            if (it == m_thumbnails.end())
+                continue;
+
+            // The generation only grows, so a preview requested again after an invalidate is uploaded again
+            result.m_Thumbnail.m_Version = static_cast<uint32_t>(result.m_Generation);
+            it->second = std::move(result.m_Thumbnail);
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Drop the preview of an asset so it is generated again on next use.
+
+    @param _assetID The UUID of the asset.
+    *****************************************************************************/
+    void ThumbnailCache::invalidate(uint64_t _assetID)
+    {
+        m_thumbnails.erase(_assetID);
+        m_requests.erase(_assetID);
+    }
+
+    /*!**************************************************************************
+    @brief Drop every preview held in memory, the on-disk cache is kept.
+    *****************************************************************************/
+    void ThumbnailCache::clear()
+    {
+        m_thumbnails.clear();
+        m_requests.clear();
+    }
+
+    /*!**************************************************************************
+    @brief Load or generate a preview, runs on a worker thread.
+
+    @param _filepath The file path of the asset.
+    @param _cacheDir The directory the cached previews are stored in.
+    @param _thumbnail Receives the preview.
+    *****************************************************************************/
+    void ThumbnailCache::generateThumbnail(const std::string& _filepath, const std::string& _cacheDir, Thumbnail& _thumbnail)
+    {
+        _thumbnail.m_State = Thumbnail::State::FAILED;
+
+        std::vector<uint8_t> bytes;
+        if (!readFileBytes(_filepath, bytes))
+            return;
+
+        const std::string cachePath = _cacheDir + hashToString(hashBytes(bytes.data(), bytes.size())) + ".sthm";
+        if (readCachedThumbnail(cachePath, _thumbnail))
+        {
+            _thumbnail.m_State = Thumbnail::State::READY;
+            return;
+        }
+
+        int width{}, height{}, channels{};
+        stbi_uc* pixels = stbi_load_from_memory(bytes.data(), static_cast<int>(bytes.size()), &width, &height, &channels, 4);
+        if (!pixels)
+            return;
+
+        downsample(pixels, width, height, _thumbnail);
+        stbi_image_free(pixels);
+        _thumbnail.m_State = Thumbnail::State::READY;
+
+        std::error_code ec;
+        std::filesystem::create_directories(_cacheDir, ec);
+        writeCachedThumbnail(cachePath, _thumbnail);
+    }
+}
@@ -0,0 +1,130 @@
+/******************************************************************************/
+/*!
+\file		ThumbnailCache.h
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the declarations for the ThumbnailCache class,
+            which generates asset browser previews on the worker pool and keeps
+            them in an on-disk cache keyed by content hash
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#ifndef _THUMBNAILCACHE_H_
+#define _THUMBNAILCACHE_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include <SOL/AssetManager/WorkerPool.h>
+
+namespace SOL
+{
+    struct Thumbnail
+    {
+        enum class State
+        {
+            PENDING,
+            READY,
+            FAILED
+        };
+
+        State m_State{ State::PENDING };
+        int m_Width{};
+        int m_Height{};
+        std::vector<uint8_t> m_Pixels; //RGBA8
+        uint32_t m_Version{};          //bumped whenever the pixels change so the browser knows to upload again
+    };
+
+    class ThumbnailCache
+    {
+    public:
+
+        static const int s_ThumbnailSize = 64;
+
+        /*!**************************************************************************
+        @brief Constructor for the ThumbnailCache class.
+
+        @param _pool The worker pool previews are generated on.
+        @param _cacheDir The directory the cached previews are stored in.
+        *****************************************************************************/
+        ThumbnailCache(WorkerPool& _pool, const std::string& _cacheDir = "./Assets/.thumbnails/");
+
+        /*!**************************************************************************
+        @brief Get the preview of an asset.
+
+        The first call for an asset queues its preview on the worker pool. The
+        placeholder is returned until the preview is ready.
+
+        @param _assetID The UUID of the asset.
+        @param _filepath The file path of the asset.
+        @return The preview, or the placeholder if it is not ready.
+        *****************************************************************************/
+        const Thumbnail& getThumbnail(uint64_t _assetID, const std::string& _filepath);
+
+        /*!**************************************************************************
+        @brief Collect previews finished by the worker pool.
+
+        Call once per frame on the main thread.
+        *****************************************************************************/
+        void update();
+
+        /*!**************************************************************************
+        @brief Drop the preview of an asset so it is generated again on next use.
+
+        @param _assetID The UUID of the asset.
+        *****************************************************************************/
+        void invalidate(uint64_t _assetID);
+
+        /*!**************************************************************************
+        @brief Drop every preview held in memory, the on-disk cache is kept.
+        *****************************************************************************/
+        void clear();
+
+        /*!**************************************************************************
+        @brief Get the placeholder shown while previews are pending.
+
+        @return The placeholder preview.
+        *****************************************************************************/
+        const Thumbnail& getPlaceholder() const { return m_placeholder; }
+
+    private:
+
+        struct Result
+        {
+            uint64_t m_AssetID;
+            uint64_t m_Generation;   //of the request the job was queued for
+            Thumbnail m_Thumbnail;
+        };
+
+        struct CompletedQueue
+        {
+            std::mutex m_Mutex;
+            std::vector<Result> m_Results;
+        };
+
+        /*!**************************************************************************
+        @brief Load or generate a preview, runs on a worker thread.
+
+        @param _filepath The file path of the asset.
+        @param _cacheDir The directory the cached previews are stored in.
+        @param _thumbnail Receives the preview.
+        *****************************************************************************/
+        static void generateThumbnail(const std::string& _filepath, const std::string& _cacheDir, Thumbnail& _thumbnail);
+
+        WorkerPool& m_pool;
+        std::string m_cacheDir;
+        std::unordered_map<uint64_t, Thumbnail> m_thumbnails; //UUID:PREVIEW
+        std::unordered_map<uint64_t, uint64_t> m_requests;    //UUID:GENERATION of the job in flight
+        uint64_t m_generation{};
+        std::shared_ptr<CompletedQueue> m_completed;          //shared with jobs still in flight
+        Thumbnail m_placeholder;
+    };
+}
+#endif // _THUMBNAILCACHE_H_
@@ -0,0 +1,304 @@
+/******************************************************************************/
+/*!
+\file		TileStreamer.cpp
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the definitions for the TileStreamer class,
+            which keeps the chunks of a ChunkedTileMap around the camera
+            resident, decoding them on the worker pool
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#include "SOLpch.h"
+#include "SOL/AssetManager/TileStreamer.h"
+#include "SOL/ECS/Components/TransformComponent.h"
+#include "SOL/ECS/Components/CameraComponent.h"
+#include <cmath>
+
+namespace SOL
+{
+    /*!**************************************************************************
+    @brief Constructor for the TileStreamer class.
+
+    Cell (x, y) covers _origin + (x, y) * _cellSize to one cell size past it.
+
+    @param _pool The worker pool chunks are decoded on.
+    @param _map The opened tile map, shared with jobs still in flight.
+    @param _originX The world x of the left edge of cell column 0.
+    @param _originY The world y of the edge of cell row 0.
+    @param _cellSize The world size of a cell.
+    *****************************************************************************/
+    TileStreamer::TileStreamer(WorkerPool& _pool, std::shared_ptr<const ChunkedTileMap> _map,
+                               float _originX, float _originY, float _cellSize)
+        : m_pool(_pool), m_map(std::move(_map)), m_origin{ _originX, _originY },
+          m_chunkWorldSize(_cellSize * static_cast<float>(m_map->getChunkSize())),
+          m_maxPending(std::max<size_t>(2, static_cast<size_t>(_pool.threadCount()) * 2)),
+          m_completed(std::make_shared<CompletedQueue>())
+    {
+    }
+
+    /*!**************************************************************************
+    @brief Set the load and evict margins in chunks.
+
+    @param _loadMargin Chunks past the view edge that are loaded.
+    @param _evictMargin Chunks past the view edge that are kept, raised to
+                        _loadMargin if smaller.
+    *****************************************************************************/
+    void TileStreamer::setMargins(uint32_t _loadMargin, uint32_t _evictMargin)
+    {
+        m_loadMargin = _loadMargin;
+        m_evictMargin = std::max(_loadMargin, _evictMargin);
+    }
+
+    /*!**************************************************************************
+    @brief Set the functions told when a chunk becomes resident or is evicted,
+           so game code can create and destroy what it draws for the chunk.
+
+    Both are called on the thread that calls update.
+
+    @param _onLoaded Called once a chunk is resident.
+    @param _onEvicted Called just before a chunk is dropped.
+    *****************************************************************************/
+    void TileStreamer::setCallbacks(ChunkCallback _onLoaded, ChunkCallback _onEvicted)
+    {
+        m_onLoaded = std::move(_onLoaded);
+        m_onEvicted = std::move(_onEvicted);
+    }
+
+    /*!**************************************************************************
+    @brief Stream chunks for a view. Call once per frame on the main thread.
+
+    @param _centerX The world x of the view center.
+    @param _centerY The world y of the view center.
+    @param _halfWidth Half the world width of the view.
+    @param _halfHeight Half the world height of the view.
+    *****************************************************************************/
+    void TileStreamer::update(float _centerX, float _centerY, float _halfWidth, float _halfHeight)
+    {
+        if (m_map->getChunksX() == 0 || m_map->getChunksY() == 0 || m_chunkWorldSize <= 0.f)
+            return;
+
+        m_keepRange = getRange(_centerX, _centerY, _halfWidth, _halfHeight, m_evictMargin);
+
+        collectChunks();
+        evictChunks();
+        requestChunks(getRange(_centerX, _centerY, _halfWidth, _halfHeight, m_loadMargin), _centerX, _centerY);
+    }
+
+    /*!**************************************************************************
+    @brief Stream chunks for the view of an orthographic camera.
+
+    @param _transform The transform of the active camera entity.
+    @param _camera The active camera.
+    @param _aspectRatio The viewport width over its height.
+    *****************************************************************************/
+    void TileStreamer::update(const TransformComponent& _transform, const CameraComponent& _camera, float _aspectRatio)
+    {
+        const float halfHeight = _camera.m_OrthoSize * 0.5f;
+        update(_transform.m_Transform.x, _transform.m_Transform.y, halfHeight * _aspectRatio, halfHeight);
+    }
+
+    /*!**************************************************************************
+    @brief Get a resident chunk.
+
+    @param _chunkX The chunk column.
+    @param _chunkY The chunk row.
+    @return The chunk, nullptr if it is not resident.
+    *****************************************************************************/
+    const TileChunk* TileStreamer::getChunk(uint32_t _chunkX, uint32_t _chunkY) const
+    {
+        if (_chunkX >= m_map->getChunksX() || _chunkY >= m_map->getChunksY())
+            return nullptr;
+
+        auto it = m_resident.find(getIndex(_chunkX, _chunkY));
+        return it != m_resident.end() ? &it->second : nullptr;
+    }
+
+    /*!**************************************************************************
+    @brief Get a cell of a resident chunk.
+
+    @param _x The cell column.
+    @param _y The cell row.
+    @param _value Receives the cell value.
+    @return False if the chunk of the cell is not resident.
+    *****************************************************************************/
+    bool TileStreamer::getTile(uint32_t _x, uint32_t _y, ChunkedTileMap::TileValue& _value) const
+    {
+        const uint32_t chunkSize = m_map->getChunkSize();
+        if (_x >= m_map->getWidth() || _y >= m_map->getHeight())
+            return false;
+
+        const TileChunk* chunk = getChunk(_x / chunkSize, _y / chunkSize);
+        if (!chunk)
+            return false;
+
+        _value = chunk->m_Stored ? chunk->m_Cells[static_cast<size_t>(_y % chunkSize) * chunkSize + _x % chunkSize]
+                                 : m_map->getEmptyValue();
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Evict every resident chunk, results of jobs in flight are dropped.
+    *****************************************************************************/
+    void TileStreamer::clear()
+    {
+        for (const auto& resident : m_resident)
+        {
+            if (m_onEvicted)
+                m_onEvicted(resident.second);
+        }
+        m_resident.clear();
+        m_pending.clear();
+        m_keepRange = ChunkRange();
+    }
+
+    /*!**************************************************************************
+    @brief Get the chunks within a margin of a view, clamped to the map.
+    *****************************************************************************/
+    TileStreamer::ChunkRange TileStreamer::getRange(float _centerX, float _centerY, float _halfWidth, float _halfHeight, uint32_t _margin) const
+    {
+        const double margin = static_cast<double>(_margin);
+        ChunkRange range;
+        range.m_MinX = static_cast<int64_t>(std::floor((_centerX - _halfWidth - m_origin[0]) / m_chunkWorldSize - margin));
+        range.m_MinY = static_cast<int64_t>(std::floor((_centerY - _halfHeight - m_origin[1]) / m_chunkWorldSize - margin));
+        range.m_MaxX = static_cast<int64_t>(std::floor((_centerX + _halfWidth - m_origin[0]) / m_chunkWorldSize + margin));
+        range.m_MaxY = static_cast<int64_t>(std::floor((_centerY + _halfHeight - m_origin[1]) / m_chunkWorldSize + margin));
+
+        range.m_MinX = std::max<int64_t>(range.m_MinX, 0);
+        range.m_MinY = std::max<int64_t>(range.m_MinY, 0);
+        range.m_MaxX = std::min<int64_t>(range.m_MaxX, static_cast<int64_t>(m_map->getChunksX()) - 1);
+        range.m_MaxY = std::min<int64_t>(range.m_MaxY, static_cast<int64_t>(m_map->getChunksY()) - 1);
+        return range;
+    }
+
+    /*!**************************************************************************
+    @brief Make collected chunks resident, dropping those no longer wanted.
+    *****************************************************************************/
+    void TileStreamer::collectChunks()
+    {
+        std::vector<TileChunk> chunks;
+        std::vector<uint64_t> failed;
+        {
+            std::lock_guard<std::mutex> lock(m_completed->m_Mutex);
+            chunks.swap(m_completed->m_Chunks);
+            failed.swap(m_completed->m_Failed);
+        }
+
+        for (uint64_t index : failed)
+        {
+            if (m_pending.erase(index) != 0 && m_failed.insert(index).second)
+                ANALYTICS_ERROR("Failed to decode a tile map chunk.");
+        }
+
+        for (TileChunk& chunk : chunks)
+        {
+            // Chunks the camera left while they were decoding are not kept
+            if (m_pending.erase(getIndex(chunk.m_ChunkX, chunk.m_ChunkY)) != 0 && m_keepRange.contains(chunk.m_ChunkX, chunk.m_ChunkY))
+                addResident(std::move(chunk));
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Request the missing chunks of the load range, nearest first.
+    *****************************************************************************/
+    void TileStreamer::requestChunks(const ChunkRange& _range, float _centerX, float _centerY)
+    {
+        struct Request
+        {
+            float m_Distance;
+            uint32_t m_ChunkX;
+            uint32_t m_ChunkY;
+        };
+
+        std::vector<Request> requests;
+        for (int64_t chunkY = _range.m_MinY; chunkY <= _range.m_MaxY; ++chunkY)
+        {
+            for (int64_t chunkX = _range.m_MinX; chunkX <= _range.m_MaxX; ++chunkX)
+            {
+                const uint32_t x = static_cast<uint32_t>(chunkX), y = static_cast<uint32_t>(chunkY);
+                const uint64_t index = getIndex(x, y);
+                if (m_resident.count(index) != 0 || m_pending.count(index) != 0 || m_failed.count(index) != 0)
+                    continue;
+
+                // Chunks the file does not store need no decoding
+                if (!m_map->hasChunk(x, y))
+                {
+                    TileChunk chunk;
+                    chunk.m_ChunkX = x;
+                    chunk.m_ChunkY = y;
+                    addResident(std::move(chunk));
+                    continue;
+                }
+
+                const float dx = m_origin[0] + (static_cast<float>(x) + 0.5f) * m_chunkWorldSize - _centerX;
+                const float dy = m_origin[1] + (static_cast<float>(y) + 0.5f) * m_chunkWorldSize - _centerY;
+                requests.push_back({ dx * dx + dy * dy, x, y });
+            }
+        }
+
+        const size_t slots = m_pending.size() < m_maxPending ? m_maxPending - m_pending.size() : 0;
+        if (requests.size() > slots)
+        {
+            std::partial_sort(requests.begin(), requests.begin() + slots, requests.end(),
+                [](const Request& _a, const Request& _b) { return _a.m_Distance < _b.m_Distance; });
+            requests.resize(slots);
+        }
+
+        for (const Request& request : requests)
+        {
+            m_pending.insert(getIndex(request.m_ChunkX, request.m_ChunkY));
+
+            std::shared_ptr<const ChunkedTileMap> map = m_map;
+            std::shared_ptr<CompletedQueue> completed = m_completed;
+            const uint64_t index = getIndex(request.m_ChunkX, request.m_ChunkY);
+            m_pool.submit([map, completed, request, index]()
+                {
+                    TileChunk chunk;
+                    chunk.m_ChunkX = request.m_ChunkX;
+                    chunk.m_ChunkY = request.m_ChunkY;
+                    chunk.m_Stored = true;
+                    const bool decoded = map->readChunk(request.m_ChunkX, request.m_ChunkY, chunk.m_Cells);
+
+                    std::lock_guard<std::mutex> lock(completed->m_Mutex);
+                    if (decoded)
+                        completed->m_Chunks.push_back(std::move(chunk));
+                    else
+                        completed->m_Failed.push_back(index);
+                });
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Evict the resident chunks outside the keep range.
+    *****************************************************************************/
+    void TileStreamer::evictChunks()
+    {
+        for (auto it = m_resident.begin(); it != m_resident.end();)
+        {
+            if (m_keepRange.contains(it->second.m_ChunkX, it->second.m_ChunkY))
+            {
+                ++it;
+                continue;
+            }
+
+            if (m_onEvicted)
+                m_onEvicted(it->second);
+            it = m_resident.erase(it);
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Make a chunk resident and tell the game code.
+    *****************************************************************************/
+    void TileStreamer::addResident(TileChunk&& _chunk)
+    {
+        TileChunk& chunk = m_resident[getIndex(_chunk.m_ChunkX, _chunk.m_ChunkY)];
+        chunk = std::move(_chunk);
+        if (m_onLoaded)
+            m_onLoaded(chunk);
+    }
+}
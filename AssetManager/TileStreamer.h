@@ -0,0 +1,206 @@
+/******************************************************************************/
+/*!
+\file		TileStreamer.h
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the declarations for the TileStreamer class,
+            which keeps the chunks of a ChunkedTileMap around the camera
+            resident, decoding them on the worker pool
+
+            Each update requests every chunk within the load margin of the
+            view, nearest first, and evicts resident chunks once they are
+            further than the evict margin. The gap between the two margins
+            stops a camera moving back and forth over a chunk edge from
+            loading and evicting the same chunks every frame. Memory and per
+            frame cost follow the size of the view, not the size of the map.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#ifndef _TILESTREAMER_H_
+#define _TILESTREAMER_H_
+
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <cstdint>
+#include <SOL/AssetManager/ChunkedTileMap.h>
+#include <SOL/AssetManager/WorkerPool.h>
+
+namespace SOL
+{
+    class TransformComponent;
+    class CameraComponent;
+
+    struct TileChunk
+    {
+        uint32_t m_ChunkX{};
+        uint32_t m_ChunkY{};
+        bool m_Stored{};                            //false if the map does not store it, every cell is then the empty value
+        std::vector<ChunkedTileMap::TileValue> m_Cells; //chunk size squared in row-major order, empty if not stored
+    };
+
+    class TileStreamer
+    {
+    public:
+
+        using ChunkCallback = std::function<void(const TileChunk& chunk)>;
+
+        static const uint32_t s_DefaultLoadMargin = 1;  //chunks past the view edge loaded ahead of the camera
+        static const uint32_t s_DefaultEvictMargin = 2; //chunks past the view edge kept before eviction
+
+        /*!**************************************************************************
+        @brief Constructor for the TileStreamer class.
+
+        Cell (x, y) covers _origin + (x, y) * _cellSize to one cell size past it.
+
+        @param _pool The worker pool chunks are decoded on.
+        @param _map The opened tile map, shared with jobs still in flight.
+        @param _originX The world x of the left edge of cell column 0.
+        @param _originY The world y of the edge of cell row 0.
+        @param _cellSize The world size of a cell.
+        *****************************************************************************/
+        TileStreamer(WorkerPool& _pool, std::shared_ptr<const ChunkedTileMap> _map,
+                     float _originX = 0.f, float _originY = 0.f, float _cellSize = 1.f);
+
+        /*!**************************************************************************
+        @brief Set the load and evict margins in chunks.
+
+        @param _loadMargin Chunks past the view edge that are loaded.
+        @param _evictMargin Chunks past the view edge that are kept, raised to
+                            _loadMargin if smaller.
+        *****************************************************************************/
+        void setMargins(uint32_t _loadMargin, uint32_t _evictMargin);
+
+        /*!**************************************************************************
+        @brief Set the functions told when a chunk becomes resident or is evicted,
+               so game code can create and destroy what it draws for the chunk.
+
+        Both are called on the thread that calls update.
+
+        @param _onLoaded Called once a chunk is resident.
+        @param _onEvicted Called just before a chunk is dropped.
+        *****************************************************************************/
+        void setCallbacks(ChunkCallback _onLoaded, ChunkCallback _onEvicted);
+
+        /*!**************************************************************************
+        @brief Stream chunks for a view. Call once per frame on the main thread.
+
+        @param _centerX The world x of the view center.
+        @param _centerY The world y of the view center.
+        @param _halfWidth Half the world width of the view.
+        @param _halfHeight Half the world height of the view.
+        *****************************************************************************/
+        void update(float _centerX, float _centerY, float _halfWidth, float _halfHeight);
+
+        /*!**************************************************************************
+        @brief Stream chunks for the view of an orthographic camera.
+
+        @param _transform The transform of the active camera entity.
+        @param _camera The active camera.
+        @param _aspectRatio The viewport width over its height.
+        *****************************************************************************/
+        void update(const TransformComponent& _transform, const CameraComponent& _camera, float _aspectRatio);
+
+        /*!**************************************************************************
+        @brief Get a resident chunk.
+
+        @param _chunkX The chunk column.
+        @param _chunkY The chunk row.
+        @return The chunk, nullptr if it is not resident.
+        *****************************************************************************/
+        const TileChunk* getChunk(uint32_t _chunkX, uint32_t _chunkY) const;
+
+        /*!**************************************************************************
+        @brief Get a cell of a resident chunk.
+
+        @param _x The cell column.
+        @param _y The cell row.
+        @param _value Receives the cell value.
+        @return False if the chunk of the cell is not resident.
+        *****************************************************************************/
+        bool getTile(uint32_t _x, uint32_t _y, ChunkedTileMap::TileValue& _value) const;
+
+        /*!**************************************************************************
+        @brief Evict every resident chunk, results of jobs in flight are dropped.
+        *****************************************************************************/
+        void clear();
+
+        /*!**************************************************************************
+        @brief Get the number of resident chunks and of chunks being decoded.
+        *****************************************************************************/
+        size_t getResidentCount() const { return m_resident.size(); }
+        size_t getPendingCount() const { return m_pending.size(); }
+
+    private:
+
+        struct ChunkRange
+        {
+            int64_t m_MinX{}, m_MinY{}, m_MaxX{ -1 }, m_MaxY{ -1 }; //inclusive, empty if min > max
+
+            bool contains(uint32_t _chunkX, uint32_t _chunkY) const
+            {
+                return _chunkX >= m_MinX && _chunkX <= m_MaxX && _chunkY >= m_MinY && _chunkY <= m_MaxY;
+            }
+        };
+
+        struct CompletedQueue
+        {
+            std::mutex m_Mutex;
+            std::vector<TileChunk> m_Chunks;
+            std::vector<uint64_t> m_Failed;
+        };
+
+        /*!**************************************************************************
+        @brief Get the chunks within a margin of a view, clamped to the map.
+        *****************************************************************************/
+        ChunkRange getRange(float _centerX, float _centerY, float _halfWidth, float _halfHeight, uint32_t _margin) const;
+
+        /*!**************************************************************************
+        @brief Make collected chunks resident, dropping those no longer wanted.
+        *****************************************************************************/
+        void collectChunks();
+
+        /*!**************************************************************************
+        @brief Request the missing chunks of the load range, nearest first.
+        *****************************************************************************/
+        void requestChunks(const ChunkRange& _range, float _centerX, float _centerY);
+
+        /*!**************************************************************************
+        @brief Evict the resident chunks outside the keep range.
+        *****************************************************************************/
+        void evictChunks();
+
+        /*!**************************************************************************
+        @brief Make a chunk resident and tell the game code.
+        *****************************************************************************/
+        void addResident(TileChunk&& _chunk);
+
+        uint64_t getIndex(uint32_t _chunkX, uint32_t _chunkY) const
+        {
+            return static_cast<uint64_t>(_chunkY) * m_map->getChunksX() + _chunkX;
+        }
+
+        WorkerPool& m_pool;
+        std::shared_ptr<const ChunkedTileMap> m_map;
+        float m_origin[2];
+        float m_chunkWorldSize;
+        uint32_t m_loadMargin{ s_DefaultLoadMargin };
+        uint32_t m_evictMargin{ s_DefaultEvictMargin };
+        size_t m_maxPending;                                //jobs in flight, so the nearest chunks are not queued behind far ones
+        ChunkRange m_keepRange;
+        ChunkCallback m_onLoaded;
+        ChunkCallback m_onEvicted;
+        std::unordered_map<uint64_t, TileChunk> m_resident; //CHUNK INDEX:CHUNK
+        std::unordered_set<uint64_t> m_pending;
+        std::unordered_set<uint64_t> m_failed;              //not requested again
+        std::shared_ptr<CompletedQueue> m_completed;        //shared with jobs still in flight
+    };
+}
+#endif // _TILESTREAMER_H_
@@ -0,0 +1,452 @@
+/******************************************************************************/
+/*!
+\file		VirtualFileSystem.cpp
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the definitions for the VirtualFileSystem
+            class, which maps logical asset paths onto prioritized mounts of
+            loose directories, asset packs and patch overlays
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#include "SOLpch.h"
+#include "SOL/AssetManager/VirtualFileSystem.h"
+#include "SOL/AssetManager/ContentHash.h"
+
+namespace SOL
+{
+    namespace
+    {
+        /*!**************************************************************************
+        @brief Normalize a mount point so it can be prefixed to relative paths.
+
+        @param _mountPoint The mount point.
+        @return The mount point, empty or ending in '/'.
+        *****************************************************************************/
+        std::string normalizeMountPoint(const std::string& _mountPoint)
+        {
+            std::string mountPoint = normalizeAssetPath(_mountPoint);
+            if (mountPoint == ".")
+                mountPoint.clear();
+            if (!mountPoint.empty() && mountPoint.back() != '/')
+                mountPoint += '/';
+            return mountPoint;
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Get the file system shared by the AssetManager and the Serializer.
+
+    On first use the asset root is mounted: the directory named by the
+    SOL_ASSET_ROOT environment variable, or the working directory if it is
+    not set. Its Assets and Json folders are mounted at "Assets" and "Json".
+
+    @return The file system.
+    *****************************************************************************/
+    VirtualFileSystem& VirtualFileSystem::Get()
+    {
+        static VirtualFileSystem* s_Instance = []()
+            {
+                static VirtualFileSystem vfs;
+                const char* env = std::getenv("SOL_ASSET_ROOT");
+                std::string root = env && *env ? env : ".";
+                if (root.back() != '/' && root.back() != '\\')
+                    root += '/';
+
+                vfs.m_extractDir = root + "Assets/.patch/";
+                vfs.mountDirectory(root + "Assets", "Assets");
+                vfs.mountDirectory(root + "Json", "Json");
+                return &vfs;
+            }();
+        return *s_Instance;
+    }
+
+    /*!**************************************************************************
+    @brief Mount a loose directory.
+
+    The directory is scanned once here, later lookups do not touch the disk.
+
+    @param _directory The directory on disk.
+    @param _mountPoint The logical path the directory appears under.
+    @param _priority The priority of the mount.
+    @return True if the directory was mounted.
+    *****************************************************************************/
+    bool VirtualFileSystem::mountDirectory(const std::string& _directory, const std::string& _mountPoint, int _priority)
+    {
+        std::error_code ec;
+        if (!std::filesystem::is_directory(_directory, ec))
+        {
+            ANALYTICS_WARN("Cannot mount " + _directory + ", it is not a directory.");
+            return false;
+        }
+
+        auto mount = std::make_shared<Mount>();
+        mount->m_Type = MountType::DIRECTORY;
+        mount->m_Source = _directory;
+        mount->m_MountPoint = normalizeMountPoint(_mountPoint);
+        mount->m_Priority = _priority;
+        scanDirectory(_directory, mount->m_Files);
+
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        mount->m_Order = m_mountCount++;
+        m_mounts.push_back(mount);
+        addToCache(mount);
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Mount an asset pack or patch pack.
+
+    The paths stored in the pack are used as the logical paths.
+
+    @param _packPath The pack file on disk.
+    @param _priority The priority of the mount.
+    @return True if the pack was mounted.
+    *****************************************************************************/
+    bool VirtualFileSystem::mountPack(const std::string& _packPath, int _priority)
+    {
+        auto mount = std::make_shared<Mount>();
+        if (!mount->m_Pack.open(_packPath))
+            return false;
+
+        mount->m_Type = MountType::PACK;
+        mount->m_Source = _packPath;
+        mount->m_Priority = _priority;
+
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        mount->m_Order = m_mountCount++;
+        m_mounts.push_back(mount);
+        addToCache(mount);
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Remove a mount and rebuild the resolution cache.
+
+    @param _source The directory or pack file that was mounted.
+    @return True if a mount was removed.
+    *****************************************************************************/
+    bool VirtualFileSystem::unmount(const std::string& _source)
+    {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        auto it = std::find_if(m_mounts.begin(), m_mounts.end(),
+            [&_source](const std::shared_ptr<Mount>& _mount) { return _mount->m_Source == _source; });
+        if (it == m_mounts.end())
+            return false;
+
+        m_mounts.erase(it);
+        m_files.clear();
+        for (const std::shared_ptr<Mount>& mount : m_mounts)
+        {
+            addToCache(mount);
+        }
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Rescan every mounted directory and rebuild the resolution cache.
+
+    Only needed when files are added to a mounted directory outside of
+    getWritePath.
+    *****************************************************************************/
+    void VirtualFileSystem::refresh()
+    {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        m_files.clear();
+        for (const std::shared_ptr<Mount>& mount : m_mounts)
+        {
+            if (mount->m_Type == MountType::DIRECTORY)
+            {
+                mount->m_Files.clear();
+                scanDirectory(mount->m_Source, mount->m_Files);
+            }
+            addToCache(mount);
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Check if a logical path is provided by any mount.
+
+    @param _filepath The logical path.
+    @return True if a mount provides the file.
+    *****************************************************************************/
+    bool VirtualFileSystem::exists(const std::string& _filepath) const
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_files.count(normalizeAssetPath(_filepath)) != 0;
+    }
+
+    /*!**************************************************************************
+    @brief Read a whole file.
+
+    Paths no mount provides are read from disk as they are.
+
+    @param _filepath The logical path.
+    @param _bytes Receives the file contents.
+    @return True if the file was read.
+    *****************************************************************************/
+    bool VirtualFileSystem::readFile(const std::string& _filepath, std::vector<uint8_t>& _bytes) const
+    {
+        std::shared_ptr<Mount> mount;
+        std::string realPath = _filepath;
+        PackEntry entry;
+        {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            auto it = m_files.find(normalizeAssetPath(_filepath));
+            if (it != m_files.end())
+            {
+                mount = it->second.m_Mount;
+                entry = it->second.m_Entry;
+                if (mount->m_Type == MountType::DIRECTORY)
+                    realPath = it->second.m_RealPath;
+            }
+        }
+
+        if (mount && mount->m_Type == MountType::PACK)
+            return mount->m_Pack.readEntry(entry, _bytes);
+        return readFileBytes(realPath, _bytes);
+    }
+
+    /*!**************************************************************************
+    @brief Read a whole text file.
+
+    @param _filepath The logical path.
+    @param _text Receives the file contents.
+    @return True if the file was read.
+    *****************************************************************************/
+    bool VirtualFileSystem::readText(const std::string& _filepath, std::string& _text) const
+    {
+        std::vector<uint8_t> bytes;
+        if (!readFile(_filepath, bytes))
+            return false;
+
+        _text.assign(bytes.begin(), bytes.end());
+        return true;
+    }
+
+    /*!**************************************************************************
+    @brief Map a whole file for parsing in place.
+
+    Files from a mounted directory are mapped copy on write, files inside a
+    pack are decompressed into the MappedFile.
+
+    @param _filepath The logical path.
+    @param _file Receives the file contents.
+    @return True if the file was mapped or read.
+    *****************************************************************************/
+    bool VirtualFileSystem::mapFile(const std::string& _filepath, MappedFile& _file) const
+    {
+        std::shared_ptr<Mount> mount;
+        std::string realPath = _filepath;
+        PackEntry entry;
+        {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            auto it = m_files.find(normalizeAssetPath(_filepath));
+            if (it != m_files.end())
+            {
+                mount = it->second.m_Mount;
+                entry = it->second.m_Entry;
+                if (mount->m_Type == MountType::DIRECTORY)
+                    realPath = it->second.m_RealPath;
+            }
+        }
+
+        if (mount && mount->m_Type == MountType::PACK)
+        {
+            std::vector<uint8_t> bytes;
+            if (!mount->m_Pack.readEntry(entry, bytes))
+                return false;
+            _file.adopt(std::move(bytes));
+            return true;
+        }
+        return _file.open(realPath);
+    }
+
+    /*!**************************************************************************
+    @brief Get a file on disk for loaders that only accept a path.
+
+    Files inside a pack are extracted once into the extraction directory,
+    named by content hash. Paths no mount provides are returned as they are.
+
+    @param _filepath The logical path.
+    @return The path on disk to load from.
+    *****************************************************************************/
+    std::string VirtualFileSystem::getLoadPath(const std::string& _filepath)
+    {
+        const std::string key = normalizeAssetPath(_filepath);
+        std::shared_ptr<Mount> mount;
+        PackEntry entry;
+        {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            auto it = m_files.find(key);
+            if (it == m_files.end())
+                return _filepath;
+            if (!it->second.m_RealPath.empty())
+                return it->second.m_RealPath;
+
+            mount = it->second.m_Mount;
+            entry = it->second.m_Entry;
+        }
+
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        const std::string extracted = m_extractDir + hashToString(entry.m_Hash) + fs::path(key).extension().string();
+        if (!fs::exists(extracted, ec))
+        {
+            std::vector<uint8_t> bytes;
+            if (!mount->m_Pack.readEntry(entry, bytes))
+            {
+                ANALYTICS_ERROR("Failed to extract " + key + " from " + mount->m_Source);
+                return _filepath;
+            }
+
+            fs::create_directories(m_extractDir, ec);
+            const std::string tempPath = extracted + "." +
+                std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+            {
+                std::ofstream out(tempPath, std::ios::binary);
+                out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+            }
+            fs::rename(tempPath, extracted, ec);
+        }
+
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        auto it = m_files.find(key);
+        if (it != m_files.end() && it->second.m_Mount == mount)
+            it->second.m_RealPath = extracted;
+        return extracted;
+    }
+
+    /*!**************************************************************************
+    @brief Get the file on disk a logical path should be written to.
+
+    Files from a mounted directory are written in place. New files go to the
+    highest priority directory mounted over their path and are added to the
+    resolution cache.
+
+    @param _filepath The logical path.
+    @return The path on disk to write to.
+    *****************************************************************************/
+    std::string VirtualFileSystem::getWritePath(const std::string& _filepath)
+    {
+        const std::string key = normalizeAssetPath(_filepath);
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+        auto it = m_files.find(key);
+        if (it != m_files.end() && it->second.m_Mount->m_Type == MountType::DIRECTORY)
+            return it->second.m_RealPath;
+
+        std::shared_ptr<Mount> target;
+        for (const std::shared_ptr<Mount>& mount : m_mounts)
+        {
+            if (mount->m_Type != MountType::DIRECTORY || key.compare(0, mount->m_MountPoint.size(), mount->m_MountPoint) != 0)
+                continue;
+            if (!target || shadows(*mount, *target))
+                target = mount;
+        }
+        if (!target)
+            return _filepath;
+
+        const std::string relative = key.substr(target->m_MountPoint.size());
+        target->m_Files.push_back(relative);
+
+        Location& location = m_files[key];
+        location.m_Mount = target;
+        location.m_RealPath = target->m_Source + "/" + relative;
+        location.m_Entry = PackEntry();
+        return location.m_RealPath;
+    }
+
+    /*!**************************************************************************
+    @brief Get the number of logical paths in the resolution cache.
+
+    @return The number of files.
+    *****************************************************************************/
+    size_t VirtualFileSystem::getFileCount() const
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_files.size();
+    }
+
+    /*!**************************************************************************
+    @brief Add the files of a mount to the resolution cache.
+
+    @param _mount The mount to add.
+    *****************************************************************************/
+    void VirtualFileSystem::addToCache(const std::shared_ptr<Mount>& _mount)
+    {
+        auto claim = [this, &_mount](const std::string& _key) -> Location*
+            {
+                auto it = m_files.find(_key);
+                if (it != m_files.end() && !shadows(*_mount, *it->second.m_Mount))
+                    return nullptr;
+
+                Location& location = m_files[_key];
+                location.m_Mount = _mount;
+                location.m_RealPath.clear();
+                location.m_Entry = PackEntry();
+                return &location;
+            };
+
+        if (_mount->m_Type == MountType::DIRECTORY)
+        {
+            for (const std::string& relative : _mount->m_Files)
+            {
+                if (Location* location = claim(_mount->m_MountPoint + relative))
+                    location->m_RealPath = _mount->m_Source + "/" + relative;
+            }
+        }
+        else
+        {
+            for (const auto& [path, entry] : _mount->m_Pack.getEntries())
+            {
+                if (Location* location = claim(path))
+                    location->m_Entry = entry;
+            }
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Check if a mount should shadow the current owner of a path.
+
+    @param _mount The new mount.
+    @param _current The mount currently providing the path.
+    @return True if the new mount wins.
+    *****************************************************************************/
+    bool VirtualFileSystem::shadows(const Mount& _mount, const Mount& _current)
+    {
+        if (_mount.m_Priority != _current.m_Priority)
+            return _mount.m_Priority > _current.m_Priority;
+        return _mount.m_Order > _current.m_Order;
+    }
+
+    /*!**************************************************************************
+    @brief Scan a directory for files.
+
+    Folders starting with '.' hold generated caches and are skipped.
+
+    @param _directory The directory to scan.
+    @param _files Receives the paths relative to the directory.
+    *****************************************************************************/
+    void VirtualFileSystem::scanDirectory(const std::string& _directory, std::vector<std::string>& _files)
+    {
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        for (auto it = fs::recursive_directory_iterator(_directory, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+        {
+            const std::string name = it->path().filename().string();
+            if (it->is_directory(ec))
+            {
+                if (!name.empty() && name[0] == '.')
+                    it.disable_recursion_pending();
+                continue;
+            }
+
+            _files.push_back(normalizeAssetPath(fs::relative(it->path(), _directory, ec).generic_string()));
+        }
+    }
+}
@@ -0,0 +1,220 @@
+/******************************************************************************/
+/*!
+\file		VirtualFileSystem.h
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the declarations for the VirtualFileSystem
+            class, which maps logical asset paths onto prioritized mounts of
+            loose directories, asset packs and patch overlays
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#ifndef _VIRTUALFILESYSTEM_H_
+#define _VIRTUALFILESYSTEM_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <cstdint>
+#include <SOL/AssetManager/AssetPack.h>
+#include <SOL/AssetManager/MappedFile.h>
+
+namespace SOL
+{
+    class VirtualFileSystem
+    {
+    public:
+
+        //Mounts with a higher priority shadow lower ones, equal priorities let the newest mount win
+        static const int s_BasePriority = 0;
+        static const int s_PackPriority = 100;
+        static const int s_PatchPriority = 200;
+
+        /*!**************************************************************************
+        @brief Get the file system shared by the AssetManager and the Serializer.
+
+        On first use the asset root is mounted: the directory named by the
+        SOL_ASSET_ROOT environment variable, or the working directory if it is
+        not set. Its Assets and Json folders are mounted at "Assets" and "Json".
+
+        @return The file system.
+        *****************************************************************************/
+        static VirtualFileSystem& Get();
+
+        /*!**************************************************************************
+        @brief Mount a loose directory.
+
+        The directory is scanned once here, later lookups do not touch the disk.
+
+        @param _directory The directory on disk.
+        @param _mountPoint The logical path the directory appears under.
+        @param _priority The priority of the mount.
+        @return True if the directory was mounted.
+        *****************************************************************************/
+        bool mountDirectory(const std::string& _directory, const std::string& _mountPoint, int _priority = s_BasePriority);
+
+        /*!**************************************************************************
+        @brief Mount an asset pack or patch pack.
+
+        The paths stored in the pack are used as the logical paths.
+
+        @param _packPath The pack file on disk.
+        @param _priority The priority of the mount.
+        @return True if the pack was mounted.
+        *****************************************************************************/
+        bool mountPack(const std::string& _packPath, int _priority = s_PackPriority);
+
+        /*!**************************************************************************
+        @brief Remove a mount and rebuild the resolution cache.
+
+        @param _source The directory or pack file that was mounted.
+        @return True if a mount was removed.
+        *****************************************************************************/
+        bool unmount(const std::string& _source);
+
+        /*!**************************************************************************
+        @brief Rescan every mounted directory and rebuild the resolution cache.
+
+        Only needed when files are added to a mounted directory outside of
+        getWritePath.
+        *****************************************************************************/
+        void refresh();
+
+        /*!**************************************************************************
+        @brief Check if a logical path is provided by any mount.
+
+        @param _filepath The logical path.
+        @return True if a mount provides the file.
+        *****************************************************************************/
+        bool exists(const std::string& _filepath) const;
+
+        /*!**************************************************************************
+        @brief Read a whole file.
+
+        Paths no mount provides are read from disk as they are.
+
+        @param _filepath The logical path.
+        @param _bytes Receives the file contents.
+        @return True if the file was read.
+        *****************************************************************************/
+        bool readFile(const std::string& _filepath, std::vector<uint8_t>& _bytes) const;
+
+        /*!**************************************************************************
+        @brief Read a whole text file.
+
+        @param _filepath The logical path.
+        @param _text Receives the file contents.
+        @return True if the file was read.
+        *****************************************************************************/
+        bool readText(const std::string& _filepath, std::string& _text) const;
+
+        /*!**************************************************************************
+        @brief Map a whole file for parsing in place.
+
+        Files from a mounted directory are mapped copy on write, files inside a
+        pack are decompressed into the MappedFile.
+
+        @param _filepath The logical path.
+        @param _file Receives the file contents.
+        @return True if the file was mapped or read.
+        *****************************************************************************/
+        bool mapFile(const std::string& _filepath, MappedFile& _file) const;
+
+        /*!**************************************************************************
+        @brief Get a file on disk for loaders that only accept a path.
+
+        Files inside a pack are extracted once into the extraction directory,
+        named by content hash. Paths no mount provides are returned as they are.
+
+        @param _filepath The logical path.
+        @return The path on disk to load from.
+        *****************************************************************************/
+        std::string getLoadPath(const std::string& _filepath);
+
+        /*!**************************************************************************
+        @brief Get the file on disk a logical path should be written to.
+
+        Files from a mounted directory are written in place. New files go to the
+        highest priority directory mounted over their path and are added to the
+        resolution cache.
+
+        @param _filepath The logical path.
+        @return The path on disk to write to.
+        *****************************************************************************/
+        std::string getWritePath(const std::string& _filepath);
+
+        /*!**************************************************************************
+        @brief Get the number of logical paths in the resolution cache.
+
+        @return The number of files.
+        *****************************************************************************/
+        size_t getFileCount() const;
+
+    private:
+
+        enum class MountType
+        {
+            DIRECTORY,
+            PACK
+        };
+
+        struct Mount
+        {
+            MountType m_Type;
+            std::string m_Source;                //directory or pack file on disk
+            std::string m_MountPoint;            //normalized, empty or ending in '/'
+            int m_Priority;
+            uint64_t m_Order;                    //mount sequence, breaks priority ties
+            std::vector<std::string> m_Files;    //paths relative to m_Source, directories only
+            AssetPack m_Pack;                    //packs only
+        };
+
+        struct Location
+        {
+            std::shared_ptr<Mount> m_Mount;
+            std::string m_RealPath;              //file on disk, empty until extracted for packs
+            PackEntry m_Entry;                   //packs only
+        };
+
+        /*!**************************************************************************
+        @brief Add the files of a mount to the resolution cache.
+
+        @param _mount The mount to add.
+        *****************************************************************************/
+        void addToCache(const std::shared_ptr<Mount>& _mount);
+
+        /*!**************************************************************************
+        @brief Check if a mount should shadow the current owner of a path.
+
+        @param _mount The new mount.
+        @param _current The mount currently providing the path.
+        @return True if the new mount wins.
+        *****************************************************************************/
+        static bool shadows(const Mount& _mount, const Mount& _current);
+
+        /*!**************************************************************************
+        @brief Scan a directory for files.
+
+        Folders starting with '.' hold generated caches and are skipped.
+
+        @param _directory The directory to scan.
+        @param _files Receives the paths relative to the directory.
+        *****************************************************************************/
+        static void scanDirectory(const std::string& _directory, std::vector<std::string>& _files);
+
+        std::vector<std::shared_ptr<Mount>> m_mounts;
+        std::unordered_map<std::string, Location> m_files;  //NORMALIZED PATH:LOCATION
+        std::string m_extractDir{ "./Assets/.patch/" };
+        uint64_t m_mountCount{};
+        mutable std::shared_mutex m_mutex;                  //workers resolve while the main thread mounts
+    };
+}
+#endif // _VIRTUALFILESYSTEM_H_
@@ -0,0 +1,118 @@
+/******************************************************************************/
+/*!
+\file		WorkerPool.cpp
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the definitions for the WorkerPool class, a
+            small pool of background threads used for asset work that should
+            not block the main thread
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#include "SOLpch.h"
+#include "SOL/AssetManager/WorkerPool.h"
+
+namespace SOL
+{
+    /*!**************************************************************************
+    @brief Constructor for the WorkerPool class.
+
+    Threads are not started until the first job is submitted, so owning a pool
+    costs nothing if it is never used.
+
+    @param _threadCount The number of worker threads, 0 uses one less than the
+                        number of hardware threads.
+    *****************************************************************************/
+    WorkerPool::WorkerPool(unsigned _threadCount)
+        : m_threadCount(_threadCount)
+    {
+        if (m_threadCount == 0)
+        {
+            unsigned hardware = std::thread::hardware_concurrency();
+            m_threadCount = hardware > 1 ? hardware - 1 : 1;
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Destructor for the WorkerPool class.
+
+    Finishes every queued job, then joins the worker threads.
+    *****************************************************************************/
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_jobReady.notify_all();
+
+        for (std::thread& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    /*!**************************************************************************
+    @brief Queue a job to run on a worker thread.
+
+    @param _job The job to run.
+    *****************************************************************************/
+    void WorkerPool::submit(std::function<void()> _job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_threads.empty())
+            {
+                for (unsigned i = 0; i < m_threadCount; ++i)
+                {
+                    m_threads.emplace_back(&WorkerPool::workerLoop, this);
+                }
+            }
+            m_jobs.push_back(std::move(_job));
+        }
+        m_jobReady.notify_one();
+    }
+
+    /*!**************************************************************************
+    @brief Block until every queued job has finished.
+    *****************************************************************************/
+    void WorkerPool::waitIdle()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idle.wait(lock, [this] { return m_jobs.empty() && m_activeJobs == 0; });
+    }
+
+    /*!**************************************************************************
+    @brief Loop run by each worker thread, takes jobs until the pool stops.
+    *****************************************************************************/
+    void WorkerPool::workerLoop()
+    {
+        for (;;)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_jobReady.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+                if (m_jobs.empty())
+                    return;
+
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+                ++m_activeJobs;
+            }
+
+            job();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                --m_activeJobs;
+                if (m_jobs.empty() && m_activeJobs == 0)
+                    m_idle.notify_all();
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/******************************************************************************/
+/*!
+\file		WorkerPool.h
+\author 	Ang Jie Le Jet (100%)
+\date       18 October 2026
+
+\brief		This file consists of the declarations for the WorkerPool class, a
+            small pool of background threads used for asset work that should
+            not block the main thread
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+#ifndef _WORKERPOOL_H_
+#define _WORKERPOOL_H_
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace SOL
+{
+    class WorkerPool
+    {
+    public:
+
+        /*!**************************************************************************
+        @brief Constructor for the WorkerPool class.
+
+        Threads are not started until the first job is submitted, so owning a pool
+        costs nothing if it is never used.
+
+        @param _threadCount The number of worker threads, 0 uses one less than the
+                            number of hardware threads.
+        *****************************************************************************/
+        explicit WorkerPool(unsigned _threadCount = 0);
+
+        /*!**************************************************************************
+        @brief Destructor for the WorkerPool class.
+
+        Finishes every queued job, then joins the worker threads.
+        *****************************************************************************/
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        /*!**************************************************************************
+        @brief Queue a job to run on a worker thread.
+
+        @param _job The job to run.
+        *****************************************************************************/
+        void submit(std::function<void()> _job);
+
+        /*!**************************************************************************
+        @brief Block until every queued job has finished.
+        *****************************************************************************/
+        void waitIdle();
+
+        /*!**************************************************************************
+        @brief Get the number of worker threads.
+
+        @return The number of threads the pool runs once started.
+        *****************************************************************************/
+        unsigned threadCount() const { return m_threadCount; }
+
+    private:
+
+        /*!**************************************************************************
+        @brief Loop run by each worker thread, takes jobs until the pool stops.
+        *****************************************************************************/
+        void workerLoop();
+
+        unsigned m_threadCount;
+        std::vector<std::thread> m_threads;
+        std::deque<std::function<void()>> m_jobs;
+        std::mutex m_mutex;
+        std::condition_variable m_jobReady;
+        std::condition_variable m_idle;
+        size_t m_activeJobs{};
+        bool m_stopping{};
+    };
+}
+#endif // _WORKERPOOL_H_
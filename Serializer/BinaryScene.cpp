@@ -0,0 +1,1327 @@
+/******************************************************************************/
+/*!
+\file		BinaryScene.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the BinaryScene class, the
+		.solscene binary form of a scene JSON and its conversion tools
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "BinaryScene.h"
+#include "Serializer.h"
+#include "MappedJson.h"
+#include "PrefabBaselines.h"
+#include "TileLayers.h"
+#include "SOL/AssetManager/VirtualFileSystem.h"
+
+namespace SOL
+{
+	namespace
+	{
+		const char s_SceneMagic[4] = { 'S', 'S', 'C', 'N' };
+		const char* const s_SceneExtension = ".solscene";
+		const uint32_t s_MaxGenericDepth = 128;
+
+		#pragma pack(push, 1)
+		struct SceneHeader
+		{
+			char m_Magic[4];
+			uint16_t m_FormatVersion;
+			uint16_t m_Reserved;
+			uint32_t m_SchemaVersion;
+			uint32_t m_StringCount;
+			uint32_t m_TypeCount;
+			uint32_t m_EntityCount;
+		};
+		#pragma pack(pop)
+
+		//How a component is stored
+		enum ComponentEncoding : uint8_t
+		{
+			ENCODING_RECORD,	//field table record followed by the keys the table does not know
+			ENCODING_GENERIC,	//the whole component as a generic value
+			ENCODING_COLUMN		//varint row of the type's columns followed by the keys the table does not know
+		};
+
+		//Type tags of generic values
+		enum GenericTag : uint8_t
+		{
+			TAG_NULL,
+			TAG_FALSE,
+			TAG_TRUE,
+			TAG_INT,		//zigzag varint
+			TAG_UINT,		//varint, only for values above INT64_MAX
+			TAG_FLOAT,		//a double that is exactly representable as a float
+			TAG_DOUBLE,
+			TAG_STRING,		//varint length and bytes
+			TAG_ARRAY,		//varint size and values
+			TAG_OBJECT		//varint size and (string table index, value) pairs
+		};
+
+		/*!***********************************************************************
+		\brief		Interns the object keys of generic values
+		*************************************************************************/
+		class SceneStrings
+		{
+		public:
+			uint32_t Intern(const char* text, size_t length)
+			{
+				auto result = m_Lookup.emplace(std::string(text, length), static_cast<uint32_t>(m_Strings.size()));
+				if (result.second)
+					m_Strings.push_back(result.first->first);
+				return result.first->second;
+			}
+
+			std::vector<std::string> m_Strings;
+			std::unordered_map<std::string, uint32_t> m_Lookup;
+		};
+
+		/*!***********************************************************************
+		\brief		Writes a varint length followed by the bytes
+		*************************************************************************/
+		void WriteShortString(BinaryWriter& writer, const char* text, size_t length)
+		{
+			writer.WriteVarint(length);
+			writer.WriteBytes(text, length);
+		}
+
+		/*!***********************************************************************
+		\brief		Reads a string written by WriteShortString
+		*************************************************************************/
+		bool ReadShortString(BinaryReader& reader, std::string& text)
+		{
+			uint64_t length{};
+			if (!reader.ReadVarint(length) || length > reader.GetRemaining())
+				return false;
+			text.assign(reinterpret_cast<const char*>(reader.GetCurrent()), static_cast<size_t>(length));
+			return reader.Skip(static_cast<size_t>(length));
+		}
+
+		/*!***********************************************************************
+		\brief		Writes any JSON value
+		*************************************************************************/
+		void WriteGeneric(BinaryWriter& writer, const JsonValue& value, SceneStrings& strings)
+		{
+			switch (value.GetType())
+			{
+			case rapidjson::kNullType:
+				writer.Write(static_cast<uint8_t>(TAG_NULL));
+				break;
+			case rapidjson::kFalseType:
+				writer.Write(static_cast<uint8_t>(TAG_FALSE));
+				break;
+			case rapidjson::kTrueType:
+				writer.Write(static_cast<uint8_t>(TAG_TRUE));
+				break;
+			case rapidjson::kNumberType:
+				if (value.IsInt64())
+				{
+					writer.Write(static_cast<uint8_t>(TAG_INT));
+					writer.WriteSignedVarint(value.GetInt64());
+				}
+				else if (value.IsUint64())
+				{
+					writer.Write(static_cast<uint8_t>(TAG_UINT));
+					writer.WriteVarint(value.GetUint64());
+				}
+				else if (static_cast<double>(static_cast<float>(value.GetDouble())) == value.GetDouble())
+				{
+					writer.Write(static_cast<uint8_t>(TAG_FLOAT));
+					writer.Write(static_cast<float>(value.GetDouble()));
+				}
+				else
+				{
+					writer.Write(static_cast<uint8_t>(TAG_DOUBLE));
+					writer.Write(value.GetDouble());
+				}
+				break;
+			case rapidjson::kStringType:
+				writer.Write(static_cast<uint8_t>(TAG_STRING));
+				WriteShortString(writer, value.GetString(), value.GetStringLength());
+				break;
+			case rapidjson::kArrayType:
+				writer.Write(static_cast<uint8_t>(TAG_ARRAY));
+				writer.WriteVarint(value.Size());
+				for (const auto& element : value.GetArray())
+				{
+					WriteGeneric(writer, element, strings);
+				}
+				break;
+			case rapidjson::kObjectType:
+				writer.Write(static_cast<uint8_t>(TAG_OBJECT));
+				writer.WriteVarint(value.MemberCount());
+				for (auto it = value.MemberBegin(); it != value.MemberEnd(); ++it)
+				{
+					writer.WriteVarint(strings.Intern(it->name.GetString(), it->name.GetStringLength()));
+					WriteGeneric(writer, it->value, strings);
+				}
+				break;
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Reads a value written by WriteGeneric
+		*************************************************************************/
+		bool ReadGeneric(BinaryReader& reader, const std::vector<std::string>& strings, rapidjson::Value& value,
+			rapidjson::Document::AllocatorType& allocator, uint32_t depth = 0)
+		{
+			uint8_t tag{};
+			if (depth > s_MaxGenericDepth || !reader.Read(tag))
+				return false;
+
+			switch (tag)
+			{
+			case TAG_NULL:
+				value.SetNull();
+				return true;
+			case TAG_FALSE:
+			case TAG_TRUE:
+				value.SetBool(tag == TAG_TRUE);
+				return true;
+			case TAG_INT:
+			{
+				int64_t number{};
+				if (!reader.ReadSignedVarint(number))
+					return false;
+				value.SetInt64(number);
+				return true;
+			}
+			case TAG_UINT:
+			{
+				uint64_t number{};
+				if (!reader.ReadVarint(number))
+					return false;
+				value.SetUint64(number);
+				return true;
+			}
+			case TAG_FLOAT:
+			{
+				float number{};
+				if (!reader.Read(number))
+					return false;
+				value.SetDouble(number);
+				return true;
+			}
+			case TAG_DOUBLE:
+			{
+				double number{};
+				if (!reader.Read(number))
+					return false;
+				value.SetDouble(number);
+				return true;
+			}
+			case TAG_STRING:
+			{
+				uint64_t length{};
+				if (!reader.ReadVarint(length) || length > reader.GetRemaining())
+					return false;
+				value.SetString(reinterpret_cast<const char*>(reader.GetCurrent()), static_cast<rapidjson::SizeType>(length), allocator);
+				return reader.Skip(static_cast<size_t>(length));
+			}
+			case TAG_ARRAY:
+			{
+				uint64_t size{};
+				if (!reader.ReadVarint(size) || size > reader.GetRemaining())
+					return false;
+				value.SetArray();
+				value.Reserve(static_cast<rapidjson::SizeType>(size), allocator);
+				for (uint64_t i = 0; i < size; ++i)
+				{
+					rapidjson::Value element;
+					if (!ReadGeneric(reader, strings, element, allocator, depth + 1))
+						return false;
+					value.PushBack(element, allocator);
+				}
+				return true;
+			}
+			case TAG_OBJECT:
+			{
+				uint64_t size{};
+				if (!reader.ReadVarint(size) || size > reader.GetRemaining())
+					return false;
+				value.SetObject();
+				for (uint64_t i = 0; i < size; ++i)
+				{
+					uint64_t key{};
+					rapidjson::Value member;
+					if (!reader.ReadVarint(key) || key >= strings.size() ||
+						!ReadGeneric(reader, strings, member, allocator, depth + 1))
+					{
+						return false;
+					}
+					rapidjson::Value name(strings[key].c_str(), static_cast<rapidjson::SizeType>(strings[key].size()), allocator);
+					value.AddMember(name, member, allocator);
+				}
+				return true;
+			}
+			default:
+				return false;
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Steps over a value written by WriteGeneric
+		*************************************************************************/
+		bool SkipGeneric(BinaryReader& reader, uint32_t depth = 0)
+		{
+			uint8_t tag{};
+			uint64_t number{};
+			if (depth > s_MaxGenericDepth || !reader.Read(tag))
+				return false;
+
+			switch (tag)
+			{
+			case TAG_NULL:
+			case TAG_FALSE:
+			case TAG_TRUE:
+				return true;
+			case TAG_INT:
+			case TAG_UINT:
+				return reader.ReadVarint(number);
+			case TAG_FLOAT:
+				return reader.Skip(sizeof(float));
+			case TAG_DOUBLE:
+				return reader.Skip(sizeof(double));
+			case TAG_STRING:
+				return reader.ReadVarint(number) && reader.Skip(static_cast<size_t>(number));
+			case TAG_ARRAY:
+			case TAG_OBJECT:
+				if (!reader.ReadVarint(number))
+					return false;
+				for (uint64_t i = 0; i < number; ++i)
+				{
+					uint64_t key{};
+					if ((tag == TAG_OBJECT && !reader.ReadVarint(key)) || !SkipGeneric(reader, depth + 1))
+						return false;
+				}
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Writes a decoded component as the JSON object the field table
+					writes, plus the unknown keys that follow in the reader
+		*************************************************************************/
+		bool ComponentToJson(const ComponentDescriptor& descriptor, const Components& component, BinaryReader& reader,
+			const std::vector<std::string>& strings, rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator)
+		{
+			rapidjson::StringBuffer buffer;
+			JsonWriter writer(buffer);
+			descriptor.WriteJson(writer, component);
+
+			JsonParseContext::Lease context = JsonParseContext::Acquire();
+			const JsonParseContext::Document& parsed = context->Parse(buffer.GetString(), buffer.GetSize());
+			if (parsed.HasParseError())
+				return false;
+			value.CopyFrom(parsed, allocator);
+
+			uint64_t extraCount{};
+			if (!reader.ReadVarint(extraCount))
+				return false;
+			for (uint64_t i = 0; i < extraCount; ++i)
+			{
+				uint64_t key{};
+				rapidjson::Value member;
+				if (!reader.ReadVarint(key) || key >= strings.size() || !ReadGeneric(reader, strings, member, allocator))
+					return false;
+				rapidjson::Value name(strings[key].c_str(), static_cast<rapidjson::SizeType>(strings[key].size()), allocator);
+				value.AddMember(name, member, allocator);
+			}
+			return true;
+		}
+
+		/*!***********************************************************************
+		\brief		Decodes a record written by EncodeRecord back to the JSON
+					object the field table writes, plus the unknown keys
+		*************************************************************************/
+		bool DecodeRecord(const ComponentDescriptor& descriptor, BinaryReader& reader, const std::vector<std::string>& strings,
+			rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator)
+		{
+			Prefab scratch;
+			Components* component = scratch.CreateComponentByID(descriptor.GetID());
+			if (component == nullptr || !descriptor.ReadBinary(reader, *component))
+				return false;
+			return ComponentToJson(descriptor, *component, reader, strings, value, allocator);
+		}
+
+		/*!***********************************************************************
+		\brief		Encodes a described component as its field table record and
+					the keys the table does not know. Fails if decoding the record
+					would not give back the same object, e.g. a missing key or a
+					value the field type cannot hold exactly.
+		*************************************************************************/
+		bool EncodeRecord(const ComponentDescriptor& descriptor, const JsonValue& value, SceneStrings& strings, BinaryWriter& record)
+		{
+			if (!value.IsObject())
+				return false;
+
+			Prefab scratch;
+			Components* component = scratch.CreateComponentByID(descriptor.GetID());
+			if (component == nullptr)
+				return false;
+			descriptor.ReadJson(value, *component);
+			descriptor.WriteBinary(record, *component);
+
+			std::vector<const JsonValue*> extraKeys;
+			std::vector<const JsonValue*> extraValues;
+			size_t cursor = 0;
+			for (auto it = value.MemberBegin(); it != value.MemberEnd(); ++it)
+			{
+				//WriteJson puts the version back itself
+				if (std::strcmp(it->name.GetString(), ComponentDescriptor::s_VersionKey) == 0)
+					continue;
+				if (descriptor.FindField(it->name.GetString(), it->name.GetStringLength(), cursor) == nullptr)
+				{
+					extraKeys.push_back(&it->name);
+					extraValues.push_back(&it->value);
+				}
+			}
+
+			record.WriteVarint(extraKeys.size());
+			for (size_t i = 0; i < extraKeys.size(); ++i)
+			{
+				record.WriteVarint(strings.Intern(extraKeys[i]->GetString(), extraKeys[i]->GetStringLength()));
+				WriteGeneric(record, *extraValues[i], strings);
+			}
+
+			rapidjson::Document decoded;
+			BinaryReader reader(record.GetBytes().data(), record.GetBytes().size());
+			if (!DecodeRecord(descriptor, reader, strings.m_Strings, decoded, decoded.GetAllocator()) || reader.GetRemaining() != 0)
+				return false;
+			return decoded == value;
+		}
+
+		/*!***********************************************************************
+		\brief		Gets the size of one value in a column, 0 for CUSTOM fields
+		*************************************************************************/
+		size_t GetColumnWidth(FieldType type)
+		{
+			switch (type)
+			{
+			case FieldType::INT:
+			case FieldType::UINT:
+			case FieldType::FLOAT:
+			case FieldType::STRING:	return sizeof(uint32_t);
+			case FieldType::UINT64:	return sizeof(uint64_t);
+			case FieldType::BOOL:	return sizeof(uint8_t);
+			default:				return 0;
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Checks if every field of a component can be stored as a column
+		*************************************************************************/
+		bool HasColumns(const ComponentDescriptor& descriptor)
+		{
+			for (const FieldInfo& field : descriptor.GetFields())
+			{
+				if (field.m_Type == FieldType::CUSTOM)
+					return false;
+			}
+			return true;
+		}
+
+		/*!***********************************************************************
+		\brief		Pads a writer or steps a reader to the next column boundary,
+					both positioned relative to the start of the file
+		*************************************************************************/
+		void AlignColumn(BinaryWriter& writer)
+		{
+			while (writer.GetBytes().size() % BinaryScene::s_ColumnAlignment != 0)
+			{
+				writer.Write(static_cast<uint8_t>(0));
+			}
+		}
+
+		bool AlignColumn(BinaryReader& reader)
+		{
+			const size_t misalignment = reader.GetOffset() % BinaryScene::s_ColumnAlignment;
+			return misalignment == 0 || reader.Skip(BinaryScene::s_ColumnAlignment - misalignment);
+		}
+
+		/*!***********************************************************************
+		\brief		The columns of one component type while encoding
+		*************************************************************************/
+		struct ColumnBuilder
+		{
+			uint32_t m_TypeIndex;
+			std::vector<uint32_t> m_Entities;
+			std::vector<BinaryWriter> m_Columns;	//one per field element, in table order
+		};
+
+		/*!***********************************************************************
+		\brief		Appends a component as the next row of its type's columns
+		*************************************************************************/
+		void AppendRow(const ComponentDescriptor& descriptor, const Components& component, SceneStrings& strings, ColumnBuilder& builder)
+		{
+			size_t column = 0;
+			FieldValue value;
+			for (const FieldInfo& field : descriptor.GetFields())
+			{
+				for (uint32_t i = 0; i < field.m_Count; ++i)
+				{
+					field.m_Get(component, i, value);
+					BinaryWriter& writer = builder.m_Columns[column++];
+					switch (field.m_Type)
+					{
+					case FieldType::INT:	writer.Write(static_cast<int32_t>(value.AsInt())); break;
+					case FieldType::UINT:	writer.Write(static_cast<uint32_t>(value.AsUint())); break;
+					case FieldType::UINT64:	writer.Write(value.AsUint()); break;
+					case FieldType::FLOAT:	writer.Write(static_cast<float>(value.AsFloat())); break;
+					case FieldType::BOOL:	writer.Write(static_cast<uint8_t>(value.AsUint() != 0)); break;
+					case FieldType::STRING:	writer.Write(strings.Intern(value.m_String.c_str(), value.m_String.size())); break;
+					default: break;
+					}
+				}
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Reads one value of a column written by AppendRow
+		\return		False for a string index outside the string table
+		*************************************************************************/
+		bool ReadColumnValue(const uint8_t* column, FieldType type, size_t row, const std::vector<std::string>& strings, FieldValue& value)
+		{
+			const uint8_t* data = column + row * GetColumnWidth(type);
+			switch (type)
+			{
+			case FieldType::INT:
+			{
+				int32_t number{};
+				std::memcpy(&number, data, sizeof(number));
+				value.m_Kind = FieldValue::Kind::INT;
+				value.m_Int = number;
+				return true;
+			}
+			case FieldType::UINT:
+			{
+				uint32_t number{};
+				std::memcpy(&number, data, sizeof(number));
+				value.m_Kind = FieldValue::Kind::UINT;
+				value.m_Uint = number;
+				return true;
+			}
+			case FieldType::UINT64:
+				std::memcpy(&value.m_Uint, data, sizeof(value.m_Uint));
+				value.m_Kind = FieldValue::Kind::UINT;
+				return true;
+			case FieldType::FLOAT:
+			{
+				float number{};
+				std::memcpy(&number, data, sizeof(number));
+				value.m_Kind = FieldValue::Kind::FLOAT;
+				value.m_Float = number;
+				return true;
+			}
+			case FieldType::BOOL:
+				value.m_Kind = FieldValue::Kind::UINT;
+				value.m_Uint = *data;
+				return true;
+			case FieldType::STRING:
+			{
+				uint32_t index{};
+				std::memcpy(&index, data, sizeof(index));
+				if (index >= strings.size())
+					return false;
+				value.m_Kind = FieldValue::Kind::STRING;
+				value.m_String = strings[index];
+				return true;
+			}
+			default:
+				return false;
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Writes bytes to a file on disk
+		*************************************************************************/
+		bool WriteFileBytes(const std::string& filePath, const void* data, size_t size)
+		{
+			std::ofstream file(filePath, std::ios::binary);
+			if (!file.is_open())
+			{
+				ENGINE_ERROR("Could not open " + filePath + " for writing.");
+				return false;
+			}
+			file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+			return file.good();
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Check if a scene path names a binary scene
+	*************************************************************************/
+	bool BinaryScene::IsBinaryScene(const std::string& filePath)
+	{
+		return std::filesystem::path(filePath).extension() == s_SceneExtension;
+	}
+
+	/*!***********************************************************************
+	\brief		Get the binary scene path for a scene JSON path
+	*************************************************************************/
+	std::string BinaryScene::GetBinaryPath(const std::string& jsonPath)
+	{
+		return std::filesystem::path(jsonPath).replace_extension(s_SceneExtension).string();
+	}
+
+	/*!***********************************************************************
+	\brief		Encode a parsed scene JSON
+	*************************************************************************/
+	bool BinaryScene::Encode(const JsonValue& scene, std::vector<uint8_t>& bytes, bool columns)
+	{
+		if (!scene.IsObject())
+			return false;
+		auto entities = scene.FindMember("Entities");
+		if (entities == scene.MemberEnd() || !entities->value.IsArray())
+			return false;
+
+		// Entities are read back by index, so tile layer blocks are stored expanded, the columns already share their fields
+		if (scene.HasMember(TileLayers::s_TileLayersKey))
+		{
+			rapidjson::Document expanded;
+			expanded.CopyFrom(scene, expanded.GetAllocator());
+			TileLayers::Expand(expanded);
+			return Encode(expanded, bytes, columns);
+		}
+
+		SceneStrings strings;
+		std::vector<std::string> typeNames;
+		std::unordered_map<std::string, uint32_t> typeIndices;
+		BinaryWriter body;
+
+		//Scene data, every top level member but the entities
+		body.Write(static_cast<uint8_t>(TAG_OBJECT));
+		body.WriteVarint(scene.MemberCount() - 1);
+		for (auto it = scene.MemberBegin(); it != scene.MemberEnd(); ++it)
+		{
+			if (it == entities)
+				continue;
+			body.WriteVarint(strings.Intern(it->name.GetString(), it->name.GetStringLength()));
+			WriteGeneric(body, it->value, strings);
+		}
+
+		//Entities, written after the columns they fill
+		BinaryWriter entityBody;
+		BinaryWriter record;
+		std::vector<ColumnBuilder> builders;
+		std::unordered_map<uint32_t, size_t> builderIndices;
+		uint32_t entityIndex = 0;
+		for (const auto& entity : entities->value.GetArray())
+		{
+			if (!entity.IsObject())
+			{
+				ENGINE_ERROR("Scene entity is not an object, the scene was not converted.");
+				return false;
+			}
+
+			entityBody.WriteVarint(entity.MemberCount());
+			for (auto it = entity.MemberBegin(); it != entity.MemberEnd(); ++it)
+			{
+				const std::string typeName(it->name.GetString(), it->name.GetStringLength());
+				auto type = typeIndices.emplace(typeName, static_cast<uint32_t>(typeNames.size()));
+				if (type.second)
+					typeNames.push_back(typeName);
+
+				record.GetBytes().clear();
+				uint8_t encoding = ENCODING_RECORD;
+				const ComponentDescriptor* descriptor = ComponentReflection::FindDescriptor(typeName);
+				if (descriptor == nullptr || !EncodeRecord(*descriptor, it->value, strings, record))
+				{
+					record.GetBytes().clear();
+					encoding = ENCODING_GENERIC;
+					WriteGeneric(record, it->value, strings);
+				}
+				else if (columns && HasColumns(*descriptor))
+				{
+					//Move the record into the columns, the unknown keys stay with the entity
+					Prefab scratch;
+					Components* component = scratch.CreateComponentByID(descriptor->GetID());
+					BinaryReader reader(record.GetBytes().data(), record.GetBytes().size());
+					if (component != nullptr && descriptor->ReadBinary(reader, *component))
+					{
+						auto builder = builderIndices.emplace(type.first->second, builders.size());
+						if (builder.second)
+						{
+							size_t columnCount = 0;
+							for (const FieldInfo& field : descriptor->GetFields())
+							{
+								columnCount += field.m_Count;
+							}
+							builders.push_back(ColumnBuilder{ type.first->second, {}, std::vector<BinaryWriter>(columnCount) });
+						}
+
+						ColumnBuilder& target = builders[builder.first->second];
+						const std::vector<uint8_t> unknownKeys(reader.GetCurrent(), reader.GetCurrent() + reader.GetRemaining());
+						record.GetBytes().clear();
+						record.WriteVarint(target.m_Entities.size());
+						record.WriteBytes(unknownKeys.data(), unknownKeys.size());
+
+						target.m_Entities.push_back(entityIndex);
+						AppendRow(*descriptor, *component, strings, target);
+						encoding = ENCODING_COLUMN;
+					}
+				}
+
+				entityBody.WriteVarint(type.first->second);
+				entityBody.Write(encoding);
+				entityBody.WriteVarint(record.GetBytes().size());
+				entityBody.WriteBytes(record.GetBytes().data(), record.GetBytes().size());
+			}
+			++entityIndex;
+		}
+
+		//Columns, the body starts on a column boundary so offsets in it line up with the file
+		body.WriteVarint(builders.size());
+		for (const ColumnBuilder& builder : builders)
+		{
+			body.WriteVarint(builder.m_TypeIndex);
+			body.WriteVarint(builder.m_Entities.size());
+			AlignColumn(body);
+			body.WriteBytes(builder.m_Entities.data(), builder.m_Entities.size() * sizeof(uint32_t));
+			for (const BinaryWriter& column : builder.m_Columns)
+			{
+				AlignColumn(body);
+				body.WriteBytes(column.GetBytes().data(), column.GetBytes().size());
+			}
+		}
+		body.WriteBytes(entityBody.GetBytes().data(), entityBody.GetBytes().size());
+
+		//Header, string table and component table go in front of the body
+		BinaryWriter file;
+		SceneHeader header{};
+		std::memcpy(header.m_Magic, s_SceneMagic, sizeof(s_SceneMagic));
+		header.m_FormatVersion = s_FormatVersion;
+		header.m_SchemaVersion = s_SchemaVersion;
+		header.m_StringCount = static_cast<uint32_t>(strings.m_Strings.size());
+		header.m_TypeCount = static_cast<uint32_t>(typeNames.size());
+		header.m_EntityCount = static_cast<uint32_t>(entities->value.Size());
+		file.Write(header);
+
+		for (const std::string& text : strings.m_Strings)
+		{
+			WriteShortString(file, text.c_str(), text.size());
+		}
+
+		for (const std::string& typeName : typeNames)
+		{
+			WriteShortString(file, typeName.c_str(), typeName.size());
+
+			const ComponentDescriptor* descriptor = ComponentReflection::FindDescriptor(typeName);
+			file.Write(static_cast<uint8_t>(descriptor != nullptr));
+			if (descriptor == nullptr)
+				continue;
+
+			file.WriteVarint(descriptor->GetVersion());
+			file.WriteVarint(descriptor->GetFields().size());
+			for (const FieldInfo& field : descriptor->GetFields())
+			{
+				WriteShortString(file, field.m_Key, std::strlen(field.m_Key));
+				file.Write(static_cast<uint8_t>(field.m_Type));
+				file.WriteVarint(field.m_Count);
+				file.WriteVarint(field.m_ID);
+			}
+		}
+		AlignColumn(file);
+
+		bytes = std::move(file.GetBytes());
+		bytes.insert(bytes.end(), body.GetBytes().begin(), body.GetBytes().end());
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Convert a scene JSON file to a binary scene file
+	*************************************************************************/
+	bool BinaryScene::ConvertJsonToBinary(const std::string& jsonPath, const std::string& binaryPath)
+	{
+		MappedJson json;
+		if (!json.Open(jsonPath))
+			return false;
+
+		const JsonParseContext::Document& scene = json.GetDocument();
+		if (scene.HasParseError())
+		{
+			ENGINE_ERROR(jsonPath + " is not valid JSON.");
+			return false;
+		}
+
+		std::vector<uint8_t> bytes;
+		if (!Encode(scene, bytes))
+		{
+			ENGINE_ERROR(jsonPath + " is not a scene.");
+			return false;
+		}
+
+		ENGINE_INFO(jsonPath + ": " + std::to_string(json.GetFileSize()) + " bytes of JSON, " + std::to_string(bytes.size()) + " bytes binary");
+		return WriteFileBytes(binaryPath, bytes.data(), bytes.size());
+	}
+
+	/*!***********************************************************************
+	\brief		Convert a binary scene file back to scene JSON
+	*************************************************************************/
+	bool BinaryScene::ConvertBinaryToJson(const std::string& binaryPath, const std::string& jsonPath)
+	{
+		BinaryScene binary;
+		rapidjson::Document scene;
+		if (!binary.Open(binaryPath) || !binary.Decode(scene))
+		{
+			ENGINE_ERROR("Could not decode " + binaryPath);
+			return false;
+		}
+
+		rapidjson::StringBuffer buffer;
+		JsonWriter writer(buffer);
+		scene.Accept(writer);
+		return WriteFileBytes(jsonPath, buffer.GetString(), buffer.GetSize());
+	}
+
+	/*!***********************************************************************
+	\brief		Convert every scene JSON in a directory
+	*************************************************************************/
+	size_t BinaryScene::ConvertSceneDirectory(const std::string& directory)
+	{
+		size_t converted = 0;
+		std::error_code error;
+		for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+		{
+			if (!entry.is_regular_file() || entry.path().extension() != ".json")
+				continue;
+
+			const std::string jsonPath = entry.path().string();
+			if (ConvertJsonToBinary(jsonPath, GetBinaryPath(jsonPath)))
+				++converted;
+		}
+		return converted;
+	}
+
+	/*!***********************************************************************
+	\brief		Read a binary scene file
+	*************************************************************************/
+	bool BinaryScene::Open(const std::string& filePath)
+	{
+		if (!VirtualFileSystem::Get().mapFile(filePath, m_file))
+		{
+			ENGINE_ERROR("Could not open the file: " + filePath);
+			return false;
+		}
+		if (!ReadTables())
+		{
+			ENGINE_ERROR(filePath + " is not a valid binary scene.");
+			return false;
+		}
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Take ownership of a binary scene in memory, reading the tables
+				and indexing the entities
+	*************************************************************************/
+	bool BinaryScene::Load(std::vector<uint8_t> bytes)
+	{
+		m_file.adopt(std::move(bytes));
+		return ReadTables();
+	}
+
+	/*!***********************************************************************
+	\brief		Read the tables and index the entities of the bytes in m_file
+	*************************************************************************/
+	bool BinaryScene::ReadTables()
+	{
+		m_strings.clear();
+		m_types.clear();
+		m_entityOffsets.clear();
+
+		BinaryReader reader(GetData(), m_file.size());
+		SceneHeader header{};
+		if (!reader.Read(header) || std::memcmp(header.m_Magic, s_SceneMagic, sizeof(s_SceneMagic)) != 0 ||
+			header.m_FormatVersion == 0 || header.m_FormatVersion > s_FormatVersion)
+		{
+			return false;
+		}
+		if (header.m_SchemaVersion != s_SchemaVersion)
+		{
+			ENGINE_WARN("Binary scene written with schema version " + std::to_string(header.m_SchemaVersion) +
+				", component tables are checked per type.");
+		}
+
+		m_strings.resize(std::min<size_t>(header.m_StringCount, reader.GetRemaining()));
+		if (m_strings.size() != header.m_StringCount)
+			return false;
+		for (std::string& text : m_strings)
+		{
+			if (!ReadShortString(reader, text))
+				return false;
+		}
+
+		for (uint32_t t = 0; t < header.m_TypeCount; ++t)
+		{
+			ComponentType type{};
+			bool columnar = true;
+			uint8_t described{};
+			if (!ReadShortString(reader, type.m_Name) || !reader.Read(described))
+				return false;
+
+			type.m_ID = ComponentReflection::FindComponentID(type.m_Name);
+			const ComponentDescriptor* descriptor = ComponentReflection::GetDescriptor(type.m_ID);
+			type.m_Version = 1;
+			type.m_SchemaMatches = descriptor != nullptr;
+			type.m_Upgradable = descriptor != nullptr && described;
+
+			if (described)
+			{
+				uint64_t version = 1, fieldCount{};
+				if ((header.m_FormatVersion >= 3 && !reader.ReadVarint(version)) || !reader.ReadVarint(fieldCount))
+					return false;
+				type.m_Version = static_cast<uint32_t>(version);
+				if (descriptor != nullptr && (fieldCount != descriptor->GetFields().size() || type.m_Version != descriptor->GetVersion()))
+					type.m_SchemaMatches = false;
+
+				size_t cursor = 0;
+				for (uint64_t f = 0; f < fieldCount; ++f)
+				{
+					std::string key;
+					uint8_t fieldType{};
+					uint64_t count{}, id{};
+					if (!ReadShortString(reader, key) || !reader.Read(fieldType) || !reader.ReadVarint(count) ||
+						count > reader.GetRemaining() || (header.m_FormatVersion >= 3 && !reader.ReadVarint(id)))
+					{
+						return false;
+					}
+
+					//Fields are matched by ID, files from before IDs by key and alias
+					if (descriptor != nullptr)
+					{
+						const FieldInfo* target = header.m_FormatVersion >= 3 ? descriptor->FindFieldByID(static_cast<uint32_t>(id)) :
+							descriptor->FindField(key.c_str(), key.size(), cursor);
+						const FieldType from = static_cast<FieldType>(fieldType);
+						if (target != nullptr && ((target->m_Type == FieldType::CUSTOM) != (from == FieldType::CUSTOM) ||
+							(target->m_Type == FieldType::STRING) != (from == FieldType::STRING)))
+						{
+							target = nullptr;
+						}
+						//A CUSTOM field with no reader cannot be skipped, its size is unknown
+						if (from == FieldType::CUSTOM && target == nullptr)
+							type.m_Upgradable = false;
+						type.m_Fields.push_back(FileField{ from, static_cast<uint32_t>(count), target });
+					}
+
+					//The columns follow the file's table, so they can be read even if this build's differs
+					columnar = columnar && GetColumnWidth(static_cast<FieldType>(fieldType)) != 0;
+					for (uint32_t i = 0; columnar && i < count; ++i)
+					{
+						type.m_Columns.push_back(Column{ key, static_cast<FieldType>(fieldType), i, 0 });
+					}
+
+					if (type.m_SchemaMatches)
+					{
+						const FieldInfo& field = descriptor->GetFields()[static_cast<size_t>(f)];
+						type.m_SchemaMatches = key == field.m_Key && fieldType == static_cast<uint8_t>(field.m_Type) && count == field.m_Count &&
+							(header.m_FormatVersion < 3 || id == field.m_ID);
+					}
+				}
+
+				if (type.m_SchemaMatches)
+				{
+					type.m_Fields.clear();
+				}
+				else if (type.m_Upgradable)
+				{
+					ENGINE_INFO(type.m_Name + " records were written with an older field table, they are upgraded as they load.");
+				}
+				else
+				{
+					ENGINE_ERROR(type.m_Name + " records were written with a field table that cannot be upgraded, re-export the scene.");
+				}
+			}
+			if (!described || !columnar)
+				type.m_Columns.clear();
+			m_types.push_back(std::move(type));
+		}
+		if (header.m_FormatVersion >= 2 && !AlignColumn(reader))
+			return false;
+
+		m_sceneDataOffset = reader.GetOffset();
+		if (!SkipGeneric(reader))
+			return false;
+
+		uint64_t columnTypeCount{};
+		if (header.m_FormatVersion >= 2 && !reader.ReadVarint(columnTypeCount))
+			return false;
+		for (uint64_t t = 0; t < columnTypeCount; ++t)
+		{
+			uint64_t typeIndex{}, rows{};
+			if (!reader.ReadVarint(typeIndex) || typeIndex >= m_types.size() || !reader.ReadVarint(rows) ||
+				rows > reader.GetRemaining())
+			{
+				return false;
+			}
+
+			ComponentType& type = m_types[static_cast<size_t>(typeIndex)];
+			if (type.m_Columns.empty() || type.m_Rows != 0)
+				return false;
+			type.m_Rows = static_cast<size_t>(rows);
+
+			if (!AlignColumn(reader))
+				return false;
+			type.m_EntityOffset = reader.GetOffset();
+			if (!reader.Skip(type.m_Rows * sizeof(uint32_t)))
+				return false;
+
+			for (Column& column : type.m_Columns)
+			{
+				if (!AlignColumn(reader))
+					return false;
+				column.m_Offset = reader.GetOffset();
+				if (!reader.Skip(type.m_Rows * GetColumnWidth(column.m_Type)))
+					return false;
+			}
+		}
+
+		m_entityOffsets.reserve(std::min<size_t>(header.m_EntityCount, reader.GetRemaining()));
+		for (uint32_t e = 0; e < header.m_EntityCount; ++e)
+		{
+			m_entityOffsets.push_back(reader.GetOffset());
+
+			uint64_t componentCount{};
+			if (!reader.ReadVarint(componentCount))
+				return false;
+			for (uint64_t c = 0; c < componentCount; ++c)
+			{
+				uint64_t typeIndex{}, size{};
+				uint8_t encoding{};
+				if (!reader.ReadVarint(typeIndex) || typeIndex >= m_types.size() || !reader.Read(encoding) ||
+					!reader.ReadVarint(size) || !reader.Skip(static_cast<size_t>(size)))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Get the top level members of the scene except "Entities"
+	*************************************************************************/
+	bool BinaryScene::GetSceneData(rapidjson::Document& data) const
+	{
+		BinaryReader reader(GetData() + m_sceneDataOffset, m_file.size() - m_sceneDataOffset);
+		return ReadGeneric(reader, m_strings, data, data.GetAllocator()) && data.IsObject();
+	}
+
+	/*!***********************************************************************
+	\brief		Deserialize one entity into a prefab
+	*************************************************************************/
+	bool BinaryScene::DeserializeEntity(Serializer& serializer, size_t index, Prefab& prefab) const
+	{
+		if (index >= m_entityOffsets.size())
+			return false;
+
+		BinaryReader reader(GetData() + m_entityOffsets[index], m_file.size() - m_entityOffsets[index]);
+		uint64_t componentCount{};
+		if (!reader.ReadVarint(componentCount))
+			return false;
+
+		for (uint64_t c = 0; c < componentCount; ++c)
+		{
+			uint64_t typeIndex{}, size{};
+			uint8_t encoding{};
+			if (!reader.ReadVarint(typeIndex) || typeIndex >= m_types.size() || !reader.Read(encoding) ||
+				!reader.ReadVarint(size) || size > reader.GetRemaining())
+			{
+				return false;
+			}
+
+			BinaryReader record(reader.GetCurrent(), static_cast<size_t>(size));
+			reader.Skip(static_cast<size_t>(size));
+
+			const ComponentType& type = m_types[static_cast<size_t>(typeIndex)];
+			if (type.m_ID == ComponentTypeID::INVALID && type.m_Name == PrefabBaselines::s_PrefabKey && encoding != ENCODING_RECORD)
+			{
+				//Written before the components, as the JSON writer does
+				rapidjson::Document source;
+				if (!ReadGeneric(record, m_strings, source, source.GetAllocator()))
+					return false;
+				if (source.IsString() && !PrefabBaselines::Get().Apply(serializer, source.GetString(), prefab))
+					ENGINE_ERROR("Prefab baseline could not be loaded");
+				continue;
+			}
+
+			Components* component = prefab.CreateComponentByID(type.m_ID);
+			if (component == nullptr)
+			{
+				ENGINE_ERROR("Unknown component type");
+				continue;
+			}
+
+			if (encoding == ENCODING_RECORD)
+			{
+				//The keys after the record are ones this build does not read, as with JSON
+				if (!type.m_SchemaMatches && !type.m_Upgradable)
+					continue;
+				prefab.AddComponent(type.m_Name, *component);
+				if (type.m_SchemaMatches ? !serializer.DeserializeBinary(record, *component, type.m_ID) : !UpgradeRecord(type, record, *component))
+					return false;
+			}
+			else if (encoding == ENCODING_COLUMN)
+			{
+				uint64_t row{};
+				if (!record.ReadVarint(row) || row >= type.m_Rows)
+					return false;
+				if (!type.m_SchemaMatches && !type.m_Upgradable)
+					continue;
+				prefab.AddComponent(type.m_Name, *component);
+				if (!ReadRow(type, static_cast<size_t>(row), *component))
+					return false;
+			}
+			else
+			{
+				rapidjson::Document value;
+				if (!ReadGeneric(record, m_strings, value, value.GetAllocator()))
+					return false;
+				prefab.AddComponent(type.m_Name, *component);
+				serializer.Deserialize(value, *component, type.m_ID);
+			}
+		}
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Decode one component of an entity into a JSON value
+	*************************************************************************/
+	int64_t BinaryScene::DecodeComponent(BinaryReader& reader, rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator) const
+	{
+		uint64_t typeIndex{}, size{};
+		uint8_t encoding{};
+		if (!reader.ReadVarint(typeIndex) || typeIndex >= m_types.size() || !reader.Read(encoding) ||
+			!reader.ReadVarint(size) || size > reader.GetRemaining())
+		{
+			return -1;
+		}
+
+		BinaryReader record(reader.GetCurrent(), static_cast<size_t>(size));
+		reader.Skip(static_cast<size_t>(size));
+
+		const ComponentType& type = m_types[static_cast<size_t>(typeIndex)];
+		if (encoding == ENCODING_RECORD)
+		{
+			const ComponentDescriptor* descriptor = ComponentReflection::GetDescriptor(type.m_ID);
+			if (descriptor == nullptr || (!type.m_SchemaMatches && !type.m_Upgradable))
+				return -1;
+			if (type.m_SchemaMatches)
+			{
+				if (!DecodeRecord(*descriptor, record, m_strings, value, allocator))
+					return -1;
+			}
+			else
+			{
+				Prefab scratch;
+				Components* component = scratch.CreateComponentByID(type.m_ID);
+				if (component == nullptr || !UpgradeRecord(type, record, *component) ||
+					!ComponentToJson(*descriptor, *component, record, m_strings, value, allocator))
+				{
+					return -1;
+				}
+			}
+		}
+		else if (encoding == ENCODING_COLUMN)
+		{
+			const ComponentDescriptor* descriptor = ComponentReflection::GetDescriptor(type.m_ID);
+			uint64_t row{};
+			if (descriptor == nullptr || !record.ReadVarint(row))
+				return -1;
+
+			Prefab scratch;
+			Components* component = scratch.CreateComponentByID(type.m_ID);
+			if (component == nullptr || !ReadRow(type, static_cast<size_t>(row), *component) ||
+				!ComponentToJson(*descriptor, *component, record, m_strings, value, allocator))
+			{
+				return -1;
+			}
+		}
+		else if (!ReadGeneric(record, m_strings, value, allocator))
+		{
+			return -1;
+		}
+		return static_cast<int64_t>(typeIndex);
+	}
+
+	/*!***********************************************************************
+	\brief		Read one row of a component type's columns into a component
+	*************************************************************************/
+	bool BinaryScene::ReadRow(const ComponentType& type, size_t row, Components& component) const
+	{
+		const ComponentDescriptor* descriptor = ComponentReflection::GetDescriptor(type.m_ID);
+		if (descriptor == nullptr || (!type.m_SchemaMatches && !type.m_Upgradable) || row >= type.m_Rows)
+			return false;
+
+		size_t column = 0;
+		FieldValue value;
+		if (type.m_SchemaMatches)
+		{
+			for (const FieldInfo& field : descriptor->GetFields())
+			{
+				for (uint32_t i = 0; i < field.m_Count; ++i, ++column)
+				{
+					const Column& source = type.m_Columns[column];
+					if (!ReadColumnValue(GetData() + source.m_Offset, source.m_Type, row, m_strings, value))
+						return false;
+					field.m_Set(component, i, value);
+				}
+			}
+		}
+		else
+		{
+			//The columns follow the file's field table
+			for (const FileField& field : type.m_Fields)
+			{
+				for (uint32_t i = 0; i < field.m_Count; ++i, ++column)
+				{
+					if (field.m_Target == nullptr || i >= field.m_Target->m_Count)
+						continue;
+					const Column& source = type.m_Columns[column];
+					if (!ReadColumnValue(GetData() + source.m_Offset, source.m_Type, row, m_strings, value))
+						return false;
+					field.m_Target->m_Set(component, i, value);
+				}
+			}
+			descriptor->Upgrade(component, type.m_Version);
+		}
+		descriptor->FinishLoad(component);
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Read a record written with an older field table
+	*************************************************************************/
+	bool BinaryScene::UpgradeRecord(const ComponentType& type, BinaryReader& record, Components& component) const
+	{
+		const ComponentDescriptor* descriptor = ComponentReflection::GetDescriptor(type.m_ID);
+		if (descriptor == nullptr || !type.m_Upgradable)
+			return false;
+
+		FieldValue value;
+		for (const FileField& field : type.m_Fields)
+		{
+			if (field.m_Type == FieldType::CUSTOM)
+			{
+				if (!field.m_Target->m_ReadBinary(record, component))
+					return false;
+				continue;
+			}
+
+			for (uint32_t i = 0; i < field.m_Count; ++i)
+			{
+				if (!ComponentReflection::ReadBinaryField(record, field.m_Type, value))
+					return false;
+				if (field.m_Target != nullptr && i < field.m_Target->m_Count)
+					field.m_Target->m_Set(component, i, value);
+			}
+		}
+
+		descriptor->Upgrade(component, type.m_Version);
+		descriptor->FinishLoad(component);
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Find the component type stored as columns
+	*************************************************************************/
+	const BinaryScene::ComponentType* BinaryScene::FindColumns(ComponentTypeID id) const
+	{
+		for (const ComponentType& type : m_types)
+		{
+			if (type.m_ID == id && id != ComponentTypeID::INVALID && type.m_Rows != 0)
+				return &type;
+		}
+		return nullptr;
+	}
+
+	/*!***********************************************************************
+	\brief		Get the number of rows stored as columns for a component type
+	*************************************************************************/
+	size_t BinaryScene::GetColumnRows(ComponentTypeID id) const
+	{
+		const ComponentType* type = FindColumns(id);
+		return type != nullptr ? type->m_Rows : 0;
+	}
+
+	/*!***********************************************************************
+	\brief		Get the entity index of every row of a component type
+	*************************************************************************/
+	const uint32_t* BinaryScene::GetColumnEntities(ComponentTypeID id) const
+	{
+		const ComponentType* type = FindColumns(id);
+		return type != nullptr ? reinterpret_cast<const uint32_t*>(GetData() + type->m_EntityOffset) : nullptr;
+	}
+
+	/*!***********************************************************************
+	\brief		Get the column of one element of a field
+	*************************************************************************/
+	const void* BinaryScene::GetColumn(ComponentTypeID id, const char* key, uint32_t element, FieldType& type) const
+	{
+		const ComponentType* columns = FindColumns(id);
+		if (columns == nullptr)
+			return nullptr;
+
+		for (const Column& column : columns->m_Columns)
+		{
+			if (column.m_Element == element && column.m_Key == key)
+			{
+				type = column.m_Type;
+				return GetData() + column.m_Offset;
+			}
+		}
+		return nullptr;
+	}
+
+	/*!***********************************************************************
+	\brief		Decode the whole scene back to JSON
+	*************************************************************************/
+	bool BinaryScene::Decode(rapidjson::Document& scene) const
+	{
+		rapidjson::Document::AllocatorType& allocator = scene.GetAllocator();
+		scene.SetObject();
+
+		rapidjson::Value data;
+		BinaryReader dataReader(GetData() + m_sceneDataOffset, m_file.size() - m_sceneDataOffset);
+		if (!ReadGeneric(dataReader, m_strings, data, allocator) || !data.IsObject())
+			return false;
+		for (auto it = data.MemberBegin(); it != data.MemberEnd(); ++it)
+		{
+			scene.AddMember(it->name, it->value, allocator);
+		}
+
+		rapidjson::Value entities(rapidjson::kArrayType);
+		entities.Reserve(static_cast<rapidjson::SizeType>(m_entityOffsets.size()), allocator);
+		for (size_t offset : m_entityOffsets)
+		{
+			BinaryReader reader(GetData() + offset, m_file.size() - offset);
+			uint64_t componentCount{};
+			if (!reader.ReadVarint(componentCount))
+				return false;
+
+			rapidjson::Value entity(rapidjson::kObjectType);
+			for (uint64_t c = 0; c < componentCount; ++c)
+			{
+				rapidjson::Value component;
+				const int64_t typeIndex = DecodeComponent(reader, component, allocator);
+				if (typeIndex < 0)
+					return false;
+
+				const std::string& typeName = m_types[static_cast<size_t>(typeIndex)].m_Name;
+				rapidjson::Value name(typeName.c_str(), static_cast<rapidjson::SizeType>(typeName.size()), allocator);
+				entity.AddMember(name, component, allocator);
+			}
+			entities.PushBack(entity, allocator);
+		}
+		scene.AddMember("Entities", entities, allocator);
+		return true;
+	}
+}
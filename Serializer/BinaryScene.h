@@ -0,0 +1,326 @@
+/******************************************************************************/
+/*!
+\file       BinaryScene.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the BinaryScene class,
+            the .solscene binary form of a scene JSON and the tools that
+            convert between the two
+
+            Layout:
+                header          magic "SSCN", format and schema version, counts
+                string table    every object key used by generic values
+                component table name of each component type in the file and,
+                                for described types, its version and the
+                                field table it was written with, with IDs
+                scene data      every top level member except "Entities"
+                columns         per component type, the owning entity of each
+                                row and one aligned array per field element
+                entities        per entity, its component records
+
+            A described component is stored as a fixed layout record written
+            by its ComponentDescriptor, followed by the keys its table does not
+            know. Components the tables cannot reproduce exactly are stored
+            as generic values, so conversion is lossless either way.
+
+            With columns enabled, records of types without CUSTOM fields are
+            moved into the columns instead and the entity keeps the row index
+            and the unknown keys. A Transform is then three float arrays that
+            can be copied into component storage with CopyColumn, instead of
+            one record per entity.
+
+            Records written with an older field table are not dropped. Their
+            fields are matched to this build's by field ID (by key and alias
+            for files from before field IDs), fields that no longer exist are
+            skipped and the component's migrations bring them up to date, so
+            old scenes load without being re-exported.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _BINARYSCENE_H_
+#define _BINARYSCENE_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <rapidjson/document.h>
+#include "SOL/AssetManager/MappedFile.h"
+#include "ComponentReflection.h"
+
+namespace SOL
+{
+    class Serializer;
+    class Prefab;
+
+    class BinaryScene
+    {
+    public:
+
+        static const uint16_t s_FormatVersion = 3;  //layout of the file itself, 2 added the columns, 3 field IDs and component versions
+        static const size_t s_ColumnAlignment = 16; //columns start at a multiple of this from the start of the file
+        static const uint32_t s_SchemaVersion = 1;  //bump whenever a field table in ComponentReflection.cpp changes
+
+        /*!***********************************************************************
+        \brief		Check if a scene path names a binary scene.
+        \param      filePath The scene path.
+        \return     True for .solscene files.
+        *************************************************************************/
+        static bool IsBinaryScene(const std::string& filePath);
+
+        /*!***********************************************************************
+        \brief		Get the binary scene path for a scene JSON path.
+        \param      jsonPath The scene JSON path.
+        \return     The same path with a .solscene extension.
+        *************************************************************************/
+        static std::string GetBinaryPath(const std::string& jsonPath);
+
+        /*!***********************************************************************
+        \brief		Encode a parsed scene JSON.
+        \param      scene The scene object, bytes Receives the file contents,
+                    columns Store the components that allow it as columns.
+        \return     False if the value is not a scene object.
+        *************************************************************************/
+        static bool Encode(const JsonValue& scene, std::vector<uint8_t>& bytes, bool columns = true);
+
+        /*!***********************************************************************
+        \brief		Convert a scene JSON file to a binary scene file.
+        \param      jsonPath The scene JSON, binaryPath The file to write.
+        \return     True if the file was written.
+        *************************************************************************/
+        static bool ConvertJsonToBinary(const std::string& jsonPath, const std::string& binaryPath);
+
+        /*!***********************************************************************
+        \brief		Convert a binary scene file back to scene JSON.
+        \param      binaryPath The binary scene, jsonPath The file to write.
+        \return     True if the file was written.
+        *************************************************************************/
+        static bool ConvertBinaryToJson(const std::string& binaryPath, const std::string& jsonPath);
+
+        /*!***********************************************************************
+        \brief		Convert every scene JSON in a directory, writing each binary
+                    scene next to its JSON.
+        \param      directory The directory holding the scene JSONs.
+        \return     The number of scenes converted.
+        *************************************************************************/
+        static size_t ConvertSceneDirectory(const std::string& directory);
+
+        /*!***********************************************************************
+        \brief		Map a binary scene file, entities and columns are read
+                    straight from the mapping.
+        \param      filePath The binary scene, resolved through the
+                    VirtualFileSystem mounts.
+        \return     True if the file is a valid binary scene.
+        *************************************************************************/
+        bool Open(const std::string& filePath);
+
+        /*!***********************************************************************
+        \brief		Take ownership of a binary scene in memory.
+        \param      bytes The file contents.
+        \return     True if the contents are a valid binary scene.
+        *************************************************************************/
+        bool Load(std::vector<uint8_t> bytes);
+
+        /*!***********************************************************************
+        \brief		Get the size of the scene's bytes.
+        *************************************************************************/
+        size_t GetSize() const { return m_file.size(); }
+
+        /*!***********************************************************************
+        \brief		Get the number of entities in the scene.
+        *************************************************************************/
+        size_t GetEntityCount() const { return m_entityOffsets.size(); }
+
+        /*!***********************************************************************
+        \brief		Get the top level members of the scene except "Entities",
+                    such as "Layers", as JSON.
+        \param      data Receives an object with the members.
+        \return     False if the data is corrupt.
+        *************************************************************************/
+        bool GetSceneData(rapidjson::Document& data) const;
+
+        /*!***********************************************************************
+        \brief		Deserialize one entity into a prefab, the binary counterpart
+                    of Prefab::DeserializeSceneEntity.
+        \param      serializer The serializer, index The entity,
+                    prefab Receives the components.
+        \return     False if the entity record is corrupt.
+        *************************************************************************/
+        bool DeserializeEntity(Serializer& serializer, size_t index, Prefab& prefab) const;
+
+        /*!***********************************************************************
+        \brief		Decode the whole scene back to JSON.
+        \param      scene Receives the scene object.
+        \return     False if the data is corrupt or written with a field table
+                    that cannot be upgraded.
+        *************************************************************************/
+        bool Decode(rapidjson::Document& scene) const;
+
+        /*!***********************************************************************
+        \brief		Get the number of rows stored as columns for a component type.
+        \param      id The component type.
+        \return     The row count, 0 if the type is not stored as columns.
+        *************************************************************************/
+        size_t GetColumnRows(ComponentTypeID id) const;
+
+        /*!***********************************************************************
+        \brief		Get the entity index of every row of a component type.
+        \param      id The component type.
+        \return     GetColumnRows entity indices, nullptr if the type is not
+                    stored as columns.
+        *************************************************************************/
+        const uint32_t* GetColumnEntities(ComponentTypeID id) const;
+
+        /*!***********************************************************************
+        \brief		Get the column of one element of a field. The values are
+                    int32, uint32, uint64, float, uint8 for BOOL, or uint32
+                    indices into GetStrings for STRING, and point into the
+                    scene's bytes.
+        \param      id The component type, key The field's JSON key,
+                    element The array element, 0 for scalars,
+                    type Receives the field type the column was written with.
+        \return     GetColumnRows values, nullptr if there is no such column.
+        *************************************************************************/
+        const void* GetColumn(ComponentTypeID id, const char* key, uint32_t element, FieldType& type) const;
+
+        /*!***********************************************************************
+        \brief		Copy a numeric column into component storage, converting each
+                    value to the member's type.
+        \param      id The component type, key The field's JSON key,
+                    element The array element, out The member of the first
+                    component, stride The distance between components in bytes.
+        \return     The number of values copied, 0 if there is no such column or
+                    it holds strings.
+        *************************************************************************/
+        template <typename T>
+        size_t CopyColumn(ComponentTypeID id, const char* key, uint32_t element, T* out, size_t stride = sizeof(T)) const
+        {
+            static_assert(std::is_arithmetic<T>::value, "CopyColumn only copies into numeric members");
+
+            FieldType type{};
+            const void* column = GetColumn(id, key, element, type);
+            if (column == nullptr)
+                return 0;
+
+            const size_t rows = GetColumnRows(id);
+            switch (type)
+            {
+            case FieldType::INT:    return CopyValues(static_cast<const int32_t*>(column), rows, out, stride);
+            case FieldType::UINT:   return CopyValues(static_cast<const uint32_t*>(column), rows, out, stride);
+            case FieldType::UINT64: return CopyValues(static_cast<const uint64_t*>(column), rows, out, stride);
+            case FieldType::FLOAT:  return CopyValues(static_cast<const float*>(column), rows, out, stride);
+            case FieldType::BOOL:   return CopyValues(static_cast<const uint8_t*>(column), rows, out, stride);
+            default:                return 0;
+            }
+        }
+
+        /*!***********************************************************************
+        \brief		Get the string table, which STRING columns index into.
+        *************************************************************************/
+        const std::vector<std::string>& GetStrings() const { return m_strings; }
+
+    private:
+
+        struct Column
+        {
+            std::string m_Key;
+            FieldType m_Type;
+            uint32_t m_Element;
+            size_t m_Offset;            //into m_file
+        };
+
+        struct FileField
+        {
+            FieldType m_Type;
+            uint32_t m_Count;
+            const FieldInfo* m_Target;  //this build's field with the same ID, or key for files before field IDs
+        };
+
+        struct ComponentType
+        {
+            std::string m_Name;
+            ComponentTypeID m_ID;       //INVALID if this build does not describe the type
+            uint32_t m_Version;         //component version the records were written with
+            bool m_SchemaMatches;       //the record layout in the file matches this build's field table
+            bool m_Upgradable;          //the file's field table can be read into this build's
+            std::vector<FileField> m_Fields;    //the file's field table, when it does not match
+            std::vector<Column> m_Columns;  //one per field element of the file's field table
+            size_t m_Rows;
+            size_t m_EntityOffset;      //into m_file, the entity index of each row
+        };
+
+        /*!***********************************************************************
+        \brief		Copy values into strided storage, a plain copy when the types
+                    and layout match.
+        *************************************************************************/
+        template <typename From, typename T>
+        static size_t CopyValues(const From* column, size_t rows, T* out, size_t stride)
+        {
+            if (std::is_same<From, T>::value && stride == sizeof(T))
+            {
+                std::memcpy(out, column, rows * sizeof(T));
+                return rows;
+            }
+
+            uint8_t* target = reinterpret_cast<uint8_t*>(out);
+            for (size_t row = 0; row < rows; ++row, target += stride)
+            {
+                *reinterpret_cast<T*>(target) = static_cast<T>(column[row]);
+            }
+            return rows;
+        }
+
+        /*!***********************************************************************
+        \brief		Find the component type stored as columns.
+        \return     The type, nullptr if the type has no columns in this file.
+        *************************************************************************/
+        const ComponentType* FindColumns(ComponentTypeID id) const;
+
+        /*!***********************************************************************
+        \brief		Read one row of a component type's columns into a component.
+        \param      type The component type, row The row, component Receives
+                    the fields.
+        \return     False if the row does not exist or the field table cannot be
+                    upgraded.
+        *************************************************************************/
+        bool ReadRow(const ComponentType& type, size_t row, Components& component) const;
+
+        /*!***********************************************************************
+        \brief		Read a record written with an older field table, matching its
+                    fields to this build's by ID and running the migrations.
+        \param      type The component type, record Positioned at the record,
+                    left after it, component Receives the fields.
+        \return     False if the data was truncated.
+        *************************************************************************/
+        bool UpgradeRecord(const ComponentType& type, BinaryReader& record, Components& component) const;
+
+        /*!***********************************************************************
+        \brief		Decode one component of an entity into a JSON value.
+        \param      reader Positioned at the component, value Receives the
+                    component object, allocator The allocator of value.
+        \return     The component type index, -1 if the data is corrupt.
+        *************************************************************************/
+        int64_t DecodeComponent(BinaryReader& reader, rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator) const;
+
+        /*!***********************************************************************
+        \brief		Read the tables and index the entities of the bytes in m_file.
+        \return     True if the bytes are a valid binary scene.
+        *************************************************************************/
+        bool ReadTables();
+
+        const uint8_t* GetData() const { return reinterpret_cast<const uint8_t*>(m_file.data()); }
+
+        MappedFile m_file;
+        std::vector<std::string> m_strings;
+        std::vector<ComponentType> m_types;
+        size_t m_sceneDataOffset{};
+        std::vector<size_t> m_entityOffsets;
+    };
+}
+#endif  //_BINARYSCENE_H_
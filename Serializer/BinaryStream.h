@@ -0,0 +1,214 @@
+/******************************************************************************/
+/*!
+\file       BinaryStream.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the BinaryWriter and BinaryReader classes,
+            the little endian byte streams used by the binary component codecs
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _BINARYSTREAM_H_
+#define _BINARYSTREAM_H_
+
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+namespace SOL
+{
+    class BinaryWriter
+    {
+    public:
+
+        /*!***********************************************************************
+        \brief		Append a trivially copyable value.
+        \param      value The value to append.
+        *************************************************************************/
+        template <typename T>
+        void Write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "BinaryWriter only writes plain values");
+            WriteBytes(&value, sizeof(T));
+        }
+
+        /*!***********************************************************************
+        \brief		Append a string as a 32 bit length followed by its bytes.
+        \param      value The string to append.
+        *************************************************************************/
+        void WriteString(const std::string& value)
+        {
+            Write(static_cast<uint32_t>(value.size()));
+            WriteBytes(value.data(), value.size());
+        }
+
+        /*!***********************************************************************
+        \brief		Append an unsigned integer in 7 bit groups, small values
+                    take a single byte.
+        \param      value The value to append.
+        *************************************************************************/
+        void WriteVarint(uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                m_Bytes.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            m_Bytes.push_back(static_cast<uint8_t>(value));
+        }
+
+        /*!***********************************************************************
+        \brief		Append a signed integer as a zigzag varint.
+        \param      value The value to append.
+        *************************************************************************/
+        void WriteSignedVarint(int64_t value)
+        {
+            WriteVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+        }
+
+        /*!***********************************************************************
+        \brief		Append raw bytes.
+        \param      data The bytes, size The number of bytes.
+        *************************************************************************/
+        void WriteBytes(const void* data, size_t size)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            m_Bytes.insert(m_Bytes.end(), bytes, bytes + size);
+        }
+
+        /*!***********************************************************************
+        \brief		Get the bytes written so far.
+        *************************************************************************/
+        const std::vector<uint8_t>& GetBytes() const { return m_Bytes; }
+        std::vector<uint8_t>& GetBytes() { return m_Bytes; }
+
+    private:
+        std::vector<uint8_t> m_Bytes;
+    };
+
+    class BinaryReader
+    {
+    public:
+
+        /*!***********************************************************************
+        \brief		Constructor for BinaryReader class, the bytes are not copied.
+        \param      data The bytes to read, size The number of bytes.
+        *************************************************************************/
+        BinaryReader(const void* data, size_t size)
+            : m_Data(static_cast<const uint8_t*>(data)), m_Size(size)
+        {
+        }
+
+        /*!***********************************************************************
+        \brief		Read a trivially copyable value.
+        \param      value Receives the value.
+        \return     False if the stream is exhausted.
+        *************************************************************************/
+        template <typename T>
+        bool Read(T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "BinaryReader only reads plain values");
+            return ReadBytes(&value, sizeof(T));
+        }
+
+        /*!***********************************************************************
+        \brief		Read a string written by BinaryWriter::WriteString.
+        \param      value Receives the string.
+        \return     False if the stream is exhausted.
+        *************************************************************************/
+        bool ReadString(std::string& value)
+        {
+            uint32_t length{};
+            if (!Read(length) || length > GetRemaining())
+                return false;
+            value.assign(reinterpret_cast<const char*>(m_Data + m_Offset), length);
+            m_Offset += length;
+            return true;
+        }
+
+        /*!***********************************************************************
+        \brief		Read a value written by BinaryWriter::WriteVarint.
+        \param      value Receives the value.
+        \return     False if the stream is exhausted or the varint is malformed.
+        *************************************************************************/
+        bool ReadVarint(uint64_t& value)
+        {
+            value = 0;
+            for (uint32_t shift = 0; shift < 64; shift += 7)
+            {
+                if (m_Offset >= m_Size)
+                    return false;
+                const uint8_t byte = m_Data[m_Offset++];
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                    return true;
+            }
+            return false;
+        }
+
+        /*!***********************************************************************
+        \brief		Read a value written by BinaryWriter::WriteSignedVarint.
+        \param      value Receives the value.
+        \return     False if the stream is exhausted or the varint is malformed.
+        *************************************************************************/
+        bool ReadSignedVarint(int64_t& value)
+        {
+            uint64_t encoded{};
+            if (!ReadVarint(encoded))
+                return false;
+            value = static_cast<int64_t>(encoded >> 1) ^ -static_cast<int64_t>(encoded & 1);
+            return true;
+        }
+
+        /*!***********************************************************************
+        \brief		Get a pointer to the unread bytes, for readers that parse in place.
+        *************************************************************************/
+        const uint8_t* GetCurrent() const { return m_Data + m_Offset; }
+
+        /*!***********************************************************************
+        \brief		Read raw bytes.
+        \param      data Receives the bytes, size The number of bytes.
+        \return     False if the stream is exhausted.
+        *************************************************************************/
+        bool ReadBytes(void* data, size_t size)
+        {
+            if (size > GetRemaining())
+                return false;
+            std::memcpy(data, m_Data + m_Offset, size);
+            m_Offset += size;
+            return true;
+        }
+
+        /*!***********************************************************************
+        \brief		Skip bytes without reading them.
+        \param      size The number of bytes.
+        \return     False if the stream is exhausted.
+        *************************************************************************/
+        bool Skip(size_t size)
+        {
+            if (size > GetRemaining())
+                return false;
+            m_Offset += size;
+            return true;
+        }
+
+        /*!***********************************************************************
+        \brief		Get the read position and the number of unread bytes.
+        *************************************************************************/
+        size_t GetOffset() const { return m_Offset; }
+        size_t GetRemaining() const { return m_Size - m_Offset; }
+
+    private:
+        const uint8_t* m_Data;
+        size_t m_Size;
+        size_t m_Offset{};
+    };
+}
+#endif  //_BINARYSTREAM_H_
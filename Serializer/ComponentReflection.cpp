@@ -0,0 +1,949 @@
+/******************************************************************************/
+/*!
+\file		ComponentReflection.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the field tables of every serializable component
+		and the JSON and binary codecs that walk them
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "ComponentReflection.h"
+#include "SOL/ECS/Components/TransformComponent.h"
+#include "SOL/ECS/Components/MovementComponent.h"
+#include "SOL/ECS/Components/PrimitiveComponent.h"
+#include "SOL/ECS/Components/SpriteComponent.h"
+#include "SOL/ECS/Components/NameComponent.h"
+#include "SOL/ECS/Components/PlayerComponent.h"
+#include "SOL/ECS/Components/RigidBody2DComponent.h"
+#include "SOL/ECS/Components/CameraComponent.h"
+#include "SOL/ECS/Components/AnimationComponent.h"
+#include "SOL/ECS/Components/FontComponent.h"
+#include "SOL/ECS/Components/UIComponent.h"
+#include "SOL/ECS/Components/GemComponent.h"
+#include "SOL/ECS/Components/AudioComponent.h"
+#include "SOL/ECS/Components/CPPScriptComponent.h"
+#include "SOL/ECS/Components/EnemyComponent.h"
+#include "SOL/ECS/Components/TileComponent.h"
+
+namespace SOL
+{
+	namespace
+	{
+		const char* const s_ComponentNames[] =
+		{
+#define SOL_COMPONENT_NAME(_component) #_component,
+			SOL_COMPONENT_TYPES(SOL_COMPONENT_NAME)
+#undef SOL_COMPONENT_NAME
+		};
+
+		/*!***********************************************************************
+		\brief		Perfect hash from component type name to ComponentTypeID
+
+					A seed is searched once so that every name lands in its own
+					slot. A lookup hashes the key, then a single length and byte
+					compare rejects names that are not components.
+		*************************************************************************/
+		class ComponentNameHash
+		{
+		public:
+			static const uint32_t s_SlotCount = 64;	//power of two, at least twice the component count
+
+			ComponentNameHash()
+			{
+				static_assert(s_ComponentTypeCount * 2 <= s_SlotCount, "grow s_SlotCount with the component list");
+
+				for (m_Seed = 0; ; ++m_Seed)
+				{
+					std::fill(std::begin(m_Slots), std::end(m_Slots), ComponentTypeID::INVALID);
+
+					bool collided = false;
+					for (size_t id = 0; id < s_ComponentTypeCount && !collided; ++id)
+					{
+						ComponentTypeID& slot = m_Slots[Hash(s_ComponentNames[id], std::strlen(s_ComponentNames[id]))];
+						collided = slot != ComponentTypeID::INVALID;
+						slot = static_cast<ComponentTypeID>(id);
+					}
+					if (!collided)
+						break;
+				}
+
+				for (size_t id = 0; id < s_ComponentTypeCount; ++id)
+				{
+					m_Lengths[id] = std::strlen(s_ComponentNames[id]);
+				}
+			}
+
+			ComponentTypeID Find(const char* key, size_t length) const
+			{
+				const ComponentTypeID id = m_Slots[Hash(key, length)];
+				if (id == ComponentTypeID::INVALID)
+					return id;
+
+				const size_t index = static_cast<size_t>(id);
+				if (m_Lengths[index] != length || std::memcmp(s_ComponentNames[index], key, length) != 0)
+					return ComponentTypeID::INVALID;
+				return id;
+			}
+
+		private:
+			uint32_t Hash(const char* key, size_t length) const
+			{
+				uint32_t hash = 2166136261u ^ m_Seed;	//FNV-1a
+				for (size_t i = 0; i < length; ++i)
+				{
+					hash ^= static_cast<uint8_t>(key[i]);
+					hash *= 16777619u;
+				}
+				return (hash ^ (hash >> 15)) & (s_SlotCount - 1);
+			}
+
+			uint32_t m_Seed{};
+			ComponentTypeID m_Slots[s_SlotCount];
+			size_t m_Lengths[s_ComponentTypeCount];
+		};
+
+		/*!***********************************************************************
+		\brief		Get the name hash, built on first use
+		*************************************************************************/
+		const ComponentNameHash& GetComponentNameHash()
+		{
+			static const ComponentNameHash s_Hash;
+			return s_Hash;
+		}
+
+		/*!***********************************************************************
+		\brief		Write a field value as the JSON type of its field
+		*************************************************************************/
+		void WriteJsonValue(JsonWriter& writer, FieldType type, const FieldValue& value)
+		{
+			switch (type)
+			{
+			case FieldType::INT:	writer.Int(static_cast<int>(value.AsInt())); break;
+			case FieldType::UINT:	writer.Uint(static_cast<unsigned>(value.AsUint())); break;
+			case FieldType::UINT64:	writer.Uint64(value.AsUint()); break;
+			case FieldType::FLOAT:	writer.Double(value.AsFloat()); break;
+			case FieldType::BOOL:	writer.Bool(value.AsUint() != 0); break;
+			case FieldType::STRING:	writer.String(value.m_String.c_str(), static_cast<rapidjson::SizeType>(value.m_String.size())); break;
+			default: break;
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Compare two field values read from the same field
+		*************************************************************************/
+		bool SameValue(const FieldValue& a, const FieldValue& b)
+		{
+			if (a.m_Kind != b.m_Kind)
+				return false;
+			switch (a.m_Kind)
+			{
+			case FieldValue::Kind::INT:		return a.m_Int == b.m_Int;
+			case FieldValue::Kind::UINT:	return a.m_Uint == b.m_Uint;
+			case FieldValue::Kind::FLOAT:	return a.m_Float == b.m_Float;
+			default:						return a.m_String == b.m_String;
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Read a JSON value into a field value
+		\return		False if the JSON type does not match the field
+		*************************************************************************/
+		bool ReadJsonValue(const JsonValue& json, FieldType type, FieldValue& value)
+		{
+			switch (type)
+			{
+			case FieldType::BOOL:
+				if (!json.IsBool())
+					return false;
+				value.m_Kind = FieldValue::Kind::UINT;
+				value.m_Uint = json.GetBool() ? 1 : 0;
+				return true;
+
+			case FieldType::STRING:
+				if (!json.IsString())
+					return false;
+				value.m_Kind = FieldValue::Kind::STRING;
+				value.m_String.assign(json.GetString(), json.GetStringLength());
+				return true;
+
+			default:
+				if (!json.IsNumber())
+					return false;
+				if (json.IsInt64())
+				{
+					value.m_Kind = FieldValue::Kind::INT;
+					value.m_Int = json.GetInt64();
+				}
+				else if (json.IsUint64())
+				{
+					value.m_Kind = FieldValue::Kind::UINT;
+					value.m_Uint = json.GetUint64();
+				}
+				else
+				{
+					value.m_Kind = FieldValue::Kind::FLOAT;
+					value.m_Float = json.GetDouble();
+				}
+				return true;
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Write a field value in the binary layout of its field
+		*************************************************************************/
+		void WriteBinaryValue(BinaryWriter& writer, FieldType type, const FieldValue& value)
+		{
+			switch (type)
+			{
+			case FieldType::INT:	writer.Write(static_cast<int32_t>(value.AsInt())); break;
+			case FieldType::UINT:	writer.Write(static_cast<uint32_t>(value.AsUint())); break;
+			case FieldType::UINT64:	writer.Write(value.AsUint()); break;
+			case FieldType::FLOAT:	writer.Write(static_cast<float>(value.AsFloat())); break;
+			case FieldType::BOOL:	writer.Write(static_cast<uint8_t>(value.AsUint() != 0)); break;
+			case FieldType::STRING:	writer.WriteString(value.m_String); break;
+			default: break;
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Read a field value in the binary layout of its field
+		\return		False if the data was truncated
+		*************************************************************************/
+		bool ReadBinaryValue(BinaryReader& reader, FieldType type, FieldValue& value)
+		{
+			switch (type)
+			{
+			case FieldType::INT:
+			{
+				int32_t number{};
+				value.m_Kind = FieldValue::Kind::INT;
+				if (!reader.Read(number))
+					return false;
+				value.m_Int = number;
+				return true;
+			}
+			case FieldType::UINT:
+			{
+				uint32_t number{};
+				value.m_Kind = FieldValue::Kind::UINT;
+				if (!reader.Read(number))
+					return false;
+				value.m_Uint = number;
+				return true;
+			}
+			case FieldType::UINT64:
+				value.m_Kind = FieldValue::Kind::UINT;
+				return reader.Read(value.m_Uint);
+			case FieldType::FLOAT:
+			{
+				float number{};
+				value.m_Kind = FieldValue::Kind::FLOAT;
+				if (!reader.Read(number))
+					return false;
+				value.m_Float = number;
+				return true;
+			}
+			case FieldType::BOOL:
+			{
+				uint8_t flag{};
+				value.m_Kind = FieldValue::Kind::UINT;
+				if (!reader.Read(flag))
+					return false;
+				value.m_Uint = flag;
+				return true;
+			}
+			case FieldType::STRING:
+				value.m_Kind = FieldValue::Kind::STRING;
+				return reader.ReadString(value.m_String);
+			default:
+				return false;
+			}
+		}
+
+		//____________________________CUSTOM FIELDS_______________________________
+
+		/*!***********************************************************************
+		\brief		Writes the audio control map as an array of single key objects
+		*************************************************************************/
+		void WriteAudioControlMapJson(JsonWriter& writer, const Components& component)
+		{
+			const AudioComponent& audio = static_cast<const AudioComponent&>(component);
+
+			writer.StartArray();
+			for (auto& _audiocontroller : audio.m_AudioControlMap)
+			{
+				writer.StartObject();
+					writer.Key(_audiocontroller.first.c_str());
+					writer.StartObject();
+
+					writer.String("UUID");
+					writer.Uint64(_audiocontroller.second.UUID);
+
+					writer.String("AudioKey");
+					writer.String(_audiocontroller.second.m_AudioKey.c_str());
+
+					writer.String("Loop");
+					writer.Bool(_audiocontroller.second.m_IsLooping);
+
+					writer.String("Volume");
+					writer.Double(_audiocontroller.second.m_Volume);
+
+					writer.EndObject();
+				writer.EndObject();
+			}
+			writer.EndArray();
+		}
+
+		/*!***********************************************************************
+		\brief		Reads the audio control map, one pass over each control. The
+					map is replaced, not merged into, so controls missing from
+					the value are removed
+		*************************************************************************/
+		void ReadAudioControlMapJson(const JsonValue& value, Components& component)
+		{
+			AudioComponent& audio = static_cast<AudioComponent&>(component);
+			if (!value.IsArray())
+				return;
+
+			audio.m_AudioControlMap.clear();
+
+			for (const auto& entry : value.GetArray())
+			{
+				if (!entry.IsObject() || entry.MemberBegin() == entry.MemberEnd())
+					continue;
+
+				const auto& control = *entry.MemberBegin();
+				if (!control.value.IsObject())
+					continue;
+
+				AudioComponent::AudioControl buffer{};
+				for (auto it = control.value.MemberBegin(); it != control.value.MemberEnd(); ++it)
+				{
+					const std::string key = it->name.GetString();
+					if (key == "UUID" && it->value.IsUint64())
+						buffer.UUID = it->value.GetUint64();
+					else if (key == "AudioKey" && it->value.IsString())
+						buffer.m_AudioKey = it->value.GetString();
+					else if (key == "Loop" && it->value.IsBool())
+						buffer.m_IsLooping = it->value.GetBool();
+					else if (key == "Volume" && it->value.IsNumber())
+						buffer.m_Volume = it->value.GetFloat();
+				}
+				audio.m_AudioControlMap.emplace(control.name.GetString(), buffer);
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Writes the audio control map as a count and its controls
+		*************************************************************************/
+		void WriteAudioControlMapBinary(BinaryWriter& writer, const Components& component)
+		{
+			const AudioComponent& audio = static_cast<const AudioComponent&>(component);
+
+			writer.Write(static_cast<uint32_t>(audio.m_AudioControlMap.size()));
+			for (auto& _audiocontroller : audio.m_AudioControlMap)
+			{
+				writer.WriteString(_audiocontroller.first);
+				writer.Write(static_cast<uint64_t>(_audiocontroller.second.UUID));
+				writer.WriteString(_audiocontroller.second.m_AudioKey);
+				writer.Write(static_cast<uint8_t>(_audiocontroller.second.m_IsLooping));
+				writer.Write(static_cast<float>(_audiocontroller.second.m_Volume));
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Reads the audio control map written by the function above
+		*************************************************************************/
+		bool ReadAudioControlMapBinary(BinaryReader& reader, Components& component)
+		{
+			AudioComponent& audio = static_cast<AudioComponent&>(component);
+
+			uint32_t count{};
+			if (!reader.Read(count))
+				return false;
+
+			audio.m_AudioControlMap.clear();
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				std::string name;
+				uint64_t uuid{};
+				uint8_t looping{};
+				float volume{};
+				AudioComponent::AudioControl buffer{};
+				if (!reader.ReadString(name) || !reader.Read(uuid) || !reader.ReadString(buffer.m_AudioKey) ||
+					!reader.Read(looping) || !reader.Read(volume))
+				{
+					return false;
+				}
+				buffer.UUID = uuid;
+				buffer.m_IsLooping = looping != 0;
+				buffer.m_Volume = volume;
+				audio.m_AudioControlMap.emplace(name, buffer);
+			}
+			return true;
+		}
+
+		/*!***********************************************************************
+		\brief		Replaces the attached scripts with a list of types, scripts
+					still listed keep their instance
+		*************************************************************************/
+		void AssignScripts(CPPScriptComponent& scripts, const std::vector<CPPScript_Type>& types)
+		{
+			decltype(scripts.m_Scripts) assigned;
+			for (CPPScript_Type type : types)
+			{
+				auto it = scripts.m_Scripts.find(type);
+				assigned.emplace(type, it != scripts.m_Scripts.end() ? it->second : nullptr);
+			}
+			scripts.m_Scripts.swap(assigned);
+		}
+
+		/*!***********************************************************************
+		\brief		Writes the attached script types as an array
+		*************************************************************************/
+		void WriteScriptsJson(JsonWriter& writer, const Components& component)
+		{
+			const CPPScriptComponent& scripts = static_cast<const CPPScriptComponent&>(component);
+
+			writer.StartArray();
+			for (auto& it : scripts.m_Scripts)
+			{
+				writer.Uint(it.first);
+			}
+			writer.EndArray();
+		}
+
+		/*!***********************************************************************
+		\brief		Reads the attached script types, the scripts are created on
+					scene start
+		*************************************************************************/
+		void ReadScriptsJson(const JsonValue& value, Components& component)
+		{
+			CPPScriptComponent& scripts = static_cast<CPPScriptComponent&>(component);
+			if (!value.IsArray())
+				return;
+
+			std::vector<CPPScript_Type> types;
+			for (auto& it : value.GetArray())
+			{
+				if (it.IsUint())
+					types.push_back((CPPScript_Type)it.GetUint());
+			}
+			AssignScripts(scripts, types);
+		}
+
+		/*!***********************************************************************
+		\brief		Writes the attached script types as a count and the types
+		*************************************************************************/
+		void WriteScriptsBinary(BinaryWriter& writer, const Components& component)
+		{
+			const CPPScriptComponent& scripts = static_cast<const CPPScriptComponent&>(component);
+
+			writer.Write(static_cast<uint32_t>(scripts.m_Scripts.size()));
+			for (auto& it : scripts.m_Scripts)
+			{
+				writer.Write(static_cast<uint32_t>(it.first));
+			}
+		}
+
+		/*!***********************************************************************
+		\brief		Reads the attached script types written by the function above
+		*************************************************************************/
+		bool ReadScriptsBinary(BinaryReader& reader, Components& component)
+		{
+			CPPScriptComponent& scripts = static_cast<CPPScriptComponent&>(component);
+
+			uint32_t count{};
+			if (!reader.Read(count))
+				return false;
+
+			std::vector<CPPScript_Type> types;
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				uint32_t type{};
+				if (!reader.Read(type))
+					return false;
+				types.push_back((CPPScript_Type)type);
+			}
+			AssignScripts(scripts, types);
+			return true;
+		}
+
+		/*!***********************************************************************
+		\brief		Orders the descriptor table by ID so GetDescriptor can index it
+		*************************************************************************/
+		std::vector<ComponentDescriptor> IndexDescriptors(std::vector<ComponentDescriptor> descriptors)
+		{
+			std::sort(descriptors.begin(), descriptors.end(), [](const ComponentDescriptor& lhs, const ComponentDescriptor& rhs)
+				{
+					return lhs.GetID() < rhs.GetID();
+				});
+
+			if (descriptors.size() != s_ComponentTypeCount)
+			{
+				ENGINE_CRITICAL("Every component in SOL_COMPONENT_TYPES needs exactly one field table");
+			}
+			return descriptors;
+		}
+
+		/*!***********************************************************************
+		\brief		Rebuilds the body from the loaded size, mass and type. Friction
+					is loaded after Set, so it is restored afterwards.
+		*************************************************************************/
+		void FinishRigidBody2D(Components& component)
+		{
+			RigidBody2DComponent& rigid = static_cast<RigidBody2DComponent&>(component);
+
+			const float friction = rigid.m_body.friction;
+			rigid.m_body.Set(rigid.m_body.width, rigid.m_body.mass, rigid.m_body.bodytype);
+			rigid.m_body.friction = friction;
+		}
+
+		/*!***********************************************************************
+		\brief		Version history of CameraComponent. The old deserializer read
+					the field of view from "m_FOV" while the serializer wrote
+					"m_Fov", files edited against the reader still use it.
+		*************************************************************************/
+		ComponentSchema CameraSchema()
+		{
+			ComponentSchema schema;
+			schema.m_Aliases = { { "m_FOV", 4 } };	//m_Fov
+			return schema;
+		}
+	}
+
+	const char* const ComponentDescriptor::s_VersionKey = "SchemaVersion";
+
+	/*!***********************************************************************
+	\brief		Constructor for ComponentDescriptor class
+	*************************************************************************/
+	ComponentDescriptor::ComponentDescriptor(ComponentTypeID id, std::vector<FieldInfo> fields, PostLoadFunction postLoad,
+		ComponentSchema schema)
+		: m_ID(id), m_Name(ComponentReflection::GetComponentName(id)), m_Fields(std::move(fields)), m_PostLoad(postLoad),
+		m_Schema(std::move(schema))
+	{
+		m_KeyLengths.reserve(m_Fields.size());
+		for (const FieldInfo& field : m_Fields)
+		{
+			m_KeyLengths.push_back(std::strlen(field.m_Key));
+		}
+
+		// A positional fallback would renumber fields when the table changes, so every ID is explicit
+		for (const FieldInfo& field : m_Fields)
+		{
+			if (field.m_ID == 0)
+				ENGINE_CRITICAL("Field " + std::string(field.m_Key) + " of " + m_Name + " has no field ID");
+			else if (FindFieldByID(field.m_ID) != &field)
+				ENGINE_CRITICAL("Field " + std::string(field.m_Key) + " of " + m_Name + " reuses field ID " + std::to_string(field.m_ID));
+		}
+		for (const FieldAlias& alias : m_Schema.m_Aliases)
+		{
+			if (FindFieldByID(alias.m_FieldID) == nullptr)
+				ENGINE_CRITICAL("A field alias names a field ID that is not in the table");
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Write a component as a JSON object
+	*************************************************************************/
+	void ComponentDescriptor::WriteJson(JsonWriter& writer, const Components& component, const std::vector<uint8_t>* fields) const
+	{
+		FieldValue value;
+
+		writer.StartObject();
+		if (m_Schema.m_Version > 1)
+		{
+			writer.Key(s_VersionKey);
+			writer.Uint(m_Schema.m_Version);
+		}
+		for (size_t f = 0; f < m_Fields.size(); ++f)
+		{
+			if (fields != nullptr && (f >= fields->size() || (*fields)[f] == 0))
+				continue;
+
+			const FieldInfo& field = m_Fields[f];
+			writer.Key(field.m_Key, static_cast<rapidjson::SizeType>(m_KeyLengths[f]));
+
+			if (field.m_Type == FieldType::CUSTOM)
+			{
+				field.m_WriteJson(writer, component);
+				continue;
+			}
+
+			if (field.m_Count > 1)
+				writer.StartArray();
+			for (uint32_t i = 0; i < field.m_Count; ++i)
+			{
+				field.m_Get(component, i, value);
+				WriteJsonValue(writer, field.m_Type, value);
+			}
+			if (field.m_Count > 1)
+				writer.EndArray();
+		}
+		writer.EndObject();
+	}
+
+	/*!***********************************************************************
+	\brief		Read a component from a JSON object in one pass over its members
+	*************************************************************************/
+	void ComponentDescriptor::ReadJson(const JsonValue& json, Components& component) const
+	{
+		if (!json.IsObject())
+			return;
+
+		FieldValue value;
+		size_t cursor = 0;
+		uint32_t version = 1;
+		for (auto it = json.MemberBegin(); it != json.MemberEnd(); ++it)
+		{
+			if (std::strcmp(it->name.GetString(), s_VersionKey) == 0)
+			{
+				if (it->value.IsUint())
+					version = it->value.GetUint();
+				continue;
+			}
+
+			const FieldInfo* field = FindField(it->name.GetString(), it->name.GetStringLength(), cursor);
+			if (field == nullptr)
+				continue;
+
+			const JsonValue& member = it->value;
+			if (field->m_Type == FieldType::CUSTOM)
+			{
+				field->m_ReadJson(member, component);
+			}
+			else if (field->m_Count == 1)
+			{
+				if (ReadJsonValue(member, field->m_Type, value))
+					field->m_Set(component, 0, value);
+			}
+			else if (member.IsArray() && member.Size() >= field->m_Count)
+			{
+				for (uint32_t i = 0; i < field->m_Count; ++i)
+				{
+					if (ReadJsonValue(member[i], field->m_Type, value))
+						field->m_Set(component, i, value);
+				}
+			}
+		}
+
+		Upgrade(component, version);
+		if (m_PostLoad)
+			m_PostLoad(component);
+	}
+
+	/*!***********************************************************************
+	\brief		Mark the fields whose values differ from a baseline, custom
+				fields are compared by their binary encoding
+	*************************************************************************/
+	size_t ComponentDescriptor::DiffFields(const Components& component, const Components& baseline, std::vector<uint8_t>& changed) const
+	{
+		FieldValue value, baseValue;
+		size_t changedCount = 0;
+
+		changed.assign(m_Fields.size(), 0);
+		for (size_t f = 0; f < m_Fields.size(); ++f)
+		{
+			const FieldInfo& field = m_Fields[f];
+			bool differs = false;
+
+			if (field.m_Type == FieldType::CUSTOM)
+			{
+				BinaryWriter current, base;
+				field.m_WriteBinary(current, component);
+				field.m_WriteBinary(base, baseline);
+				differs = current.GetBytes() != base.GetBytes();
+			}
+			else
+			{
+				for (uint32_t i = 0; i < field.m_Count && !differs; ++i)
+				{
+					field.m_Get(component, i, value);
+					field.m_Get(baseline, i, baseValue);
+					differs = !SameValue(value, baseValue);
+				}
+			}
+
+			if (differs)
+			{
+				changed[f] = 1;
+				++changedCount;
+			}
+		}
+		return changedCount;
+	}
+
+	/*!***********************************************************************
+	\brief		Run the post load fix up after the fields were set one at a time
+	*************************************************************************/
+	void ComponentDescriptor::FinishLoad(Components& component) const
+	{
+		if (m_PostLoad)
+			m_PostLoad(component);
+	}
+
+	/*!***********************************************************************
+	\brief		Write a component as binary, every field in table order
+	*************************************************************************/
+	void ComponentDescriptor::WriteBinary(BinaryWriter& writer, const Components& component) const
+	{
+		FieldValue value;
+		for (const FieldInfo& field : m_Fields)
+		{
+			if (field.m_Type == FieldType::CUSTOM)
+			{
+				field.m_WriteBinary(writer, component);
+				continue;
+			}
+
+			for (uint32_t i = 0; i < field.m_Count; ++i)
+			{
+				field.m_Get(component, i, value);
+				WriteBinaryValue(writer, field.m_Type, value);
+			}
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Read a component written by WriteBinary
+	*************************************************************************/
+	bool ComponentDescriptor::ReadBinary(BinaryReader& reader, Components& component) const
+	{
+		FieldValue value;
+		for (const FieldInfo& field : m_Fields)
+		{
+			if (field.m_Type == FieldType::CUSTOM)
+			{
+				if (!field.m_ReadBinary(reader, component))
+					return false;
+				continue;
+			}
+
+			for (uint32_t i = 0; i < field.m_Count; ++i)
+			{
+				if (!ReadBinaryValue(reader, field.m_Type, value))
+					return false;
+				field.m_Set(component, i, value);
+			}
+		}
+
+		if (m_PostLoad)
+			m_PostLoad(component);
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Find the field for a JSON key, starting after the previous match
+	*************************************************************************/
+	const FieldInfo* ComponentDescriptor::FindField(const char* key, size_t length, size_t& cursor) const
+	{
+		const size_t count = m_Fields.size();
+		for (size_t n = 0; n < count; ++n)
+		{
+			const size_t index = (cursor + n) % count;
+			if (m_KeyLengths[index] == length && std::memcmp(m_Fields[index].m_Key, key, length) == 0)
+			{
+				cursor = index + 1;
+				return &m_Fields[index];
+			}
+		}
+
+		// Only keys that are not in the table get here, so old names cost nothing on current files
+		for (const FieldAlias& alias : m_Schema.m_Aliases)
+		{
+			if (std::strlen(alias.m_Key) == length && std::memcmp(alias.m_Key, key, length) == 0)
+				return FindFieldByID(alias.m_FieldID);
+		}
+		return nullptr;
+	}
+
+	/*!***********************************************************************
+	\brief		Find the field with an ID
+	*************************************************************************/
+	const FieldInfo* ComponentDescriptor::FindFieldByID(uint32_t id) const
+	{
+		for (const FieldInfo& field : m_Fields)
+		{
+			if (field.m_ID == id)
+				return &field;
+		}
+		return nullptr;
+	}
+
+	/*!***********************************************************************
+	\brief		Run the migrations from a version to the current one
+	*************************************************************************/
+	void ComponentDescriptor::Upgrade(Components& component, uint32_t version) const
+	{
+		for (; version < m_Schema.m_Version; ++version)
+		{
+			for (const ComponentMigration& migration : m_Schema.m_Migrations)
+			{
+				if (migration.m_FromVersion == version)
+					migration.m_Migrate(component);
+			}
+		}
+	}
+
+	//____________________________EXTEND WHEN NEW COMPONENTS IMPLEMENTED(ADD MORE)_______________________________
+
+	/*!***********************************************************************
+	\brief		Get the descriptors of every serializable component, indexed by ID
+	*************************************************************************/
+	const std::vector<ComponentDescriptor>& ComponentReflection::GetDescriptors()
+	{
+		static const std::vector<ComponentDescriptor> s_Descriptors = IndexDescriptors(
+		{
+			SOL_COMPONENT(TransformComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD_VEC3(2, "Transform", FLOAT, m_Transform.x, m_Transform.y, m_TransformZ),
+				SOL_FIELD_VEC2(3, "Scale", FLOAT, m_Scale.x, m_Scale.y),
+				SOL_FIELD(4, "Rotation", FLOAT, m_Rotation)),
+
+			SOL_COMPONENT(MovementComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD_VEC2(2, "Direction", FLOAT, m_Direction.x, m_Direction.y),
+				SOL_FIELD(3, "Speed", FLOAT, m_Speed)),
+
+			SOL_COMPONENT(PrimitiveComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD(2, "PrimitiveID", INT, m_PrimitiveID),
+				SOL_FIELD(3, "Offset", FLOAT, m_Offset),
+				SOL_FIELD_VEC3(4, "Color", FLOAT, m_Color.x, m_Color.y, m_Color.z),
+				SOL_FIELD(5, "Alpha", FLOAT, m_Alpha)),
+
+			SOL_COMPONENT(SpriteComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD(2, "TexKey", STRING, m_TexKey),
+				SOL_FIELD(3, "UUID", UINT64, UUID),
+				SOL_FIELD(4, "Width", FLOAT, m_SpriteWidth),
+				SOL_FIELD(5, "Height", FLOAT, m_SpriteHeight),
+				SOL_FIELD(6, "Alpha", FLOAT, m_Alpha),
+				SOL_FIELD_VEC3(7, "Color", FLOAT, m_Color.x, m_Color.y, m_Color.z)),
+
+			SOL_COMPONENT(PlayerComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD(2, "TransformAmount", INT, transformAmount),
+				SOL_FIELD(3, "MoveSpeed", INT, moveSpeed)),
+
+			SOL_COMPONENT(NameComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD(2, "Name", STRING, m_name)),
+
+			SOL_COMPONENT_POSTLOAD(RigidBody2DComponent, FinishRigidBody2D,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD_VEC2(2, "Position", FLOAT, m_body.position.x, m_body.position.y),
+				SOL_FIELD_VEC2(3, "Width", FLOAT, m_body.width.x, m_body.width.y),
+				SOL_FIELD(4, "Mass", FLOAT, m_body.mass),
+				SOL_FIELD(5, "BodyType", INT, m_body.bodytype),
+				SOL_FIELD(6, "Offset", FLOAT, m_offset),
+				SOL_FIELD(7, "Friction", FLOAT, m_body.friction)),
+
+			SOL_COMPONENT_SCHEMA(CameraComponent, nullptr, CameraSchema(),
+				SOL_FIELD_GETSET(1, "m_Active", BOOL, m_IsActive, m_Active),
+				SOL_FIELD(2, "m_SmoothDampActive", BOOL, m_SmoothDampActive),
+				SOL_FIELD(3, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD(4, "m_Fov", FLOAT, m_FOV),
+				SOL_FIELD(5, "m_PerspectiveNear", FLOAT, m_PerspectiveNear),
+				SOL_FIELD(6, "m_PerspectiveFar", FLOAT, m_PerspectiveFar),
+				SOL_FIELD(7, "m_OrthoFar", FLOAT, m_OrthoFar),
+				SOL_FIELD(8, "m_OrthoNear", FLOAT, m_OrthoNear),
+				SOL_FIELD(9, "m_OrthoSize", FLOAT, m_OrthoSize),
+				SOL_FIELD(10, "m_CameraDistance", FLOAT, m_CameraDistance),
+				SOL_FIELD_VEC2(11, "velocity", FLOAT, velocity.x, velocity.y)),
+
+			SOL_COMPONENT(FontComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD(2, "UUID", UINT64, UUID),
+				SOL_FIELD(3, "Text", STRING, text),
+				SOL_FIELD_VEC3(4, "Color", FLOAT, color.x, color.y, color.z)),
+
+			SOL_COMPONENT(AnimationComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD(2, "MaxFrame", INT, m_MaxFrame),
+				SOL_FIELD(3, "CurrentFrameIndex", INT, m_CurrentFrameIndex),
+				SOL_FIELD(4, "StartingAnimIndex", INT, m_StartingAnimationIndex),
+				SOL_FIELD(5, "Interval", FLOAT, m_Interval)),
+
+			SOL_COMPONENT(GemComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity)),
+
+			SOL_COMPONENT(UIComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity)),
+
+			SOL_COMPONENT(AudioComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD_CUSTOM(2, "AudioControlMap", WriteAudioControlMapJson, ReadAudioControlMapJson,
+					WriteAudioControlMapBinary, ReadAudioControlMapBinary)),
+
+			SOL_COMPONENT(EnemyComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD_VEC2(2, "MaxDelta", FLOAT, m_maxDelta.x, m_maxDelta.y)),
+
+			SOL_COMPONENT(TileComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD(2, "TileType", UINT, m_TileType)),
+
+			SOL_COMPONENT(CPPScriptComponent,
+				SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+				SOL_FIELD_CUSTOM(2, "CPPScripts", WriteScriptsJson, ReadScriptsJson,
+					WriteScriptsBinary, ReadScriptsBinary)),
+		});
+		return s_Descriptors;
+	}
+
+	/*!***********************************************************************
+	\brief		Get the descriptor of a component type
+	*************************************************************************/
+	const ComponentDescriptor* ComponentReflection::GetDescriptor(ComponentTypeID id)
+	{
+		const std::vector<ComponentDescriptor>& descriptors = GetDescriptors();
+		const size_t index = static_cast<size_t>(id);
+		if (index < descriptors.size() && descriptors[index].GetID() == id)
+			return &descriptors[index];
+		return nullptr;
+	}
+
+	/*!***********************************************************************
+	\brief		Find the descriptor of a component type
+	*************************************************************************/
+	const ComponentDescriptor* ComponentReflection::FindDescriptor(const std::string& typeName)
+	{
+		return GetDescriptor(FindComponentID(typeName));
+	}
+
+	/*!***********************************************************************
+	\brief		Map a component type name to its ID
+	*************************************************************************/
+	ComponentTypeID ComponentReflection::FindComponentID(const char* key, size_t length)
+	{
+		return GetComponentNameHash().Find(key, length);
+	}
+
+	ComponentTypeID ComponentReflection::FindComponentID(const std::string& typeName)
+	{
+		return GetComponentNameHash().Find(typeName.c_str(), typeName.size());
+	}
+
+	/*!***********************************************************************
+	\brief		Get the type name of a component type
+	*************************************************************************/
+	const char* ComponentReflection::GetComponentName(ComponentTypeID id)
+	{
+		return id < ComponentTypeID::COUNT ? s_ComponentNames[static_cast<size_t>(id)] : "";
+	}
+
+	/*!***********************************************************************
+	\brief		Read a field value in the binary layout of a field type
+	*************************************************************************/
+	bool ComponentReflection::ReadBinaryField(BinaryReader& reader, FieldType type, FieldValue& value)
+	{
+		return type != FieldType::CUSTOM && ReadBinaryValue(reader, type, value);
+	}
+}
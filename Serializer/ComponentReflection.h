@@ -0,0 +1,475 @@
+/******************************************************************************/
+/*!
+\file       ComponentReflection.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the field tables that describe every
+            serializable component once, and the JSON and binary codecs
+            generated from them
+
+            A component is described with SOL_COMPONENT and one SOL_FIELD*
+            entry per JSON key, e.g.
+
+            SOL_COMPONENT(MovementComponent,
+                SOL_FIELD(1, "Identity", INT, m_EntityIdentity),
+                SOL_FIELD_VEC2(2, "Direction", FLOAT, m_Direction.x, m_Direction.y),
+                SOL_FIELD(3, "Speed", FLOAT, m_Speed))
+
+            added to SOL_COMPONENT_TYPES below and to the table in
+            ComponentReflection.cpp. Nothing else has to be written for it to
+            load and save as JSON or binary.
+
+            The first argument of every SOL_FIELD* is the field's ID, non zero
+            and unique within the component. This is checked when the
+            descriptors are built at startup, and a missing or repeated ID
+            stops the engine with a critical error. Binary scenes match fields by ID, so a field can be
+            renamed, moved or have its type changed without re-exporting them
+            as long as it keeps its ID. A new field takes an ID never used by
+            the component before, and the ID of a removed field is not reused.
+            When the meaning of a field changes,
+            raise the component's ComponentSchema version and register a
+            migration, and old JSON and binary scenes are upgraded as they
+            load. The keys a field was written under before are listed as
+            aliases so old JSON still reads into it.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _COMPONENTREFLECTION_H_
+#define _COMPONENTREFLECTION_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/prettywriter.h>
+#include "SOL/ECS/Components/Components.h"
+#include "BinaryStream.h"
+
+//____________________________EXTEND WHEN NEW COMPONENTS IMPLEMENTED(ADD MORE)_______________________________
+//Every serializable component. The position in this list is the component's ComponentTypeID.
+#define SOL_COMPONENT_TYPES(X)  \
+    X(TransformComponent)       \
+    X(MovementComponent)        \
+    X(PrimitiveComponent)       \
+    X(SpriteComponent)          \
+    X(PlayerComponent)          \
+    X(NameComponent)            \
+    X(RigidBody2DComponent)     \
+    X(CameraComponent)          \
+    X(FontComponent)            \
+    X(AnimationComponent)       \
+    X(GemComponent)             \
+    X(UIComponent)              \
+    X(AudioComponent)           \
+    X(EnemyComponent)           \
+    X(TileComponent)            \
+    X(CPPScriptComponent)
+
+namespace SOL
+{
+    /*!***********************************************************************
+    \brief		Dense IDs of the serializable components, used to index the
+                dispatch tables instead of comparing type names.
+    *************************************************************************/
+    enum class ComponentTypeID : uint32_t
+    {
+#define SOL_COMPONENT_ID(_component) _component,
+        SOL_COMPONENT_TYPES(SOL_COMPONENT_ID)
+#undef SOL_COMPONENT_ID
+        COUNT,
+        INVALID = COUNT
+    };
+
+    static const size_t s_ComponentTypeCount = static_cast<size_t>(ComponentTypeID::COUNT);
+
+    using JsonWriter = rapidjson::PrettyWriter<rapidjson::StringBuffer>;
+    using JsonValue = rapidjson::GenericValue<rapidjson::UTF8<>>;
+
+    /*!***********************************************************************
+    \brief		How a field is written, the member it maps to can be any
+                arithmetic or enum type and is converted on the way.
+    *************************************************************************/
+    enum class FieldType : uint8_t
+    {
+        INT,        //JSON Int, binary int32
+        UINT,       //JSON Uint, binary uint32
+        UINT64,     //JSON Uint64, binary uint64
+        FLOAT,      //JSON Double, binary float
+        BOOL,       //JSON Bool, binary uint8
+        STRING,     //JSON String, binary length and bytes
+        CUSTOM      //written by the field's own hooks
+    };
+
+    /*!***********************************************************************
+    \brief		A single field value on its way between a member and a codec.
+    *************************************************************************/
+    struct FieldValue
+    {
+        enum class Kind : uint8_t { INT, UINT, FLOAT, STRING };
+
+        Kind m_Kind{ Kind::INT };
+        int64_t m_Int{};
+        uint64_t m_Uint{};
+        double m_Float{};
+        std::string m_String;
+
+        /*!***********************************************************************
+        \brief		Get the value converted to each representation.
+        *************************************************************************/
+        int64_t AsInt() const
+        {
+            return m_Kind == Kind::INT ? m_Int : m_Kind == Kind::UINT ? static_cast<int64_t>(m_Uint) : static_cast<int64_t>(m_Float);
+        }
+        uint64_t AsUint() const
+        {
+            return m_Kind == Kind::UINT ? m_Uint : m_Kind == Kind::INT ? static_cast<uint64_t>(m_Int) : static_cast<uint64_t>(m_Float);
+        }
+        double AsFloat() const
+        {
+            return m_Kind == Kind::FLOAT ? m_Float : m_Kind == Kind::INT ? static_cast<double>(m_Int) : static_cast<double>(m_Uint);
+        }
+
+        /*!***********************************************************************
+        \brief		Copy a member into the value.
+        \param      value Receives the member, member The member to copy.
+        *************************************************************************/
+        template <typename T>
+        static void Store(FieldValue& value, const T& member)
+        {
+            if constexpr (std::is_same<T, std::string>::value)
+            {
+                value.m_Kind = Kind::STRING;
+                value.m_String = member;
+            }
+            else if constexpr (std::is_floating_point<T>::value)
+            {
+                value.m_Kind = Kind::FLOAT;
+                value.m_Float = static_cast<double>(member);
+            }
+            else if constexpr (std::is_enum<T>::value)
+            {
+                value.m_Kind = Kind::INT;
+                value.m_Int = static_cast<int64_t>(member);
+            }
+            else if constexpr (std::is_signed<T>::value)
+            {
+                value.m_Kind = Kind::INT;
+                value.m_Int = static_cast<int64_t>(member);
+            }
+            else
+            {
+                value.m_Kind = Kind::UINT;
+                value.m_Uint = static_cast<uint64_t>(member);
+            }
+        }
+
+        /*!***********************************************************************
+        \brief		Copy the value into a member, converting to its type.
+        \param      value The value to copy, member Receives the value.
+        *************************************************************************/
+        template <typename T>
+        static void Load(const FieldValue& value, T& member)
+        {
+            if constexpr (std::is_same<T, std::string>::value)
+                member = value.m_String;
+            else if constexpr (std::is_same<T, bool>::value)
+                member = value.AsUint() != 0;
+            else if constexpr (std::is_floating_point<T>::value)
+                member = static_cast<T>(value.AsFloat());
+            else if constexpr (std::is_enum<T>::value || std::is_signed<T>::value)
+                member = static_cast<T>(value.AsInt());
+            else
+                member = static_cast<T>(value.AsUint());
+        }
+    };
+
+    /*!***********************************************************************
+    \brief		One entry of a component's field table.
+
+                m_Get and m_Set move element _index of the field between the
+                component and a FieldValue. CUSTOM fields leave them empty and
+                provide the four codec hooks instead.
+    *************************************************************************/
+    struct FieldInfo
+    {
+        const char* m_Key;
+        FieldType m_Type;
+        uint32_t m_Count;       //1 for scalars, the element count for JSON arrays
+        void (*m_Get)(const Components& component, uint32_t index, FieldValue& value);
+        void (*m_Set)(Components& component, uint32_t index, const FieldValue& value);
+        void (*m_WriteJson)(JsonWriter& writer, const Components& component);
+        void (*m_ReadJson)(const JsonValue& value, Components& component);
+        void (*m_WriteBinary)(BinaryWriter& writer, const Components& component);
+        bool (*m_ReadBinary)(BinaryReader& reader, Components& component);
+        uint32_t m_ID;          //stable ID binary scenes match fields by, never 0
+    };
+
+    /*!***********************************************************************
+    \brief		A key a field was written under before it was renamed.
+    *************************************************************************/
+    struct FieldAlias
+    {
+        const char* m_Key;
+        uint32_t m_FieldID;
+    };
+
+    /*!***********************************************************************
+    \brief		Upgrades a component decoded from an older version by one
+                version, run before the post load fix up.
+    *************************************************************************/
+    struct ComponentMigration
+    {
+        uint32_t m_FromVersion;
+        void (*m_Migrate)(Components& component);
+    };
+
+    /*!***********************************************************************
+    \brief		The version history of a component's field table.
+    *************************************************************************/
+    struct ComponentSchema
+    {
+        uint32_t m_Version{ 1 };                        //raise when the meaning of a field changes
+        std::vector<FieldAlias> m_Aliases;
+        std::vector<ComponentMigration> m_Migrations;   //one per version step, in any order
+    };
+
+    class ComponentDescriptor
+    {
+    public:
+
+        using PostLoadFunction = void (*)(Components& component);
+
+        static const char* const s_VersionKey;  //JSON key of the version, written once it is above 1
+
+        /*!***********************************************************************
+        \brief		Constructor for ComponentDescriptor class.
+        \param      id The component type, its name is used as the JSON key,
+                    fields The field table in the order it is written,
+                    postLoad Called after every decode, may be nullptr,
+                    schema The version, aliases and migrations.
+        *************************************************************************/
+        ComponentDescriptor(ComponentTypeID id, std::vector<FieldInfo> fields, PostLoadFunction postLoad = nullptr,
+                            ComponentSchema schema = {});
+
+        /*!***********************************************************************
+        \brief		Get the component type ID.
+        *************************************************************************/
+        ComponentTypeID GetID() const { return m_ID; }
+
+        /*!***********************************************************************
+        \brief		Get the component type name.
+        *************************************************************************/
+        const std::string& GetName() const { return m_Name; }
+
+        /*!***********************************************************************
+        \brief		Get the field table.
+        *************************************************************************/
+        const std::vector<FieldInfo>& GetFields() const { return m_Fields; }
+
+        /*!***********************************************************************
+        \brief		Get the version of the field table.
+        *************************************************************************/
+        uint32_t GetVersion() const { return m_Schema.m_Version; }
+
+        /*!***********************************************************************
+        \brief		Write a component as a JSON object.
+        \param      writer The writer, component The component to write,
+                    fields If given, only the fields marked non zero, as
+                    filled in by DiffFields.
+        *************************************************************************/
+        void WriteJson(JsonWriter& writer, const Components& component, const std::vector<uint8_t>* fields = nullptr) const;
+
+        /*!***********************************************************************
+        \brief		Read a component from a JSON object in one pass over its
+                    members. Unknown keys and values of the wrong type are
+                    skipped, missing keys leave the member untouched.
+        \param      value The JSON object, component Receives the fields.
+        *************************************************************************/
+        void ReadJson(const JsonValue& value, Components& component) const;
+
+        /*!***********************************************************************
+        \brief		Write a component as binary, every field in table order.
+        \param      writer The writer, component The component to write.
+        *************************************************************************/
+        void WriteBinary(BinaryWriter& writer, const Components& component) const;
+
+        /*!***********************************************************************
+        \brief		Read a component written by WriteBinary.
+        \param      reader The reader, component Receives the fields.
+        \return     False if the data was truncated.
+        *************************************************************************/
+        bool ReadBinary(BinaryReader& reader, Components& component) const;
+
+        /*!***********************************************************************
+        \brief		Run the post load fix up, for readers that set the fields
+                    one at a time through the table.
+        \param      component The component that was read.
+        *************************************************************************/
+        void FinishLoad(Components& component) const;
+
+        /*!***********************************************************************
+        \brief		Run the migrations from a version to the current one, for a
+                    component decoded from an older version. Call before
+                    FinishLoad.
+        \param      component The component, version The version it was
+                    written with.
+        *************************************************************************/
+        void Upgrade(Components& component, uint32_t version) const;
+
+        /*!***********************************************************************
+        \brief		Mark the fields whose values differ from a baseline of the
+                    same type. A changed array field is marked as a whole.
+        \param      component The component, baseline The component it is
+                    compared against, changed Receives one entry per field.
+        \return     The number of changed fields.
+        *************************************************************************/
+        size_t DiffFields(const Components& component, const Components& baseline, std::vector<uint8_t>& changed) const;
+
+        /*!***********************************************************************
+        \brief		Find the field for a JSON key.
+
+                    Members are usually in the order WriteJson wrote them, so
+                    the field after the previous match is tried first.
+        \param      key The key, length The key length,
+                    cursor The index after the previous match, updated.
+        \return     The field, nullptr if the key is neither in the table nor
+                    an alias.
+        *************************************************************************/
+        const FieldInfo* FindField(const char* key, size_t length, size_t& cursor) const;
+
+        /*!***********************************************************************
+        \brief		Find the field with an ID.
+        \param      id The field ID.
+        \return     The field, nullptr if no field has the ID.
+        *************************************************************************/
+        const FieldInfo* FindFieldByID(uint32_t id) const;
+
+    private:
+        ComponentTypeID m_ID;
+        std::string m_Name;
+        std::vector<FieldInfo> m_Fields;
+        std::vector<size_t> m_KeyLengths;
+        PostLoadFunction m_PostLoad;
+        ComponentSchema m_Schema;
+    };
+
+    namespace ComponentReflection
+    {
+        /*!***********************************************************************
+        \brief		Get the descriptors of every serializable component, indexed
+                    by ComponentTypeID.
+        *************************************************************************/
+        const std::vector<ComponentDescriptor>& GetDescriptors();
+
+        /*!***********************************************************************
+        \brief		Get the descriptor of a component type.
+        \param      id The component type.
+        \return     The descriptor, nullptr for ComponentTypeID::INVALID.
+        *************************************************************************/
+        const ComponentDescriptor* GetDescriptor(ComponentTypeID id);
+
+        /*!***********************************************************************
+        \brief		Find the descriptor of a component type.
+        \param      typeName The component type name.
+        \return     The descriptor, nullptr if the type is not described.
+        *************************************************************************/
+        const ComponentDescriptor* FindDescriptor(const std::string& typeName);
+
+        /*!***********************************************************************
+        \brief		Map a component type name to its ID.
+
+                    The names are placed by a perfect hash built once, so a
+                    lookup is one hash and one compare.
+        \param      key The type name, length The name length.
+        \return     The ID, ComponentTypeID::INVALID for unknown names.
+        *************************************************************************/
+        ComponentTypeID FindComponentID(const char* key, size_t length);
+        ComponentTypeID FindComponentID(const std::string& typeName);
+
+        /*!***********************************************************************
+        \brief		Get the type name of a component type.
+        \param      id The component type.
+        \return     The name, an empty string for ComponentTypeID::INVALID.
+        *************************************************************************/
+        const char* GetComponentName(ComponentTypeID id);
+
+        /*!***********************************************************************
+        \brief		Read a field value in the binary layout of a field type, for
+                    readers of field tables other than this build's.
+        \param      reader The reader, type The field type, not CUSTOM,
+                    value Receives the value.
+        \return     False if the data was truncated.
+        *************************************************************************/
+        bool ReadBinaryField(BinaryReader& reader, FieldType type, FieldValue& value);
+    }
+}
+
+//____________________________FIELD TABLE MACROS_______________________________
+//Used inside SOL_COMPONENT, where Self names the component type and _id is the
+//field's stable ID, see the top of this file.
+
+//A scalar field backed by one member
+#define SOL_FIELD(_id, _key, _type, _member) \
+    SOL_FIELD_GETSET(_id, _key, _type, _member, _member)
+
+//A scalar field written from one member and read into another
+#define SOL_FIELD_GETSET(_id, _key, _type, _getMember, _setMember)                                   \
+    SOL::FieldInfo{ _key, SOL::FieldType::_type, 1,                                                  \
+        [](const SOL::Components& _c, uint32_t, SOL::FieldValue& _v)                                 \
+        { SOL::FieldValue::Store(_v, static_cast<const Self&>(_c)._getMember); },                    \
+        [](SOL::Components& _c, uint32_t, const SOL::FieldValue& _v)                                 \
+        { SOL::FieldValue::Load(_v, static_cast<Self&>(_c)._setMember); },                           \
+        nullptr, nullptr, nullptr, nullptr, _id }
+
+//A two element JSON array backed by two members
+#define SOL_FIELD_VEC2(_id, _key, _type, _x, _y)                                                     \
+    SOL::FieldInfo{ _key, SOL::FieldType::_type, 2,                                                  \
+        [](const SOL::Components& _c, uint32_t _i, SOL::FieldValue& _v)                              \
+        { const Self& _s = static_cast<const Self&>(_c);                                             \
+          if (_i == 0) SOL::FieldValue::Store(_v, _s._x); else SOL::FieldValue::Store(_v, _s._y); }, \
+        [](SOL::Components& _c, uint32_t _i, const SOL::FieldValue& _v)                              \
+        { Self& _s = static_cast<Self&>(_c);                                                         \
+          if (_i == 0) SOL::FieldValue::Load(_v, _s._x); else SOL::FieldValue::Load(_v, _s._y); },   \
+        nullptr, nullptr, nullptr, nullptr, _id }
+
+//A three element JSON array backed by three members
+#define SOL_FIELD_VEC3(_id, _key, _type, _x, _y, _z)                                                 \
+    SOL::FieldInfo{ _key, SOL::FieldType::_type, 3,                                                  \
+        [](const SOL::Components& _c, uint32_t _i, SOL::FieldValue& _v)                              \
+        { const Self& _s = static_cast<const Self&>(_c);                                             \
+          if (_i == 0) SOL::FieldValue::Store(_v, _s._x);                                            \
+          else if (_i == 1) SOL::FieldValue::Store(_v, _s._y);                                       \
+          else SOL::FieldValue::Store(_v, _s._z); },                                                 \
+        [](SOL::Components& _c, uint32_t _i, const SOL::FieldValue& _v)                              \
+        { Self& _s = static_cast<Self&>(_c);                                                         \
+          if (_i == 0) SOL::FieldValue::Load(_v, _s._x);                                             \
+          else if (_i == 1) SOL::FieldValue::Load(_v, _s._y);                                        \
+          else SOL::FieldValue::Load(_v, _s._z); },                                                  \
+        nullptr, nullptr, nullptr, nullptr, _id }
+
+//A field with hand written codecs, for containers the table cannot express
+#define SOL_FIELD_CUSTOM(_id, _key, _writeJson, _readJson, _writeBinary, _readBinary)                \
+    SOL::FieldInfo{ _key, SOL::FieldType::CUSTOM, 1, nullptr, nullptr,                              \
+        _writeJson, _readJson, _writeBinary, _readBinary, _id }
+
+//Describe a component, the remaining arguments are its fields in write order
+#define SOL_COMPONENT(_component, ...) \
+    SOL_COMPONENT_POSTLOAD(_component, nullptr, __VA_ARGS__)
+
+//Describe a component that needs fixing up after every decode
+#define SOL_COMPONENT_POSTLOAD(_component, _postLoad, ...) \
+    SOL_COMPONENT_SCHEMA(_component, _postLoad, SOL::ComponentSchema{}, __VA_ARGS__)
+
+//Describe a component with a version history, _schema is an expression giving its ComponentSchema
+#define SOL_COMPONENT_SCHEMA(_component, _postLoad, _schema, ...)                                    \
+    [] { using Self = SOL::_component;                                                               \
+         return SOL::ComponentDescriptor(SOL::ComponentTypeID::_component, { __VA_ARGS__ }, _postLoad, _schema); }()
+
+#endif  //_COMPONENTREFLECTION_H_
@@ -0,0 +1,291 @@
+/******************************************************************************/
+/*!
+\file		CookedSceneCache.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the CookedSceneCache class,
+		which keeps a binary scene of every scene JSON that was loaded so
+		unchanged scenes skip JSON parsing
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "CookedSceneCache.h"
+#include "BinaryScene.h"
+#include "Prefab.h"
+#include "TileLayers.h"
+#include "JsonParseContext.h"
+#include "SOL/AssetManager/VirtualFileSystem.h"
+#include "SOL/AssetManager/MappedFile.h"
+#include "SOL/AssetManager/ContentHash.h"
+#include <memory>
+
+#ifndef SOL_ENGINE_BUILD_ID
+#define SOL_ENGINE_BUILD_ID __DATE__ " " __TIME__
+#endif
+
+namespace SOL
+{
+	namespace
+	{
+		const char* const s_CookedExtension = ".solscene";
+
+		/*!***********************************************************************
+		\brief		Check if a top level member holds the entities of a scene
+		*************************************************************************/
+		bool IsEntityMember(const JsonValue& name)
+		{
+			return std::strcmp(name.GetString(), "Entities") == 0 || std::strcmp(name.GetString(), TileLayers::s_TileLayersKey) == 0;
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Get the cache shared by every scene load
+	*************************************************************************/
+	CookedSceneCache& CookedSceneCache::Get()
+	{
+		static CookedSceneCache s_Cache;
+		return s_Cache;
+	}
+
+	/*!***********************************************************************
+	\brief		Constructor for CookedSceneCache class
+	*************************************************************************/
+	CookedSceneCache::CookedSceneCache(const std::string& cacheDir)
+		: m_cacheDir(VirtualFileSystem::Get().getWritePath(cacheDir))
+	{
+		if (!m_cacheDir.empty() && m_cacheDir.back() != '/' && m_cacheDir.back() != '\\')
+			m_cacheDir += '/';
+	}
+
+	/*!***********************************************************************
+	\brief		Hash every component field table
+	*************************************************************************/
+	uint64_t CookedSceneCache::GetSchemaHash()
+	{
+		static const uint64_t s_SchemaHash = []()
+		{
+			ContentHash hash = hashBytes(&BinaryScene::s_SchemaVersion, sizeof(BinaryScene::s_SchemaVersion));
+			for (const ComponentDescriptor& descriptor : ComponentReflection::GetDescriptors())
+			{
+				const uint32_t version = descriptor.GetVersion();
+				hash = hashBytes(descriptor.GetName().c_str(), descriptor.GetName().size() + 1, hash);
+				hash = hashBytes(&version, sizeof(version), hash);
+				for (const FieldInfo& field : descriptor.GetFields())
+				{
+					const uint32_t shape[3] = { static_cast<uint32_t>(field.m_Type), field.m_Count, field.m_ID };
+					hash = hashBytes(field.m_Key, std::strlen(field.m_Key) + 1, hash);
+					hash = hashBytes(shape, sizeof(shape), hash);
+				}
+			}
+			return hash;
+		}();
+		return s_SchemaHash;
+	}
+
+	/*!***********************************************************************
+	\brief		Get the key of a scene from its JSON bytes, the schema, the
+				binary format and the engine build
+	*************************************************************************/
+	uint64_t CookedSceneCache::GetKey(const void* json, size_t size)
+	{
+		static const char s_BuildID[] = SOL_ENGINE_BUILD_ID;
+		const uint64_t schema[2] = { GetSchemaHash(), BinaryScene::s_FormatVersion };
+
+		ContentHash key = hashBytes(json, size);
+		key = hashBytes(schema, sizeof(schema), key);
+		return hashBytes(s_BuildID, sizeof(s_BuildID), key);
+	}
+
+	/*!***********************************************************************
+	\brief		Get the prefix shared by every entry of a scene, the hash of
+				its normalized path
+	*************************************************************************/
+	std::string CookedSceneCache::GetEntryPrefix(const std::string& scenePath) const
+	{
+		const std::string path = std::filesystem::path(scenePath).lexically_normal().generic_string();
+		return hashToString(hashBytes(path.data(), path.size())) + "-";
+	}
+
+	/*!***********************************************************************
+	\brief		Load a scene JSON, from its cooked entry if it is current,
+				cooking it otherwise
+	*************************************************************************/
+	bool CookedSceneCache::LoadScene(Serializer& serializer, const std::string& scenePath, const EntityCallback& onEntity,
+		const SceneDataCallback& onSceneData)
+	{
+		MappedFile source;
+		if (!VirtualFileSystem::Get().mapFile(scenePath, source))
+		{
+			ENGINE_ERROR("Could not open the scene file.");
+			std::cerr << "Error: Could not open " << scenePath << ".\n";
+			return false;
+		}
+
+		const uint64_t key = GetKey(source.data(), source.size());
+		const std::string entryPath = m_cacheDir + GetEntryPrefix(scenePath) + hashToString(key) + s_CookedExtension;
+
+		std::error_code ec;
+		BinaryScene cooked;
+		if (std::filesystem::exists(entryPath, ec) && cooked.Open(entryPath))
+		{
+			// Decode the whole entry before handing anything out, so a corrupt one can still fall back to the JSON
+			rapidjson::Document data;
+			bool valid = !onSceneData || cooked.GetSceneData(data);
+
+			std::vector<std::unique_ptr<Prefab>> entities;
+			entities.reserve(cooked.GetEntityCount());
+			for (size_t index = 0; valid && index < cooked.GetEntityCount(); ++index)
+			{
+				entities.push_back(std::make_unique<Prefab>());
+				valid = cooked.DeserializeEntity(serializer, index, *entities.back());
+			}
+
+			if (valid)
+			{
+				++m_hits;
+				if (onSceneData)
+				{
+					for (auto it = data.MemberBegin(); it != data.MemberEnd(); ++it)
+					{
+						onSceneData(it->name.GetString(), it->value);
+					}
+				}
+				for (const std::unique_ptr<Prefab>& entity : entities)
+				{
+					onEntity(*entity);
+				}
+				return true;
+			}
+
+			// Drop the entry and load the JSON, which cooks it again
+			ENGINE_ERROR("Cooked scene entry is corrupt.");
+			std::cerr << "Error: " << entryPath << " is corrupt, loading " << scenePath << " instead.\n";
+			entities.clear();
+			cooked = BinaryScene();
+			Invalidate(scenePath);
+		}
+
+		// Miss: the JSON is parsed in place, after it was hashed
+		++m_misses;
+		JsonParseContext::Lease context = JsonParseContext::Acquire();
+		const JsonParseContext::Document& scene = context->ParseInsitu(source.data());
+		if (scene.HasParseError() || !scene.IsObject())
+		{
+			ENGINE_ERROR("Scene is not valid JSON.");
+			std::cerr << "Error: " << scenePath << " is not valid JSON.\n";
+			return false;
+		}
+
+		for (auto it = scene.MemberBegin(); onSceneData && it != scene.MemberEnd(); ++it)
+		{
+			if (!IsEntityMember(it->name))
+				onSceneData(it->name.GetString(), it->value);
+		}
+
+		rapidjson::Document tiles;
+		std::vector<const JsonValue*> entities;
+		if (!TileLayers::GatherEntities(scene, tiles, entities))
+		{
+			ENGINE_ERROR("Scene tile layers are corrupt.");
+			return false;
+		}
+		for (const JsonValue* element : entities)
+		{
+			if (!element->IsObject())
+				continue;
+			Prefab entity;
+			entity.DeserializeSceneEntity(serializer, *element);
+			onEntity(entity);
+		}
+
+		Store(scenePath, key, scene);
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Map the cooked entry of a scene JSON if it is current
+	*************************************************************************/
+	bool CookedSceneCache::OpenCooked(const std::string& scenePath, BinaryScene& scene)
+	{
+		MappedFile source;
+		if (!VirtualFileSystem::Get().mapFile(scenePath, source))
+			return false;
+
+		const std::string entryPath = m_cacheDir + GetEntryPrefix(scenePath) + hashToString(GetKey(source.data(), source.size())) + s_CookedExtension;
+		std::error_code ec;
+		return std::filesystem::exists(entryPath, ec) && scene.Open(entryPath);
+	}
+
+	/*!***********************************************************************
+	\brief		Write the entry of a parsed scene, replacing older ones. The
+				entry is written to a temporary file and renamed, so a reader
+				never maps half an entry
+	*************************************************************************/
+	bool CookedSceneCache::Store(const std::string& scenePath, uint64_t key, const JsonValue& scene)
+	{
+		std::vector<uint8_t> bytes;
+		if (!BinaryScene::Encode(scene, bytes))
+			return false;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		RemoveEntries(GetEntryPrefix(scenePath));
+
+		namespace fs = std::filesystem;
+		std::error_code ec;
+		fs::create_directories(m_cacheDir, ec);
+
+		const std::string entryPath = m_cacheDir + GetEntryPrefix(scenePath) + hashToString(key) + s_CookedExtension;
+		const std::string tempPath = entryPath + ".tmp";
+		{
+			std::ofstream file(tempPath, std::ios::binary);
+			if (!file.is_open())
+			{
+				ENGINE_WARN("Could not write the cooked scene cache.");
+				return false;
+			}
+			file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+			if (!file.good())
+				return false;
+		}
+		fs::rename(tempPath, entryPath, ec);
+		if (ec)
+		{
+			fs::remove(tempPath, ec);
+			return false;
+		}
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Remove the cooked entries of a scene
+	*************************************************************************/
+	void CookedSceneCache::Invalidate(const std::string& scenePath)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		RemoveEntries(GetEntryPrefix(scenePath));
+	}
+
+	/*!***********************************************************************
+	\brief		Remove every entry starting with a prefix
+	*************************************************************************/
+	void CookedSceneCache::RemoveEntries(const std::string& prefix)
+	{
+		namespace fs = std::filesystem;
+		std::error_code ec;
+		std::vector<fs::path> stale;
+		for (fs::directory_iterator it(m_cacheDir, ec), end; !ec && it != end; it.increment(ec))
+		{
+			if (it->path().filename().string().compare(0, prefix.size(), prefix) == 0)
+				stale.push_back(it->path());
+		}
+		for (const fs::path& path : stale)
+		{
+			fs::remove(path, ec);
+		}
+	}
+}
@@ -0,0 +1,138 @@
+/******************************************************************************/
+/*!
+\file       CookedSceneCache.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the CookedSceneCache
+            class, which keeps a binary scene of every scene JSON that was
+            loaded so unchanged scenes skip JSON parsing
+
+            The first load of a scene parses its JSON, hands the entities out
+            and stores the scene as a .solscene in the cache directory. The
+            entry is keyed by the hash of the JSON bytes, the component schema
+            (BinaryScene::s_SchemaVersion and a fingerprint of every field
+            table) and the engine build, so any change to the scene file, be
+            it an editor save, an edit journal compaction or a change made by
+            hand, or to the component tables misses the cache and cooks again.
+            Later loads map the entry and read the entities from it.
+
+            Each scene keeps one entry, named by the hash of its path and the
+            key, older entries of the same scene are removed when a new one is
+            stored.
+
+            Define SOL_ENGINE_BUILD_ID to a string that changes with every
+            engine build, the build date and time of CookedSceneCache.cpp is
+            used otherwise.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _COOKEDSCENECACHE_H_
+#define _COOKEDSCENECACHE_H_
+
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include "SceneStreamReader.h"
+#include "ComponentReflection.h"
+
+namespace SOL
+{
+    class Serializer;
+    class BinaryScene;
+
+    class CookedSceneCache
+    {
+    public:
+
+        using EntityCallback = SceneStreamReader::EntityCallback;
+        using SceneDataCallback = SceneStreamReader::SceneDataCallback;
+
+        /*!***********************************************************************
+        \brief		Get the cache shared by every scene load.
+        *************************************************************************/
+        static CookedSceneCache& Get();
+
+        /*!***********************************************************************
+        \brief		Constructor for CookedSceneCache class.
+        \param      cacheDir The directory entries are stored in, resolved
+                    through VirtualFileSystem::getWritePath.
+        *************************************************************************/
+        explicit CookedSceneCache(const std::string& cacheDir = "./Json/.cooked/");
+
+        /*!***********************************************************************
+        \brief		Load a scene JSON, from its cooked entry if it is current,
+                    cooking it otherwise.
+        \param      serializer The serializer, scenePath The scene JSON,
+                    onEntity Called with every entity in file order,
+                    onSceneData Called with every top level member except
+                    "Entities" and "TileLayers", may be nullptr.
+        \return     False if the scene could not be read, entities before the
+                    error have already been handed out. A corrupt cooked
+                    entry is decoded in full before any entity is handed out
+                    and falls back to the JSON.
+        *************************************************************************/
+        bool LoadScene(Serializer& serializer, const std::string& scenePath, const EntityCallback& onEntity,
+                       const SceneDataCallback& onSceneData = nullptr);
+
+        /*!***********************************************************************
+        \brief		Map the cooked entry of a scene JSON if it is current.
+        \param      scenePath The scene JSON, scene Receives the entry.
+        \return     True on a hit.
+        *************************************************************************/
+        bool OpenCooked(const std::string& scenePath, BinaryScene& scene);
+
+        /*!***********************************************************************
+        \brief		Remove the cooked entries of a scene.
+        \param      scenePath The scene JSON.
+        *************************************************************************/
+        void Invalidate(const std::string& scenePath);
+
+        /*!***********************************************************************
+        \brief		Get the number of loads served from and missing the cache.
+        *************************************************************************/
+        size_t GetHitCount() const { return m_hits; }
+        size_t GetMissCount() const { return m_misses; }
+
+        /*!***********************************************************************
+        \brief		Get the hash of every component field table, which changes
+                    whenever a version, key, type, element count or field ID
+                    changes.
+        *************************************************************************/
+        static uint64_t GetSchemaHash();
+
+    private:
+
+        /*!***********************************************************************
+        \brief		Get the key of a scene from its JSON bytes.
+        *************************************************************************/
+        static uint64_t GetKey(const void* json, size_t size);
+
+        /*!***********************************************************************
+        \brief		Get the prefix shared by every entry of a scene.
+        *************************************************************************/
+        std::string GetEntryPrefix(const std::string& scenePath) const;
+
+        /*!***********************************************************************
+        \brief		Write the entry of a parsed scene, replacing older ones.
+        *************************************************************************/
+        bool Store(const std::string& scenePath, uint64_t key, const JsonValue& scene);
+
+        /*!***********************************************************************
+        \brief		Remove every entry starting with a prefix, m_mutex must be
+                    held.
+        *************************************************************************/
+        void RemoveEntries(const std::string& prefix);
+
+        std::string m_cacheDir;
+        std::mutex m_mutex;         //guards writing and removing entries
+        std::atomic<size_t> m_hits{};
+        std::atomic<size_t> m_misses{};
+    };
+}
+#endif  //_COOKEDSCENECACHE_H_
@@ -0,0 +1,582 @@
+/******************************************************************************/
+/*!
+\file		EditJournal.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the EditJournal class, the
+		append only log of editor edits used for crash safe autosave
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "EditJournal.h"
+#include "Serializer.h"
+#include "TileLayers.h"
+#include "PrefabBaselines.h"
+#include "CookedSceneCache.h"
+#include "SOL/AssetManager/ContentHash.h"
+#include "SOL/AssetManager/VirtualFileSystem.h"
+#include <map>
+#include <numeric>
+#include <cstring>
+#include <filesystem>
+
+namespace SOL
+{
+	namespace
+	{
+		const char s_JournalMagic[4] = { 'S', 'J', 'N', 'L' };
+		const char* const s_JournalExtension = ".journal";
+
+		#pragma pack(push, 1)
+		struct JournalHeader
+		{
+			char m_Magic[4];
+			uint32_t m_Version;
+			uint64_t m_BaseHash;	//hash of the scene file the records apply to
+		};
+		#pragma pack(pop)
+
+		struct JournalRecord
+		{
+			uint8_t m_Operation;
+			uint64_t m_Key;
+			std::string m_Type;
+			std::string m_Json;
+			std::vector<uint64_t> m_Keys;
+		};
+
+		/*!***********************************************************************
+		\brief		Frame a record payload with its size and checksum
+		*************************************************************************/
+		std::vector<uint8_t> FrameRecord(const std::vector<uint8_t>& payload)
+		{
+			BinaryWriter frame;
+			frame.Write(static_cast<uint32_t>(payload.size()));
+			frame.Write(static_cast<uint64_t>(hashBytes(payload.data(), payload.size())));
+			frame.WriteBytes(payload.data(), payload.size());
+			return std::move(frame.GetBytes());
+		}
+
+		/*!***********************************************************************
+		\brief		Write a file through a temporary so a crash never leaves it
+					half written
+		*************************************************************************/
+		bool ReplaceFile(const std::string& filePath, const char* data, size_t size)
+		{
+			const std::string temporary = filePath + ".tmp";
+			std::FILE* file = std::fopen(temporary.c_str(), "wb");
+			if (file == nullptr)
+				return false;
+
+			const bool written = std::fwrite(data, 1, size, file) == size && std::fflush(file) == 0;
+			std::fclose(file);
+
+			std::error_code ec;
+			if (written)
+				std::filesystem::rename(temporary, filePath, ec);
+			if (!written || ec)
+			{
+				std::filesystem::remove(temporary, ec);
+				return false;
+			}
+			return true;
+		}
+
+		/*!***********************************************************************
+		\brief		Read the records of a journal, stopping at the first torn or
+					corrupt one
+		\return		False if the journal does not apply to the scene hash
+		*************************************************************************/
+		bool ReadJournal(const std::vector<uint8_t>& journal, ContentHash sceneHash, std::vector<JournalRecord>& records)
+		{
+			BinaryReader reader(journal.data(), journal.size());
+			JournalHeader header{};
+			if (!reader.Read(header) || std::memcmp(header.m_Magic, s_JournalMagic, sizeof(s_JournalMagic)) != 0 ||
+				header.m_Version != EditJournal::s_JournalVersion || header.m_BaseHash != sceneHash)
+			{
+				return false;
+			}
+
+			while (reader.GetRemaining() != 0)
+			{
+				uint32_t size{};
+				uint64_t checksum{};
+				if (!reader.Read(size) || !reader.Read(checksum) || size > reader.GetRemaining() ||
+					hashBytes(reader.GetCurrent(), size) != checksum)
+				{
+					ENGINE_WARN("Edit journal ends in a torn record, it was dropped");
+					break;
+				}
+
+				BinaryReader payload(reader.GetCurrent(), size);
+				reader.Skip(size);
+
+				JournalRecord record;
+				uint64_t count{};
+				if (!payload.Read(record.m_Operation) || !payload.ReadVarint(record.m_Key) ||
+					!payload.ReadString(record.m_Type) || !payload.ReadString(record.m_Json) || !payload.ReadVarint(count))
+				{
+					break;
+				}
+				for (uint64_t k = 0, key = 0; k < count && payload.ReadVarint(key); ++k)
+				{
+					record.m_Keys.push_back(key);
+				}
+				records.push_back(std::move(record));
+			}
+			return true;
+		}
+
+		/*!***********************************************************************
+		\brief		Write a prefab delta entity out in full so a component can be
+					removed from it, the same rule PrefabBaselines::WriteDelta
+					uses. Fields the delta overrides are kept.
+		\return		False if the prefab could not be read
+		*************************************************************************/
+		bool ExpandPrefabDelta(rapidjson::Value& entity, rapidjson::Document::AllocatorType& allocator)
+		{
+			auto prefabMember = entity.FindMember(PrefabBaselines::s_PrefabKey);
+			if (prefabMember == entity.MemberEnd() || !prefabMember->value.IsString())
+				return true;
+
+			const std::string json = Serializer::readJsonFile(prefabMember->value.GetString());
+			rapidjson::Document prefab;
+			if (json.empty() || prefab.Parse(json.c_str(), json.size()).HasParseError() || !prefab.IsObject())
+				return false;
+
+			for (auto it = prefab.MemberBegin(); it != prefab.MemberEnd(); ++it)
+			{
+				auto component = entity.FindMember(it->name);
+				if (component == entity.MemberEnd())
+				{
+					entity.AddMember(rapidjson::Value(it->name, allocator), rapidjson::Value(it->value, allocator), allocator);
+					continue;
+				}
+
+				// The delta only holds the changed fields, the rest come from the prefab
+				if (!component->value.IsObject() || !it->value.IsObject())
+					continue;
+				for (auto field = it->value.MemberBegin(); field != it->value.MemberEnd(); ++field)
+				{
+					if (component->value.FindMember(field->name) == component->value.MemberEnd())
+						component->value.AddMember(rapidjson::Value(field->name, allocator), rapidjson::Value(field->value, allocator), allocator);
+				}
+			}
+			entity.RemoveMember(PrefabBaselines::s_PrefabKey);
+			return true;
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Start journaling edits to a scene, first replaying a journal
+				left behind by a crash
+	*************************************************************************/
+	bool EditJournal::Open(const std::string& scenePath)
+	{
+		Close();
+
+		m_scenePath = VirtualFileSystem::Get().getWritePath(scenePath);
+		m_journalPath = m_scenePath + s_JournalExtension;
+		if (Recover(m_scenePath))
+		{
+			ENGINE_INFO("Recovered unsaved edits of " + scenePath);
+		}
+
+		std::vector<uint8_t> sceneBytes;
+		rapidjson::Document scene;
+		if (!readFileBytes(m_scenePath, sceneBytes) ||
+			scene.Parse(reinterpret_cast<const char*>(sceneBytes.data()), sceneBytes.size()).HasParseError() ||
+			!scene.IsObject() || !scene.HasMember("Entities") || !scene["Entities"].IsArray())
+		{
+			ENGINE_ERROR("Edit journal could not read " + scenePath);
+			return false;
+		}
+		TileLayers::Expand(scene);
+		m_nextKey = scene["Entities"].Size();
+
+		if (!StartJournal({}))
+			return false;
+
+		m_stopping = false;
+		m_thread = std::thread(&EditJournal::WriterLoop, this);
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Write every queued edit and stop the background thread
+	*************************************************************************/
+	void EditJournal::Close()
+	{
+		if (m_thread.joinable())
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_stopping = true;
+			}
+			m_wake.notify_one();
+			m_thread.join();
+		}
+
+		if (m_file != nullptr)
+		{
+			std::fclose(m_file);
+			m_file = nullptr;
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Record an entity created in the editor
+	*************************************************************************/
+	void EditJournal::RecordCreateEntity(uint64_t entityKey)
+	{
+		BinaryWriter payload;
+		payload.Write(static_cast<uint8_t>(Operation::CREATE_ENTITY));
+		payload.WriteVarint(entityKey);
+		payload.WriteString("");
+		payload.WriteString("");
+		payload.WriteVarint(0);
+		Enqueue(std::move(payload));
+	}
+
+	/*!***********************************************************************
+	\brief		Record an entity destroyed in the editor
+	*************************************************************************/
+	void EditJournal::RecordDestroyEntity(uint64_t entityKey)
+	{
+		BinaryWriter payload;
+		payload.Write(static_cast<uint8_t>(Operation::DESTROY_ENTITY));
+		payload.WriteVarint(entityKey);
+		payload.WriteString("");
+		payload.WriteString("");
+		payload.WriteVarint(0);
+		Enqueue(std::move(payload));
+	}
+
+	/*!***********************************************************************
+	\brief		Record the new state of a component, serialized now so later
+				edits to it do not race the background thread
+	*************************************************************************/
+	void EditJournal::RecordComponent(uint64_t entityKey, Serializer& serializer, const std::string& typeName, const Components& component)
+	{
+		rapidjson::StringBuffer buffer;
+		Serializer::Writer writer(buffer);
+		serializer.Serialize(writer, typeName, component);
+
+		BinaryWriter payload;
+		payload.Write(static_cast<uint8_t>(Operation::SET_COMPONENT));
+		payload.WriteVarint(entityKey);
+		payload.WriteString(typeName);
+		payload.WriteString(std::string(buffer.GetString(), buffer.GetSize()));
+		payload.WriteVarint(0);
+		Enqueue(std::move(payload));
+	}
+
+	/*!***********************************************************************
+	\brief		Record a component removed from an entity
+	*************************************************************************/
+	void EditJournal::RecordRemoveComponent(uint64_t entityKey, const std::string& typeName)
+	{
+		BinaryWriter payload;
+		payload.Write(static_cast<uint8_t>(Operation::REMOVE_COMPONENT));
+		payload.WriteVarint(entityKey);
+		payload.WriteString(typeName);
+		payload.WriteString("");
+		payload.WriteVarint(0);
+		Enqueue(std::move(payload));
+	}
+
+	/*!***********************************************************************
+	\brief		Queue an encoded record for the background thread
+	*************************************************************************/
+	void EditJournal::Enqueue(BinaryWriter&& payload)
+	{
+		if (!m_thread.joinable())
+			return;
+
+		std::vector<uint8_t> frame = FrameRecord(payload.GetBytes());
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_queue.push_back(std::move(frame));
+			++m_queuedCount;
+		}
+		m_wake.notify_one();
+	}
+
+	/*!***********************************************************************
+	\brief		Block until every recorded edit is in the journal file
+	*************************************************************************/
+	void EditJournal::Flush()
+	{
+		if (!m_thread.joinable())
+			return;
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		const uint64_t target = m_queuedCount;
+		m_written.wait(lock, [&]() { return m_writtenCount >= target; });
+	}
+
+	/*!***********************************************************************
+	\brief		Ask the background thread to fold the journal into the scene
+	*************************************************************************/
+	void EditJournal::RequestCompaction()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_compactRequested = true;
+		}
+		m_wake.notify_one();
+	}
+
+	/*!***********************************************************************
+	\brief		Background thread, appends queued records and compacts
+	*************************************************************************/
+	void EditJournal::WriterLoop()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (true)
+		{
+			m_wake.wait(lock, [&]() { return m_stopping || m_compactRequested || !m_queue.empty(); });
+
+			std::vector<std::vector<uint8_t>> batch;
+			batch.swap(m_queue);
+			const uint64_t batchEnd = m_queuedCount;
+			const bool compact = m_compactRequested;
+			const bool stopping = m_stopping;
+			m_compactRequested = false;
+			lock.unlock();
+
+			if (m_file != nullptr)
+			{
+				for (const std::vector<uint8_t>& frame : batch)
+				{
+					m_journalSize += std::fwrite(frame.data(), 1, frame.size(), m_file);
+				}
+				std::fflush(m_file);
+			}
+
+			if (compact || m_journalSize >= m_compactionSize)
+			{
+				Compact();
+			}
+
+			lock.lock();
+			m_writtenCount = batchEnd;
+			m_written.notify_all();
+			if (stopping && m_queue.empty())
+				break;
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Fold the journal into the scene file and start a new journal
+	*************************************************************************/
+	bool EditJournal::Compact()
+	{
+		if (m_file != nullptr)
+		{
+			std::fclose(m_file);
+			m_file = nullptr;
+		}
+
+		std::vector<uint64_t> keys;
+		const int result = ReplayInto(m_scenePath, m_journalPath, keys);
+		if (result < 0)
+		{
+			// Keep appending to the journal, the edits are still recoverable from it
+			ENGINE_ERROR("Edit journal compaction failed for " + m_scenePath);
+			m_file = std::fopen(m_journalPath.c_str(), "ab");
+			return false;
+		}
+		if (result == 0)
+		{
+			// The scene was saved some other way, its entities are numbered from scratch
+			ENGINE_WARN("Scene " + m_scenePath + " changed outside the edit journal, journal restarted");
+		}
+		else
+		{
+			// The scene file was rewritten, drop its cooked entry now instead of on the next load
+			CookedSceneCache::Get().Invalidate(m_scenePath);
+		}
+		return StartJournal(keys);
+	}
+
+	/*!***********************************************************************
+	\brief		Start a new journal for the current scene file
+	*************************************************************************/
+	bool EditJournal::StartJournal(const std::vector<uint64_t>& keys)
+	{
+		if (m_file != nullptr)
+			std::fclose(m_file);
+
+		m_file = std::fopen(m_journalPath.c_str(), "wb");
+		if (m_file == nullptr)
+		{
+			ENGINE_ERROR("Could not open edit journal " + m_journalPath);
+			return false;
+		}
+
+		JournalHeader header{};
+		std::memcpy(header.m_Magic, s_JournalMagic, sizeof(s_JournalMagic));
+		header.m_Version = s_JournalVersion;
+		header.m_BaseHash = hashFile(m_scenePath);
+		m_journalSize = std::fwrite(&header, 1, sizeof(header), m_file);
+
+		if (!keys.empty())
+		{
+			BinaryWriter payload;
+			payload.Write(static_cast<uint8_t>(Operation::ENTITY_KEYS));
+			payload.WriteVarint(0);
+			payload.WriteString("");
+			payload.WriteString("");
+			payload.WriteVarint(keys.size());
+			for (uint64_t key : keys)
+			{
+				payload.WriteVarint(key);
+			}
+
+			const std::vector<uint8_t> frame = FrameRecord(payload.GetBytes());
+			m_journalSize += std::fwrite(frame.data(), 1, frame.size(), m_file);
+		}
+		std::fflush(m_file);
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Replay a journal left behind by a crash into its scene file
+	*************************************************************************/
+	bool EditJournal::Recover(const std::string& scenePath)
+	{
+		const std::string journalPath = scenePath + s_JournalExtension;
+		std::error_code ec;
+		if (!std::filesystem::exists(journalPath, ec))
+			return false;
+
+		std::vector<uint64_t> keys;
+		const int result = ReplayInto(scenePath, journalPath, keys);
+		if (result < 0)
+		{
+			ENGINE_ERROR("Edit journal " + journalPath + " could not be replayed, it was kept");
+			return false;
+		}
+
+		std::filesystem::remove(journalPath, ec);
+		return result > 0;
+	}
+
+	/*!***********************************************************************
+	\brief		Replay a journal file into a scene file
+	*************************************************************************/
+	int EditJournal::ReplayInto(const std::string& scenePath, const std::string& journalPath, std::vector<uint64_t>& keys)
+	{
+		std::vector<uint8_t> sceneBytes, journalBytes;
+		if (!readFileBytes(scenePath, sceneBytes))
+			return -1;
+
+		std::vector<JournalRecord> records;
+		if (!readFileBytes(journalPath, journalBytes) || !ReadJournal(journalBytes, hashBytes(sceneBytes.data(), sceneBytes.size()), records))
+			return 0;
+
+		rapidjson::Document scene;
+		scene.Parse(reinterpret_cast<const char*>(sceneBytes.data()), sceneBytes.size());
+		if (scene.HasParseError() || !scene.IsObject() || !scene.HasMember("Entities") || !scene["Entities"].IsArray())
+			return -1;
+
+		// Keys index the entities as loaded, with tile layer blocks expanded
+		TileLayers::Expand(scene);
+		rapidjson::Value& array = scene["Entities"];
+		rapidjson::Document::AllocatorType& allocator = scene.GetAllocator();
+
+		// Entities are keyed by their index until a compaction records the keys
+		std::vector<uint64_t> fileKeys(array.Size());
+		std::iota(fileKeys.begin(), fileKeys.end(), 0);
+		size_t first = 0;
+		if (!records.empty() && records[0].m_Operation == static_cast<uint8_t>(Operation::ENTITY_KEYS) && records[0].m_Keys.size() == fileKeys.size())
+		{
+			fileKeys = records[0].m_Keys;
+			first = 1;
+		}
+
+		std::map<uint64_t, rapidjson::Value> entities;
+		for (rapidjson::SizeType i = 0; i < array.Size(); ++i)
+		{
+			entities[fileKeys[i]].Swap(array[i]);
+		}
+
+		for (size_t r = first; r < records.size(); ++r)
+		{
+			const JournalRecord& record = records[r];
+			switch (static_cast<Operation>(record.m_Operation))
+			{
+			case Operation::CREATE_ENTITY:
+				entities[record.m_Key].SetObject();
+				break;
+
+			case Operation::DESTROY_ENTITY:
+				entities.erase(record.m_Key);
+				break;
+
+			case Operation::SET_COMPONENT:
+			{
+				rapidjson::Value& entity = entities[record.m_Key];
+				if (!entity.IsObject())
+					entity.SetObject();
+
+				rapidjson::Document component(&allocator);
+				if (component.Parse(record.m_Json.c_str(), record.m_Json.size()).HasParseError())
+					break;
+
+				auto it = entity.FindMember(record.m_Type.c_str());
+				if (it != entity.MemberEnd())
+				{
+					it->value.Swap(component);
+				}
+				else
+				{
+					rapidjson::Value name(record.m_Type.c_str(), static_cast<rapidjson::SizeType>(record.m_Type.size()), allocator);
+					rapidjson::Value value;
+					value.Swap(component);
+					entity.AddMember(name, value, allocator);
+				}
+				break;
+			}
+
+			case Operation::REMOVE_COMPONENT:
+			{
+				auto it = entities.find(record.m_Key);
+				if (it == entities.end() || !it->second.IsObject())
+					break;
+
+				// A prefab delta would get the component back from the prefab on the next load
+				if (!ExpandPrefabDelta(it->second, allocator))
+					ENGINE_WARN("Prefab of a journaled entity could not be read, a removed component may come back");
+				it->second.RemoveMember(record.m_Type.c_str());
+				break;
+			}
+
+			default:
+				break;
+			}
+		}
+
+		// Rebuild the array in key order, entities created in the editor go last
+		array.SetArray();
+		keys.clear();
+		for (auto& [key, entity] : entities)
+		{
+			keys.push_back(key);
+			array.PushBack(entity, allocator);
+		}
+		// Compaction is a save, so tile runs are packed like Serializer::writeSceneFile does
+		TileLayers::Pack(scene);
+
+		rapidjson::StringBuffer buffer;
+		Serializer::Writer writer(buffer);
+		scene.Accept(writer);
+		return ReplaceFile(scenePath, buffer.GetString(), buffer.GetSize()) ? 1 : -1;
+	}
+}
@@ -0,0 +1,179 @@
+/******************************************************************************/
+/*!
+\file       EditJournal.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the EditJournal class,
+            the append only log of editor edits used for crash safe autosave
+
+            Every entity and component edit is appended to <scene>.journal on a
+            background thread, so autosave costs the size of the edit instead
+            of a rewrite of the whole scene. Once the journal grows past a
+            threshold it is compacted: replayed into the scene file, which is
+            replaced atomically, and started again. Opening a scene replays a
+            journal left behind by a crash.
+
+            Entities are named by keys. Entities loaded from the scene have
+            their index in the Entities array as key, new entities take keys
+            from NextEntityKey. Keys stay the same across compactions.
+
+            Journal layout:
+                header      magic "SJNL", version, hash of the scene file the
+                            journal applies to
+                records     size, checksum and payload, a torn record at the
+                            end is dropped on replay
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _EDITJOURNAL_H_
+#define _EDITJOURNAL_H_
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "ComponentReflection.h"
+
+namespace SOL
+{
+    class Serializer;
+
+    class EditJournal
+    {
+    public:
+
+        static const uint32_t s_JournalVersion = 1;
+        static const size_t s_DefaultCompactionSize = 4 * 1024 * 1024;  //journal bytes that trigger a compaction
+
+        EditJournal() = default;
+        EditJournal(const EditJournal&) = delete;
+        EditJournal& operator=(const EditJournal&) = delete;
+
+        /*!***********************************************************************
+        \brief		Destructor for EditJournal class, writes every queued edit.
+        *************************************************************************/
+        ~EditJournal() { Close(); }
+
+        /*!***********************************************************************
+        \brief		Start journaling edits to a scene, first replaying a journal
+                    left behind by a crash.
+        \param      scenePath The scene JSON, resolved through the
+                    VirtualFileSystem mounts.
+        \return     False if the scene or the journal could not be opened.
+        *************************************************************************/
+        bool Open(const std::string& scenePath);
+
+        /*!***********************************************************************
+        \brief		Write every queued edit and stop the background thread. The
+                    journal is kept until the next compaction or Open.
+        *************************************************************************/
+        void Close();
+
+        /*!***********************************************************************
+        \brief		Get a key for an entity created in the editor.
+        *************************************************************************/
+        uint64_t NextEntityKey() { return m_nextKey++; }
+
+        /*!***********************************************************************
+        \brief		Record an edit, the edit is copied and written later.
+        \param      entityKey The entity, typeName The component type,
+                    component The component's new state.
+        *************************************************************************/
+        void RecordCreateEntity(uint64_t entityKey);
+        void RecordDestroyEntity(uint64_t entityKey);
+        void RecordComponent(uint64_t entityKey, Serializer& serializer, const std::string& typeName, const Components& component);
+        void RecordRemoveComponent(uint64_t entityKey, const std::string& typeName);
+
+        /*!***********************************************************************
+        \brief		Block until every recorded edit is in the journal file.
+        *************************************************************************/
+        void Flush();
+
+        /*!***********************************************************************
+        \brief		Ask the background thread to fold the journal into the scene
+                    file, e.g. when the editor saves.
+        *************************************************************************/
+        void RequestCompaction();
+
+        /*!***********************************************************************
+        \brief		Set the journal size that triggers a compaction.
+        *************************************************************************/
+        void SetCompactionSize(size_t bytes) { m_compactionSize = bytes; }
+
+        /*!***********************************************************************
+        \brief		Replay a journal left behind by a crash into its scene file.
+        \param      scenePath The scene JSON on disk.
+        \return     True if edits were recovered.
+        *************************************************************************/
+        static bool Recover(const std::string& scenePath);
+
+    private:
+
+        enum class Operation : uint8_t
+        {
+            CREATE_ENTITY,
+            DESTROY_ENTITY,
+            SET_COMPONENT,      //component type and its JSON
+            REMOVE_COMPONENT,   //component type
+            ENTITY_KEYS         //the key of every entity in the scene file, in order
+        };
+
+        /*!***********************************************************************
+        \brief		Queue an encoded record for the background thread.
+        *************************************************************************/
+        void Enqueue(BinaryWriter&& payload);
+
+        /*!***********************************************************************
+        \brief		Background thread, appends queued records and compacts.
+        *************************************************************************/
+        void WriterLoop();
+
+        /*!***********************************************************************
+        \brief		Fold the journal into the scene file and start a new journal.
+        \return     False if the scene file could not be written.
+        *************************************************************************/
+        bool Compact();
+
+        /*!***********************************************************************
+        \brief		Replay a journal file into a scene file.
+        \param      scenePath The scene on disk, journalPath Its journal,
+                    keys Receives the keys of the entities that were written.
+        \return     1 if the scene was rewritten, 0 if the journal did not
+                    apply to it, -1 if the scene could not be read or written.
+        *************************************************************************/
+        static int ReplayInto(const std::string& scenePath, const std::string& journalPath, std::vector<uint64_t>& keys);
+
+        /*!***********************************************************************
+        \brief		Start a new journal for the current scene file.
+        \param      keys The entity keys of the scene file, empty if they are
+                    the entity indices.
+        *************************************************************************/
+        bool StartJournal(const std::vector<uint64_t>& keys);
+
+        std::string m_scenePath;
+        std::string m_journalPath;
+        std::FILE* m_file{};
+        size_t m_journalSize{};
+        size_t m_compactionSize{ s_DefaultCompactionSize };
+        uint64_t m_nextKey{};
+
+        std::thread m_thread;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_written;
+        std::vector<std::vector<uint8_t>> m_queue;
+        uint64_t m_queuedCount{};
+        uint64_t m_writtenCount{};
+        bool m_compactRequested{};
+        bool m_stopping{};
+    };
+}
+#endif  //_EDITJOURNAL_H_
@@ -0,0 +1,195 @@
+/******************************************************************************/
+/*!
+\file		JsonParseContext.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the JsonParseContext class, a
+		reusable arena for rapidjson Documents
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "JsonParseContext.h"
+#include <mutex>
+#include <vector>
+
+namespace SOL
+{
+	namespace
+	{
+		// Room for the chunk header the allocator keeps at the front of its buffer
+		const size_t s_BufferSlack = 256;
+
+		// Matches the stack rapidjson starts a Document with
+		const size_t s_MinStackCapacity = 1024;
+
+		struct ContextPool
+		{
+			std::mutex m_Mutex;
+			std::vector<std::unique_ptr<JsonParseContext>> m_Free;
+		};
+
+		/*!***********************************************************************
+		\brief		Get the pool of contexts that are not leased
+		*************************************************************************/
+		ContextPool& GetPool()
+		{
+			static ContextPool s_Pool;
+			return s_Pool;
+		}
+
+		/*!***********************************************************************
+		\brief		Get the buffer size for a load that used the given bytes,
+					with a quarter to spare so slightly larger loads still fit
+		*************************************************************************/
+		size_t GetGrownCapacity(size_t used)
+		{
+			return used + used / 4 + s_BufferSlack;
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Move a lease, releasing the one held before
+	*************************************************************************/
+	JsonParseContext::Lease& JsonParseContext::Lease::operator=(Lease&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (m_context != nullptr)
+				JsonParseContext::Release(m_context);
+			m_context = other.m_context;
+			other.m_context = nullptr;
+		}
+		return *this;
+	}
+
+	/*!***********************************************************************
+	\brief		Return the context to the pool
+	*************************************************************************/
+	JsonParseContext::Lease::~Lease()
+	{
+		if (m_context != nullptr)
+			JsonParseContext::Release(m_context);
+	}
+
+	/*!***********************************************************************
+	\brief		Constructor for JsonParseContext class, starts with a small
+				value buffer and an empty Document
+	*************************************************************************/
+	JsonParseContext::JsonParseContext()
+		: m_valueBuffer(new char[s_InitialCapacity]), m_stackBuffer(new char[s_MinStackCapacity + s_BufferSlack]),
+		  m_valueCapacity(s_InitialCapacity), m_stackCapacity(s_MinStackCapacity + s_BufferSlack)
+	{
+		m_valueAllocator.emplace(m_valueBuffer.get(), m_valueCapacity);
+		m_stackAllocator.emplace(m_stackBuffer.get(), m_stackCapacity);
+		m_document.emplace(&*m_valueAllocator, s_MinStackCapacity, &*m_stackAllocator);
+	}
+
+	/*!***********************************************************************
+	\brief		Take a context from the pool, or make one if none is free
+	*************************************************************************/
+	JsonParseContext::Lease JsonParseContext::Acquire()
+	{
+		ContextPool& pool = GetPool();
+		{
+			std::lock_guard<std::mutex> lock(pool.m_Mutex);
+			if (!pool.m_Free.empty())
+			{
+				JsonParseContext* context = pool.m_Free.back().release();
+				pool.m_Free.pop_back();
+				return Lease(context);
+			}
+		}
+		return Lease(new JsonParseContext());
+	}
+
+	/*!***********************************************************************
+	\brief		Return a context to the pool, freeing it if the pool is full
+	*************************************************************************/
+	void JsonParseContext::Release(JsonParseContext* context)
+	{
+		std::unique_ptr<JsonParseContext> owned(context);
+		ContextPool& pool = GetPool();
+		std::lock_guard<std::mutex> lock(pool.m_Mutex);
+		if (pool.m_Free.size() < s_MaxPooledContexts)
+			pool.m_Free.push_back(std::move(owned));
+	}
+
+	/*!***********************************************************************
+	\brief		Free every pooled context that is not leased
+	*************************************************************************/
+	void JsonParseContext::ReleasePooled()
+	{
+		std::vector<std::unique_ptr<JsonParseContext>> released;
+		{
+			ContextPool& pool = GetPool();
+			std::lock_guard<std::mutex> lock(pool.m_Mutex);
+			released.swap(pool.m_Free);
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Reset the arena and start an empty Document on it. Buffers the
+				last load overflowed are grown to fit it, otherwise they are
+				only cleared
+	*************************************************************************/
+	JsonParseContext::Document& JsonParseContext::Begin()
+	{
+		m_document.reset();
+
+		const size_t valueUsed = m_valueAllocator->Size();
+		m_stackHighWater = std::max(m_stackHighWater, m_stackAllocator->Size());
+
+		if (valueUsed + s_BufferSlack > m_valueCapacity)
+		{
+			m_valueAllocator.reset();
+			m_valueCapacity = GetGrownCapacity(valueUsed);
+			m_valueBuffer.reset(new char[m_valueCapacity]);
+			m_valueAllocator.emplace(m_valueBuffer.get(), m_valueCapacity);
+			++m_growCount;
+		}
+		else
+		{
+			m_valueAllocator->Clear();
+		}
+
+		if (m_stackHighWater + s_BufferSlack > m_stackCapacity)
+		{
+			m_stackAllocator.reset();
+			m_stackCapacity = GetGrownCapacity(m_stackHighWater);
+			m_stackBuffer.reset(new char[m_stackCapacity]);
+			m_stackAllocator.emplace(m_stackBuffer.get(), m_stackCapacity);
+			++m_growCount;
+		}
+		else
+		{
+			m_stackAllocator->Clear();
+		}
+
+		// Starting the stack at its largest size means it is allocated once, not regrown by copying
+		m_document.emplace(&*m_valueAllocator, std::max<size_t>(m_stackHighWater, s_MinStackCapacity), &*m_stackAllocator);
+		return *m_document;
+	}
+
+	/*!***********************************************************************
+	\brief		Reset the arena and parse JSON into it
+	*************************************************************************/
+	JsonParseContext::Document& JsonParseContext::Parse(const char* json, size_t length)
+	{
+		Begin().Parse(json, length);
+		return *m_document;
+	}
+
+	/*!***********************************************************************
+	\brief		Reset the arena and parse JSON in place
+	*************************************************************************/
+	JsonParseContext::Document& JsonParseContext::ParseInsitu(char* json)
+	{
+		Begin().ParseInsitu(json);
+		return *m_document;
+	}
+}
@@ -0,0 +1,146 @@
+/******************************************************************************/
+/*!
+\file       JsonParseContext.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the JsonParseContext
+            class, a reusable arena for rapidjson Documents
+
+            A fresh Document allocates its value chunks and parse stack from
+            the heap and frees them again when it goes out of scope, so every
+            scene load, prefab load and captured component churns the heap.
+            A context keeps one buffer for values and one for the parse
+            stack. Begin resets both instead of freeing them, and grows them
+            to the largest load seen so far, so once a context has seen its
+            largest file, loading again allocates nothing.
+
+            Contexts are leased from a small shared pool, so nested loads
+            (a prefab baseline read while its scene is loading) each get
+            their own arena. A Document from a context is valid until the
+            lease is released or Begin is called again.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _JSONPARSECONTEXT_H_
+#define _JSONPARSECONTEXT_H_
+
+#include <memory>
+#include <optional>
+#include <rapidjson/document.h>
+
+namespace SOL
+{
+    class JsonParseContext
+    {
+    public:
+
+        using Allocator = rapidjson::MemoryPoolAllocator<>;
+        using Document = rapidjson::GenericDocument<rapidjson::UTF8<>, Allocator, Allocator>;
+
+        static const size_t s_InitialCapacity = 64 * 1024;  //bytes for values before the first load grows it
+        static const size_t s_MaxPooledContexts = 8;        //contexts kept once released, extra ones are freed
+
+        /*!***********************************************************************
+        \brief		Exclusive use of a pooled context, returned to the pool when
+                    destroyed.
+        *************************************************************************/
+        class Lease
+        {
+        public:
+            Lease() = default;
+            Lease(Lease&& other) noexcept : m_context(other.m_context) { other.m_context = nullptr; }
+            Lease& operator=(Lease&& other) noexcept;
+            ~Lease();
+
+            Lease(const Lease&) = delete;
+            Lease& operator=(const Lease&) = delete;
+
+            JsonParseContext* operator->() const { return m_context; }
+            JsonParseContext& operator*() const { return *m_context; }
+            explicit operator bool() const { return m_context != nullptr; }
+
+        private:
+            friend class JsonParseContext;
+            explicit Lease(JsonParseContext* context) : m_context(context) {}
+
+            JsonParseContext* m_context{};
+        };
+
+        /*!***********************************************************************
+        \brief		Take a context from the pool, or make one if none is free.
+                    Safe to call from any thread.
+        \return     The lease.
+        *************************************************************************/
+        static Lease Acquire();
+
+        /*!***********************************************************************
+        \brief		Free every pooled context that is not leased, for example
+                    after unloading a large level.
+        *************************************************************************/
+        static void ReleasePooled();
+
+        /*!***********************************************************************
+        \brief		Reset the arena and start an empty Document on it. The
+                    previous Document is no longer valid.
+        \return     The Document, null until set or parsed.
+        *************************************************************************/
+        Document& Begin();
+
+        /*!***********************************************************************
+        \brief		Reset the arena and parse JSON into it.
+        \param      json The text, length The size of the text.
+        \return     The Document, check HasParseError.
+        *************************************************************************/
+        Document& Parse(const char* json, size_t length);
+
+        /*!***********************************************************************
+        \brief		Reset the arena and parse JSON in place, strings point into
+                    the text, which must outlive the Document.
+        \param      json The null terminated text, modified by the parse.
+        \return     The Document, check HasParseError.
+        *************************************************************************/
+        Document& ParseInsitu(char* json);
+
+        /*!***********************************************************************
+        \brief		Get the Document of the last Begin or parse.
+        *************************************************************************/
+        Document& GetDocument() { return *m_document; }
+        const Document& GetDocument() const { return *m_document; }
+
+        /*!***********************************************************************
+        \brief		Get the bytes reserved for values and the parse stack.
+        *************************************************************************/
+        size_t GetCapacity() const { return m_valueCapacity + m_stackCapacity; }
+
+        /*!***********************************************************************
+        \brief		Get the number of times the buffers had to grow, it stops
+                    rising once loads are no larger than earlier ones.
+        *************************************************************************/
+        size_t GetGrowCount() const { return m_growCount; }
+
+    private:
+
+        JsonParseContext();
+
+        /*!***********************************************************************
+        \brief		Return a context to the pool.
+        *************************************************************************/
+        static void Release(JsonParseContext* context);
+
+        std::unique_ptr<char[]> m_valueBuffer;
+        std::unique_ptr<char[]> m_stackBuffer;
+        size_t m_valueCapacity{};
+        size_t m_stackCapacity{};
+        size_t m_stackHighWater{};                  //parse stack of the largest load, the next stack starts this big
+        size_t m_growCount{};
+        std::optional<Allocator> m_valueAllocator;
+        std::optional<Allocator> m_stackAllocator;
+        std::optional<Document> m_document;
+    };
+}
+#endif  //_JSONPARSECONTEXT_H_
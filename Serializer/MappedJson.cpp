@@ -0,0 +1,69 @@
+/******************************************************************************/
+/*!
+\file		MappedJson.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the MappedJson class, a JSON
+		file mapped into memory and parsed in place
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "MappedJson.h"
+#include "SOL/AssetManager/VirtualFileSystem.h"
+
+namespace SOL
+{
+	/*!***********************************************************************
+	\brief		Constructor for MappedJson class
+	*************************************************************************/
+	MappedJson::MappedJson()
+		: m_context(JsonParseContext::Acquire())
+	{
+		m_context->Begin();
+	}
+
+	/*!***********************************************************************
+	\brief		Map a JSON file and parse it in place, the parser writes string
+				terminators and unescaped text into the private pages
+	*************************************************************************/
+	bool MappedJson::Open(const std::string& filePath)
+	{
+		m_context->Begin();
+		if (!VirtualFileSystem::Get().mapFile(filePath, m_file))
+		{
+			std::cerr << "Could not open the file: " << filePath << std::endl;
+			return false;
+		}
+
+		m_context->ParseInsitu(m_file.data());
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Get a string value without copying it
+	*************************************************************************/
+	std::string_view MappedJson::GetStringView(const JsonValue& value)
+	{
+		if (!value.IsString())
+			return std::string_view();
+		return std::string_view(value.GetString(), value.GetStringLength());
+	}
+
+	/*!***********************************************************************
+	\brief		Get a string member without copying it
+	*************************************************************************/
+	std::string_view MappedJson::GetStringView(const JsonValue& object, const char* key)
+	{
+		if (!object.IsObject())
+			return std::string_view();
+		auto it = object.FindMember(key);
+		if (it == object.MemberEnd())
+			return std::string_view();
+		return GetStringView(it->value);
+	}
+}
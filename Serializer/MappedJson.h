@@ -0,0 +1,90 @@
+/******************************************************************************/
+/*!
+\file       MappedJson.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the MappedJson class, a
+            JSON file mapped into memory and parsed in place
+
+            The Document's strings point into the mapping instead of being
+            copied into its allocator, so a file is neither read into a string
+            nor duplicated by the parse. Strings handed out by GetStringView
+            (Name, TexKey, AudioKey, asset paths) stay valid for as long as
+            the MappedJson is alive.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _MAPPEDJSON_H_
+#define _MAPPEDJSON_H_
+
+#include <string>
+#include <string_view>
+#include <rapidjson/document.h>
+#include "SOL/AssetManager/MappedFile.h"
+#include "ComponentReflection.h"
+#include "JsonParseContext.h"
+
+namespace SOL
+{
+    class MappedJson
+    {
+    public:
+
+        /*!***********************************************************************
+        \brief		Constructor for MappedJson class, the Document is parsed into
+                    a pooled JsonParseContext held until this object is gone.
+        *************************************************************************/
+        MappedJson();
+
+        MappedJson(const MappedJson&) = delete;
+        MappedJson& operator=(const MappedJson&) = delete;
+
+        /*!***********************************************************************
+        \brief		Map a JSON file and parse it in place.
+        \param      filePath The file, resolved through the VirtualFileSystem
+                    mounts.
+        \return     False if the file could not be read, a file that is not
+                    valid JSON is reported by HasParseError.
+        *************************************************************************/
+        bool Open(const std::string& filePath);
+
+        /*!***********************************************************************
+        \brief		Check if the file was read but is not valid JSON.
+        *************************************************************************/
+        bool HasParseError() const { return m_context->GetDocument().HasParseError(); }
+
+        /*!***********************************************************************
+        \brief		Get the parsed document, valid while this object is alive.
+        *************************************************************************/
+        const JsonParseContext::Document& GetDocument() const { return m_context->GetDocument(); }
+
+        /*!***********************************************************************
+        \brief		Get the size of the file that was parsed.
+        *************************************************************************/
+        size_t GetFileSize() const { return m_file.size(); }
+
+        /*!***********************************************************************
+        \brief		Get a string value without copying it.
+        \param      value The value.
+        \return     The string, empty if the value is not a string.
+        *************************************************************************/
+        static std::string_view GetStringView(const JsonValue& value);
+
+        /*!***********************************************************************
+        \brief		Get a string member without copying it.
+        \param      object The object, key The member name.
+        \return     The string, empty if the member is missing or not a string.
+        *************************************************************************/
+        static std::string_view GetStringView(const JsonValue& object, const char* key);
+
+    private:
+        MappedFile m_file;                  //declared first, the document points into it
+        JsonParseContext::Lease m_context;
+    };
+}
+#endif  //_MAPPEDJSON_H_
@@ -0,0 +1,161 @@
+/******************************************************************************/
+/*!
+\file		ParallelSceneLoader.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the ParallelSceneLoader
+		class, which deserializes the entities of a scene across a WorkerPool
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "ParallelSceneLoader.h"
+#include "Prefab.h"
+#include "BinaryScene.h"
+#include "TileLayers.h"
+#include "SOL/AssetManager/WorkerPool.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+
+namespace SOL
+{
+	namespace
+	{
+		/*!***********************************************************************
+		\brief		Get the pool shared by loaders constructed without one
+		*************************************************************************/
+		WorkerPool& GetScenePool()
+		{
+			static WorkerPool s_Pool;
+			return s_Pool;
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Constructor for ParallelSceneLoader class, using the shared pool
+	*************************************************************************/
+	ParallelSceneLoader::ParallelSceneLoader(size_t batchSize)
+		: ParallelSceneLoader(GetScenePool(), batchSize)
+	{
+	}
+
+	/*!***********************************************************************
+	\brief		Constructor for ParallelSceneLoader class
+	*************************************************************************/
+	ParallelSceneLoader::ParallelSceneLoader(WorkerPool& pool, size_t batchSize)
+		: m_pool(pool), m_batchSize(batchSize != 0 ? batchSize : 1)
+	{
+	}
+
+	/*!***********************************************************************
+	\brief		Deserialize entities in parallel and hand them out in order
+	*************************************************************************/
+	size_t ParallelSceneLoader::Load(size_t entityCount, const DeserializeFunction& deserialize, const EntityCallback& onEntity)
+	{
+		if (entityCount == 0)
+			return 0;
+
+		// Prefabs hold references to their own members, so staging is sized once and never moved
+		std::unique_ptr<Prefab[]> staging(new Prefab[entityCount]);
+		std::unique_ptr<uint8_t[]> loaded(new uint8_t[entityCount]());
+
+		std::atomic<size_t> nextBatch{ 0 };
+		const size_t batchCount = (entityCount + m_batchSize - 1) / m_batchSize;
+		auto work = [&]()
+		{
+			for (size_t batch = nextBatch.fetch_add(1); batch < batchCount; batch = nextBatch.fetch_add(1))
+			{
+				const size_t end = std::min(entityCount, (batch + 1) * m_batchSize);
+				for (size_t i = batch * m_batchSize; i < end; ++i)
+				{
+					loaded[i] = deserialize(i, staging[i]) ? 1 : 0;
+				}
+			}
+		};
+
+		// The calling thread works too, so small scenes never wait on the pool
+		const size_t helperCount = std::min<size_t>(m_pool.threadCount(), batchCount - 1);
+		std::mutex mutex;
+		std::condition_variable finished;
+		size_t running = helperCount;
+		for (size_t h = 0; h < helperCount; ++h)
+		{
+			m_pool.submit([&]()
+				{
+					work();
+					std::lock_guard<std::mutex> lock(mutex);
+					if (--running == 0)
+						finished.notify_one();
+				});
+		}
+
+		work();
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			finished.wait(lock, [&]() { return running == 0; });
+		}
+
+		// Merge in file order so entity IDs match a serial load
+		size_t handedOut = 0;
+		for (size_t i = 0; i < entityCount; ++i)
+		{
+			if (!loaded[i])
+				continue;
+			if (onEntity)
+				onEntity(staging[i], i);
+			++handedOut;
+		}
+		return handedOut;
+	}
+
+	/*!***********************************************************************
+	\brief		Deserialize the Entities array of a parsed scene JSON
+	*************************************************************************/
+	size_t ParallelSceneLoader::LoadScene(Serializer& serializer, const JsonValue& scene, const EntityCallback& onEntity)
+	{
+		if (!scene.IsObject() || !scene.HasMember("Entities") || !scene["Entities"].IsArray())
+		{
+			ENGINE_ERROR("Error: Not a valid scene object.\n");
+			return 0;
+		}
+
+		// Tile layer blocks are expanded on the side, the scene is left as it is
+		rapidjson::Document tiles;
+		std::vector<const JsonValue*> entities;
+		if (!TileLayers::GatherEntities(scene, tiles, entities))
+		{
+			ENGINE_ERROR("Error: Scene tile layers are corrupt.\n");
+			return 0;
+		}
+
+		return Load(entities.size(),
+			[&](size_t index, Prefab& entity)
+			{
+				const JsonValue& element = *entities[index];
+				if (!element.IsObject())
+					return false;
+				entity.DeserializeSceneEntity(serializer, element);
+				return true;
+			},
+			onEntity);
+	}
+
+	/*!***********************************************************************
+	\brief		Deserialize the entities of a binary scene
+	*************************************************************************/
+	size_t ParallelSceneLoader::LoadScene(Serializer& serializer, const BinaryScene& scene, const EntityCallback& onEntity)
+	{
+		return Load(scene.GetEntityCount(),
+			[&](size_t index, Prefab& entity)
+			{
+				return scene.DeserializeEntity(serializer, index, entity);
+			},
+			onEntity);
+	}
+}
@@ -0,0 +1,93 @@
+/******************************************************************************/
+/*!
+\file       ParallelSceneLoader.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the ParallelSceneLoader
+            class, which deserializes the entities of a scene across a
+            WorkerPool
+
+            Entities only depend on each other through the IDs the ECS gives
+            them, so workers take batches of the Entities array and read each
+            entity into its own staging Prefab. Once every batch is done the
+            staged entities are handed to the callback on the calling thread
+            in file order, so IDs are assigned exactly as a serial load would.
+
+            Deserialize functions registered with the Serializer are called
+            from the worker threads and must not share unguarded state.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _PARALLELSCENELOADER_H_
+#define _PARALLELSCENELOADER_H_
+
+#include <functional>
+#include "ComponentReflection.h"
+
+namespace SOL
+{
+    class Serializer;
+    class Prefab;
+    class BinaryScene;
+    class WorkerPool;
+
+    class ParallelSceneLoader
+    {
+    public:
+
+        static const size_t s_DefaultBatchSize = 32;    //entities taken by a worker at a time
+
+        using DeserializeFunction = std::function<bool(size_t index, Prefab& entity)>;
+        using EntityCallback = std::function<void(Prefab& entity, size_t index)>;
+
+        /*!***********************************************************************
+        \brief		Constructor for ParallelSceneLoader class, using a pool shared
+                    by every loader that is started on first use.
+        \param      batchSize The number of entities a worker takes at a time.
+        *************************************************************************/
+        explicit ParallelSceneLoader(size_t batchSize = s_DefaultBatchSize);
+
+        /*!***********************************************************************
+        \brief		Constructor for ParallelSceneLoader class.
+        \param      pool The pool to run on, batchSize The number of entities a
+                    worker takes at a time.
+        *************************************************************************/
+        explicit ParallelSceneLoader(WorkerPool& pool, size_t batchSize = s_DefaultBatchSize);
+
+        /*!***********************************************************************
+        \brief		Deserialize entities in parallel and hand them out in order.
+        \param      entityCount The number of entities,
+                    deserialize Reads one entity, called from any thread,
+                    onEntity Called on this thread for every entity that was
+                    read, in index order.
+        \return     The number of entities handed out.
+        *************************************************************************/
+        size_t Load(size_t entityCount, const DeserializeFunction& deserialize, const EntityCallback& onEntity);
+
+        /*!***********************************************************************
+        \brief		Deserialize the Entities array of a parsed scene JSON.
+        \param      serializer The serializer, scene The scene object,
+                    onEntity Called for every entity in file order.
+        \return     The number of entities handed out.
+        *************************************************************************/
+        size_t LoadScene(Serializer& serializer, const JsonValue& scene, const EntityCallback& onEntity);
+
+        /*!***********************************************************************
+        \brief		Deserialize the entities of a binary scene.
+        \param      serializer The serializer, scene The opened binary scene,
+                    onEntity Called for every entity in file order.
+        \return     The number of entities handed out.
+        *************************************************************************/
+        size_t LoadScene(Serializer& serializer, const BinaryScene& scene, const EntityCallback& onEntity);
+
+    private:
+        WorkerPool& m_pool;
+        size_t m_batchSize;
+    };
+}
+#endif  //_PARALLELSCENELOADER_H_
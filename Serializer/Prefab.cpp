@@ -14,6 +14,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 /******************************************************************************/
 #include "SOLpch.h"
 #include "Prefab.h"
+#include "SceneStreamReader.h"
+#include "PrefabBaselines.h"
 
 namespace SOL
 {
@@ -36,22 +38,11 @@ namespace SOL
         }
         writer.EndObject();
 
-        // strbuf now contains the JSON string
-        const char* jsonString = strbuf.GetString();
-
-        std::cout << "Serialized JSON String: " << jsonString << std::endl;
-
-        // Save jsonString to a text file
-        std::ofstream outFile("./Json/EditedScene.json");
-        if (outFile.is_open()) 
-        {
-            outFile << jsonString;
-            outFile.close();
-        }
-        else 
+        // Saved through the scene writer, so tile runs are packed like every other scene save
+        if (!Serializer::writeSceneFile("./Json/EditedScene.json", std::string(strbuf.GetString(), strbuf.GetSize())))
         {
             std::cerr << "Could not open file for writing.\n";
-        } 
+        }
     }
 
 
@@ -61,37 +52,10 @@ namespace SOL
     *************************************************************************/
     void SOL::Prefab::DeserializePrefab(Serializer& serializer, const std::string& jsonString)
     {
-        rapidjson::Document doc;
-        doc.Parse(jsonString.c_str());
-
-        if (!doc.IsObject())
+        // Components are read straight off the SAX events, no Document is built
+        if (!SceneStreamReader::ReadPrefab(serializer, jsonString, *this))
         {
             ENGINE_ERROR("Error: Not a valid JSON object.\n");
-            return;
-        }
-
-        for (auto it = doc.MemberBegin(); it != doc.MemberEnd(); ++it)
-        {
-            const std::string typeName = it->name.GetString();// Check for "NAME"
-
-            // Fetch empty component of this type as in component type
-            Components* P_Component = CreateComponentByTypeName(typeName);
-            if(P_Component != nullptr)
-            {
-                //Components& newComponent = *P_Component;
-                //m_components.emplace(typeName, *P_Component);
-                AddComponent(typeName, *P_Component);
-
-                //serializer.deserializeFunctions.at(typeName)(it->value, *P_Component);
-                serializer.Deserialize(it->value, *P_Component, typeName);
-                //AddComponent(typeName, newComponent);
-            }
-            else
-            {
-                // Handle error, log it
-                ENGINE_ERROR("Unknown component type");
-                std::cerr << "Error: Unknown component type " << typeName << ".\n";
-            }
         }
     }
 
@@ -100,6 +64,12 @@ namespace SOL
     *************************************************************************/
     void Prefab::SerializeSceneEntity(Serializer& _Serializer, Writer& _Writer)
     {
+        // Entities made from a prefab only write what differs from it
+        if (PrefabBaselines::Get().WriteDelta(_Serializer, _Writer, *this))
+        {
+            return;
+        }
+
         for (const auto& pair : m_components)
         {
             _Writer.String(pair.first.c_str());  // Write the type name as the JSON key
@@ -123,27 +93,39 @@ namespace SOL
         const auto& array = doc.GetArray();
         for (const auto& element : array)
         {*/
+            // Start from the prefab the entity is a delta of, the members below override it
+            auto prefabMember = element.FindMember(PrefabBaselines::s_PrefabKey);
+            if (prefabMember != element.MemberEnd() && prefabMember->value.IsString())
+            {
+                if (!PrefabBaselines::Get().Apply(serializer, prefabMember->value.GetString(), *this))
+                {
+                    ENGINE_ERROR("Prefab baseline could not be loaded");
+                    std::cerr << "Error: Could not load prefab " << prefabMember->value.GetString() << ".\n";
+                }
+            }
+
             for (auto it = element.MemberBegin(); it != element.MemberEnd(); ++it)
             {
-                const std::string typeName = it->name.GetString();// Check for "NAME"
+                if (it == prefabMember)
+                {
+                    continue;
+                }
+
+                // Map the key to its component type once, the rest is indexed by ID
+                const ComponentTypeID id = ComponentReflection::FindComponentID(it->name.GetString(), it->name.GetStringLength());
 
                 // Fetch empty component of this type as in component type
-                Components* P_Component = CreateComponentByTypeName(typeName);
+                Components* P_Component = CreateComponentByID(id);
                 if (P_Component != nullptr)
                 {
-                    //Components& newComponent = *P_Component;
-                    //m_components.emplace(typeName, *P_Component);
-                    AddComponent(typeName, *P_Component);
-
-                    //serializer.deserializeFunctions.at(typeName)(it->value, *P_Component);
-                    serializer.Deserialize(it->value, *P_Component, typeName);
-                    //AddComponent(typeName, newComponent);
+                    AddComponent(ComponentReflection::GetComponentName(id), *P_Component);
+                    serializer.Deserialize(it->value, *P_Component, id);
                 }
                 else
                 {
                     // Handle error, log it
                     ENGINE_ERROR("Unknown component type");
-                    std::cerr << "Error: Unknown component type " << typeName << ".\n";
+                    std::cerr << "Error: Unknown component type " << it->name.GetString() << ".\n";
                 }
             }
         /*}*/
@@ -168,79 +150,33 @@ namespace SOL
     *************************************************************************/
     Components* Prefab::CreateComponentByTypeName(const std::string& typeName)
     {
-        //_____________EXTEND WHEN NEW COMPONENTS IMPLEMENTED_________
-        if (typeName == "TransformComponent")
-        {
-            return &m_TransformComponent;
-        }
-        else if (typeName == "MovementComponent")
-        {
-            return &m_MovementComponent;
-        }
-        else if (typeName == "PrimitiveComponent")
+        Components* component = CreateComponentByID(ComponentReflection::FindComponentID(typeName));
+        if (component == nullptr)
         {
-            return &m_PrimitiveComponent;
-        }
-        else if (typeName == "SpriteComponent")
-        {
-            return &m_SpriteComponent;
-        }
-        else if (typeName == "PlayerComponent")
-        {
-            return &m_PlayerComponent;
-        }
-        else if (typeName == "NameComponent")
-        {
-            return &m_NameComponent;
-        }
-        else if (typeName == "RigidBody2DComponent")
-        {
-            return &m_RigidBody2DComponent;
-        }
-        else if (typeName == "FontComponent")
-        {
-            return &m_FontComponent;
-        }
-        else if (typeName == "CameraComponent")
-        {
-            return &m_CameraComponent;
-        }
-        else if (typeName == "AnimationComponent")
-        {
-            return &m_AnimationComponent;
-        }
-        else if (typeName == "GemComponent")
-        {
-            return &m_GemComponent;
-        }
-        else if (typeName == "UIComponent")
-        {
-            return &m_UIComponent;
-        }
-        else if (typeName == "AudioComponent")
-        {
-            return &m_AudioComponent;
-        }
-        else if (typeName == "EnemyComponent")
-        {
-            return &m_EnemyComponent;
-        }
-        else if (typeName == "TileComponent")
-        {
-            return &m_TileComponent;
+            ENGINE_ERROR("Create component by type name failed");
         }
-        else if (typeName == "CPPScriptComponent")
+        return component;
+    }
+
+    /*!***********************************************************************
+    \brief		gets respective components from prefab by component type ID
+    *************************************************************************/
+    Components* Prefab::CreateComponentByID(ComponentTypeID id)
+    {
+        //Each component lives in the member named m_<type>, see SOL_COMPONENT_TYPES
+        using ComponentAccessor = Components& (*)(Prefab&);
+        static const ComponentAccessor s_Accessors[] =
         {
-            return &m_CPPScriptComponent;
-        }
+#define SOL_PREFAB_ACCESSOR(_component) [](Prefab& prefab) -> Components& { return prefab.m_##_component; },
+            SOL_COMPONENT_TYPES(SOL_PREFAB_ACCESSOR)
+#undef SOL_PREFAB_ACCESSOR
+        };
 
-        //switch()
-        //____________EXTEND WHEN NEW COMPONENTS IMPLEMENTED_________
-        else
+        if (id >= ComponentTypeID::COUNT)
         {
-            ENGINE_ERROR("Create component by type name failed");
             return nullptr;
         }
+        return &s_Accessors[static_cast<size_t>(id)](*this);
     }
 
     /*!***********************************************************************
@@ -260,12 +196,6 @@ namespace SOL
         SOL::Serializer serializer;
         SOL::Prefab prefabSerialize;
 
-        // Register the serialization function for TransformComponent
-        serializer.RegisterSerializeFunction("TransformComponent", Serializer::SerializeTransformComponent);
-        serializer.RegisterSerializeFunction("MovementComponent", Serializer::SerializeMovementComponent);
-        serializer.RegisterSerializeFunction("PrimitiveComponent", Serializer::SerializePrimitiveComponent);
-        serializer.RegisterSerializeFunction("SpriteComponent", Serializer::SerializeSpriteComponent);
-
         //Populate components to test
         auto& transform = static_cast<SOL::TransformComponent&>(prefabSerialize.GetComponent("TransformComponent"));
         transform.m_Transform = { 111.0f, 111.0f};
@@ -296,12 +226,6 @@ namespace SOL
         SOL::Serializer deserializer;
         SOL::Prefab prefabDeSerialize;
 
-        // Register the deserialization function for TransformComponent
-        deserializer.RegisterDeserializeFunction("TransformComponent", Serializer::DeserializeTransformComponent);
-        deserializer.RegisterDeserializeFunction("MovementComponent", Serializer::DeserializeMovementComponent);
-        deserializer.RegisterDeserializeFunction("PrimitiveComponent", Serializer::DeserializePrimitiveComponent);
-        deserializer.RegisterDeserializeFunction("SpriteComponent", Serializer::DeserializeSpriteComponent);
-
         // Read JSON from a file
         std::string jsonString = Serializer::readJsonFile("./Json/deSerializeFromThis_prefab.json");
 
@@ -35,6 +35,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "SOL/ECS/Components/EnemyComponent.h"
 #include "SOL/ECS/Components/TileComponent.h"
 
+#include "ComponentReflection.h"
 #include "Serializer.h"  // Include your Serializer
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/prettywriter.h>
@@ -108,6 +109,11 @@ namespace SOL
         *************************************************************************/
         Components* CreateComponentByTypeName(const std::string& typeName);
 
+        /*!***********************************************************************
+        \brief		gets respective components from prefab by component type ID
+        *************************************************************************/
+        Components* CreateComponentByID(ComponentTypeID id);
+
         /*!***********************************************************************
         \brief		add a selected component to the prefab map for it to be valid
         *************************************************************************/
@@ -133,8 +139,20 @@ namespace SOL
                 it.second.FreeComponent();
             }
             m_components.clear(); 
+            m_sourcePrefab.clear();
         }
 
+        /*!***********************************************************************
+        \brief		Record the prefab file this entity was created from, scenes
+                    store the entity as a delta against it
+        *************************************************************************/
+        void SetSourcePrefab(const std::string& prefabPath) { m_sourcePrefab = prefabPath; }
+
+        /*!***********************************************************************
+        \brief		Get the prefab file this entity was created from, empty if none
+        *************************************************************************/
+        const std::string& GetSourcePrefab() const { return m_sourcePrefab; }
+
         /*!***********************************************************************
         \brief		check if prefab contains a specific component
         *************************************************************************/
@@ -150,6 +168,7 @@ namespace SOL
          \brief		This is where you define the components variable.
          *************************************************************************/
         std::unordered_map<std::string, Components&> m_components;
+        std::string m_sourcePrefab;
 
         //____________EXTEND WHEN NEW COMPONENTS IMPLEMENTED(ADD MORE)________________________
         SOL::TransformComponent m_TransformComponent;
@@ -0,0 +1,169 @@
+/******************************************************************************/
+/*!
+\file		PrefabBaselines.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the PrefabBaselines class,
+		the cache of prefab files that scene entities are stored as deltas
+		against
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "PrefabBaselines.h"
+#include "Prefab.h"
+#include <algorithm>
+
+namespace SOL
+{
+	const char* const PrefabBaselines::s_PrefabKey = "Prefab";
+
+	/*!***********************************************************************
+	\brief		Get the cache shared by every scene load and save
+	*************************************************************************/
+	PrefabBaselines& PrefabBaselines::Get()
+	{
+		static PrefabBaselines s_Baselines;
+		return s_Baselines;
+	}
+
+	/*!***********************************************************************
+	\brief		Get a cached prefab, reading it on first use
+	*************************************************************************/
+	std::shared_ptr<const PrefabBaselines::Baseline> PrefabBaselines::Acquire(Serializer& serializer, const std::string& prefabPath)
+	{
+		{
+			std::shared_lock<std::shared_mutex> lock(m_mutex);
+			auto it = m_baselines.find(prefabPath);
+			if (it != m_baselines.end())
+				return it->second;
+		}
+
+		// Read outside the lock, two threads racing on the same prefab build the same baseline
+		const std::string json = Serializer::readJsonFile(prefabPath);
+		if (json.empty())
+			return nullptr;
+
+		auto baseline = std::make_shared<Baseline>();
+		baseline->m_Prefab = std::make_unique<Prefab>();
+		baseline->m_Prefab->DeserializePrefab(serializer, json);
+		if (!baseline->m_Prefab->IsPrefabValid())
+		{
+			ENGINE_ERROR("Prefab baseline has no components");
+			std::cerr << "Error: Prefab " << prefabPath << " has no components.\n";
+			return nullptr;
+		}
+
+		for (const auto& pair : baseline->m_Prefab->GetEntityComponentMap())
+		{
+			const ComponentTypeID id = ComponentReflection::FindComponentID(pair.first);
+			const ComponentDescriptor* descriptor = ComponentReflection::GetDescriptor(id);
+			if (descriptor == nullptr)
+				continue;
+
+			BinaryWriter writer;
+			descriptor->WriteBinary(writer, pair.second);
+			baseline->m_Records.push_back(Record{ id, std::move(writer.GetBytes()) });
+		}
+
+		// Keep the component order stable so every entity is built the same way
+		std::sort(baseline->m_Records.begin(), baseline->m_Records.end(),
+			[](const Record& a, const Record& b) { return a.m_ID < b.m_ID; });
+
+		std::unique_lock<std::shared_mutex> lock(m_mutex);
+		return m_baselines.emplace(prefabPath, std::move(baseline)).first->second;
+	}
+
+	/*!***********************************************************************
+	\brief		Give an entity the components of a prefab and record the prefab
+				as its source
+	*************************************************************************/
+	bool PrefabBaselines::Apply(Serializer& serializer, const std::string& prefabPath, Prefab& entity)
+	{
+		std::shared_ptr<const Baseline> baseline = Acquire(serializer, prefabPath);
+		if (!baseline)
+			return false;
+
+		for (const Record& record : baseline->m_Records)
+		{
+			Components* component = entity.CreateComponentByID(record.m_ID);
+			const ComponentDescriptor* descriptor = ComponentReflection::GetDescriptor(record.m_ID);
+			if (component == nullptr || descriptor == nullptr)
+				continue;
+
+			entity.AddComponent(descriptor->GetName(), *component);
+			BinaryReader reader(record.m_Bytes.data(), record.m_Bytes.size());
+			descriptor->ReadBinary(reader, *component);
+		}
+		entity.SetSourcePrefab(prefabPath);
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Write the components of an entity that differ from its source
+				prefab, preceded by the prefab key
+	*************************************************************************/
+	bool PrefabBaselines::WriteDelta(Serializer& serializer, JsonWriter& writer, Prefab& entity)
+	{
+		if (entity.GetSourcePrefab().empty())
+			return false;
+
+		std::shared_ptr<const Baseline> baseline = Acquire(serializer, entity.GetSourcePrefab());
+		if (!baseline)
+			return false;
+
+		// A component removed from the entity cannot be expressed as a delta
+		for (const Record& record : baseline->m_Records)
+		{
+			if (!entity.HasComponent(ComponentReflection::GetComponentName(record.m_ID)))
+				return false;
+		}
+
+		writer.Key(s_PrefabKey);
+		writer.String(entity.GetSourcePrefab().c_str(), static_cast<rapidjson::SizeType>(entity.GetSourcePrefab().size()));
+
+		std::vector<uint8_t> changed;
+		for (const auto& pair : entity.GetEntityComponentMap())
+		{
+			const ComponentTypeID id = ComponentReflection::FindComponentID(pair.first);
+			const ComponentDescriptor* descriptor = ComponentReflection::GetDescriptor(id);
+			const bool overridden = serializer.serializeFunctions.count(pair.first) != 0;
+
+			if (descriptor == nullptr || overridden || !baseline->m_Prefab->HasComponent(pair.first))
+			{
+				writer.String(pair.first.c_str());
+				serializer.Serialize(writer, pair.first, pair.second);
+				continue;
+			}
+
+			if (descriptor->DiffFields(pair.second, baseline->m_Prefab->GetComponent(pair.first), changed) == 0)
+				continue;
+
+			writer.String(pair.first.c_str());
+			descriptor->WriteJson(writer, pair.second, &changed);
+		}
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Drop a cached prefab so its file is read again
+	*************************************************************************/
+	void PrefabBaselines::Invalidate(const std::string& prefabPath)
+	{
+		std::unique_lock<std::shared_mutex> lock(m_mutex);
+		m_baselines.erase(prefabPath);
+	}
+
+	/*!***********************************************************************
+	\brief		Drop every cached prefab
+	*************************************************************************/
+	void PrefabBaselines::Clear()
+	{
+		std::unique_lock<std::shared_mutex> lock(m_mutex);
+		m_baselines.clear();
+	}
+}
@@ -0,0 +1,110 @@
+/******************************************************************************/
+/*!
+\file       PrefabBaselines.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the PrefabBaselines
+            class, the cache of prefab files that scene entities are stored
+            as deltas against
+
+            An entity created from a prefab is written as
+
+                { "Prefab": "./Json/Prefab/STONE.json",
+                  "TransformComponent": { "Transform": [ 0.0, 100.0, 0.0 ] } }
+
+            with only the fields that differ from the prefab. Loading starts
+            from the cached prefab and applies the fields on top, so an edit
+            to the prefab file reaches every entity that did not override it.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _PREFABBASELINES_H_
+#define _PREFABBASELINES_H_
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <mutex>
+#include <shared_mutex>
+#include "ComponentReflection.h"
+
+namespace SOL
+{
+    class Serializer;
+    class Prefab;
+
+    class PrefabBaselines
+    {
+    public:
+
+        static const char* const s_PrefabKey;   //entity member naming the prefab the entity is a delta of
+
+        /*!***********************************************************************
+        \brief		Get the cache shared by every scene load and save.
+        *************************************************************************/
+        static PrefabBaselines& Get();
+
+        /*!***********************************************************************
+        \brief		Give an entity the components of a prefab and record the
+                    prefab as its source. Safe to call from several threads.
+        \param      serializer The serializer used if the prefab is not cached,
+                    prefabPath The prefab file, entity Receives the components.
+        \return     False if the prefab could not be loaded.
+        *************************************************************************/
+        bool Apply(Serializer& serializer, const std::string& prefabPath, Prefab& entity);
+
+        /*!***********************************************************************
+        \brief		Write the components of an entity that differ from its
+                    source prefab, preceded by the prefab key. Entities without
+                    a source prefab, or missing a component the prefab has, are
+                    written in full.
+        \param      serializer The serializer, writer The writer, positioned
+                    inside the entity object, entity The entity to write.
+        \return     True if the entity was written as a delta.
+        *************************************************************************/
+        bool WriteDelta(Serializer& serializer, JsonWriter& writer, Prefab& entity);
+
+        /*!***********************************************************************
+        \brief		Drop a cached prefab so its file is read again, call when
+                    the prefab is edited.
+        \param      prefabPath The prefab file.
+        *************************************************************************/
+        void Invalidate(const std::string& prefabPath);
+
+        /*!***********************************************************************
+        \brief		Drop every cached prefab.
+        *************************************************************************/
+        void Clear();
+
+    private:
+
+        struct Record
+        {
+            ComponentTypeID m_ID;
+            std::vector<uint8_t> m_Bytes;   //written by the component's descriptor
+        };
+
+        struct Baseline
+        {
+            std::unique_ptr<Prefab> m_Prefab;   //compared against when writing deltas
+            std::vector<Record> m_Records;      //copied into entities when loading
+        };
+
+        /*!***********************************************************************
+        \brief		Get a cached prefab, reading it on first use.
+        \param      serializer The serializer, prefabPath The prefab file.
+        \return     The prefab, nullptr if it could not be read.
+        *************************************************************************/
+        std::shared_ptr<const Baseline> Acquire(Serializer& serializer, const std::string& prefabPath);
+
+        std::shared_mutex m_mutex;
+        std::unordered_map<std::string, std::shared_ptr<const Baseline>> m_baselines;
+    };
+}
+#endif  //_PREFABBASELINES_H_
@@ -0,0 +1,490 @@
+/******************************************************************************/
+/*!
+\file		Replay.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the ReplayRecorder and
+		ReplayPlayer classes, which record a run as delta encoded component
+		changes and play it back through the component field tables
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "Replay.h"
+#include "CookedSceneCache.h"
+#include "SOL/AssetManager/WorkerPool.h"
+#include "SOL/AssetManager/VirtualFileSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+namespace SOL
+{
+	namespace
+	{
+		const char s_ReplayMagic[4] = { 'S', 'R', 'E', 'P' };
+		const size_t s_MaxChannels = 64;		//one bit each in the changed mask
+		const size_t s_RingBlocks = 4;			//written blocks kept for reuse
+
+		#pragma pack(push, 1)
+		struct ReplayHeader
+		{
+			char m_Magic[4];
+			uint32_t m_Version;
+			uint32_t m_KeyframeInterval;
+			float m_Step;			//quantization step of float fields
+			uint64_t m_SchemaHash;	//CookedSceneCache::GetSchemaHash of the recording build
+		};
+		#pragma pack(pop)
+
+		/*!***********************************************************************
+		\brief		One recorded element of a numeric field
+		*************************************************************************/
+		struct Channel
+		{
+			const FieldInfo* m_Field;
+			uint32_t m_Element;
+		};
+
+		/*!***********************************************************************
+		\brief		Get the recorded elements of a component type, built once
+					from the field tables
+		*************************************************************************/
+		const std::vector<Channel>& GetChannels(ComponentTypeID id)
+		{
+			static const std::vector<std::vector<Channel>> s_Channels = []()
+			{
+				std::vector<std::vector<Channel>> channels(s_ComponentTypeCount);
+				for (const ComponentDescriptor& descriptor : ComponentReflection::GetDescriptors())
+				{
+					std::vector<Channel>& list = channels[static_cast<size_t>(descriptor.GetID())];
+					for (const FieldInfo& field : descriptor.GetFields())
+					{
+						if (field.m_Type == FieldType::STRING || field.m_Type == FieldType::CUSTOM)
+							continue;
+						for (uint32_t i = 0; i < field.m_Count && list.size() < s_MaxChannels; ++i)
+						{
+							list.push_back({ &field, i });
+						}
+					}
+				}
+				return channels;
+			}();
+			return s_Channels[static_cast<size_t>(id)];
+		}
+
+		/*!***********************************************************************
+		\brief		Get the key of an entity's component in the state maps
+		*************************************************************************/
+		uint64_t GetStateKey(uint32_t entity, ComponentTypeID id)
+		{
+			return (static_cast<uint64_t>(entity) << 32) | static_cast<uint32_t>(id);
+		}
+
+		/*!***********************************************************************
+		\brief		Convert a field value to the integer that is recorded
+		*************************************************************************/
+		int64_t Quantize(FieldType type, const FieldValue& value, float step)
+		{
+			if (type == FieldType::FLOAT)
+				return static_cast<int64_t>(std::llround(value.AsFloat() / step));
+			if (type == FieldType::INT)
+				return value.AsInt();
+			return static_cast<int64_t>(value.AsUint());
+		}
+
+		/*!***********************************************************************
+		\brief		Convert a recorded integer back to a field value
+		*************************************************************************/
+		void Dequantize(FieldType type, int64_t quantized, float step, FieldValue& value)
+		{
+			if (type == FieldType::FLOAT)
+			{
+				value.m_Kind = FieldValue::Kind::FLOAT;
+				value.m_Float = static_cast<double>(quantized) * step;
+			}
+			else if (type == FieldType::INT)
+			{
+				value.m_Kind = FieldValue::Kind::INT;
+				value.m_Int = quantized;
+			}
+			else
+			{
+				value.m_Kind = FieldValue::Kind::UINT;
+				value.m_Uint = static_cast<uint64_t>(quantized);
+			}
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		The open file and the blocks waiting for the writer job
+	*************************************************************************/
+	struct ReplayRecorder::Output
+	{
+		std::FILE* m_File{};
+		std::mutex m_Mutex;
+		std::condition_variable m_Idle;
+		std::deque<std::vector<uint8_t>> m_Full;	//blocks in recording order
+		std::vector<std::vector<uint8_t>> m_Free;	//written blocks kept for reuse
+		bool m_Writing{};							//a writer job is draining m_Full
+		bool m_Failed{};
+	};
+
+	/*!***********************************************************************
+	\brief		Constructor for ReplayRecorder class
+	*************************************************************************/
+	ReplayRecorder::ReplayRecorder(WorkerPool& pool)
+		: m_pool(pool),
+		m_tracked{ ComponentTypeID::TransformComponent, ComponentTypeID::RigidBody2DComponent,
+			ComponentTypeID::AnimationComponent, ComponentTypeID::PlayerComponent }
+	{
+	}
+
+	/*!***********************************************************************
+	\brief		Destructor for ReplayRecorder class
+	*************************************************************************/
+	ReplayRecorder::~ReplayRecorder()
+	{
+		End();
+	}
+
+	/*!***********************************************************************
+	\brief		Start recording, ending the previous recording
+	*************************************************************************/
+	bool ReplayRecorder::Begin(const std::string& filePath, float step)
+	{
+		End();
+
+		const std::string path = VirtualFileSystem::Get().getWritePath(filePath);
+		std::FILE* file = std::fopen(path.c_str(), "wb");
+		if (file == nullptr)
+		{
+			ENGINE_ERROR("Could not create replay file " + path);
+			return false;
+		}
+
+		ReplayHeader header{};
+		std::memcpy(header.m_Magic, s_ReplayMagic, sizeof(s_ReplayMagic));
+		header.m_Version = s_ReplayVersion;
+		header.m_KeyframeInterval = s_KeyframeInterval;
+		header.m_Step = step > 0.0f ? step : s_DefaultStep;
+		header.m_SchemaHash = CookedSceneCache::GetSchemaHash();
+		if (std::fwrite(&header, 1, sizeof(header), file) != sizeof(header))
+		{
+			ENGINE_ERROR("Could not write replay file " + path);
+			std::fclose(file);
+			return false;
+		}
+
+		m_output = std::make_shared<Output>();
+		m_output->m_File = file;
+		m_step = header.m_Step;
+		m_state.clear();
+		m_block.GetBytes().clear();
+		m_block.GetBytes().reserve(s_BlockSize);
+		m_frameCount = 0;
+		m_byteCount = sizeof(header);
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Record the tracked components of a set of entities
+	*************************************************************************/
+	void ReplayRecorder::RecordFrame(float deltaTime, const std::vector<EntityID>& entities, const ComponentResolver& resolve)
+	{
+		if (m_output == nullptr)
+			return;
+
+		// A keyframe is encoded against zero, so it does not depend on earlier frames
+		const bool keyframe = m_frameCount % s_KeyframeInterval == 0;
+		if (keyframe)
+		{
+			for (auto& it : m_state)
+			{
+				std::fill(it.second.begin(), it.second.end(), 0);
+			}
+		}
+
+		m_order.assign(entities.begin(), entities.end());
+		std::sort(m_order.begin(), m_order.end());
+		m_order.erase(std::unique(m_order.begin(), m_order.end()), m_order.end());
+
+		m_changes.GetBytes().clear();
+		uint64_t changed{};
+		EntityID previous{};
+		FieldValue value;
+		int64_t deltas[s_MaxChannels];
+
+		for (EntityID entity : m_order)
+		{
+			for (ComponentTypeID id : m_tracked)
+			{
+				const Components* component = resolve(entity, id);
+				if (component == nullptr)
+					continue;
+
+				const std::vector<Channel>& channels = GetChannels(id);
+				std::vector<int64_t>& state = m_state[GetStateKey(entity, id)];
+				if (state.size() != channels.size())
+					state.assign(channels.size(), 0);
+
+				uint64_t mask{};
+				size_t deltaCount{};
+				for (size_t i = 0; i < channels.size(); ++i)
+				{
+					channels[i].m_Field->m_Get(*component, channels[i].m_Element, value);
+					const int64_t quantized = Quantize(channels[i].m_Field->m_Type, value, m_step);
+					if (quantized != state[i])
+					{
+						mask |= uint64_t(1) << i;
+						deltas[deltaCount++] = quantized - state[i];
+						state[i] = quantized;
+					}
+				}
+				if (mask == 0 && !keyframe)
+					continue;
+
+				m_changes.WriteSignedVarint(static_cast<int64_t>(entity) - static_cast<int64_t>(previous));
+				m_changes.Write(static_cast<uint8_t>(id));
+				m_changes.WriteVarint(mask);
+				for (size_t i = 0; i < deltaCount; ++i)
+				{
+					m_changes.WriteSignedVarint(deltas[i]);
+				}
+				previous = entity;
+				++changed;
+			}
+		}
+
+		m_frame.GetBytes().clear();
+		m_frame.Write(static_cast<uint8_t>(keyframe ? 1 : 0));
+		m_frame.WriteVarint(static_cast<uint64_t>(std::llround(std::max(deltaTime, 0.0f) * 1000000.0)));
+		m_frame.WriteVarint(changed);
+		m_frame.WriteBytes(m_changes.GetBytes().data(), m_changes.GetBytes().size());
+
+		const size_t start = m_block.GetBytes().size();
+		m_block.WriteVarint(m_frame.GetBytes().size());
+		m_block.WriteBytes(m_frame.GetBytes().data(), m_frame.GetBytes().size());
+		m_byteCount += m_block.GetBytes().size() - start;
+		++m_frameCount;
+
+		if (m_block.GetBytes().size() >= s_BlockSize)
+			Flush();
+	}
+
+	/*!***********************************************************************
+	\brief		Hand the current block to the writer job. Blocks are written in
+				order by a single job at a time, the block taken in exchange
+				keeps the memory of one that was already written
+	*************************************************************************/
+	void ReplayRecorder::Flush()
+	{
+		std::vector<uint8_t> block;
+		bool start{};
+		{
+			std::lock_guard<std::mutex> lock(m_output->m_Mutex);
+			m_output->m_Full.push_back(std::move(m_block.GetBytes()));
+			if (!m_output->m_Free.empty())
+			{
+				block = std::move(m_output->m_Free.back());
+				m_output->m_Free.pop_back();
+			}
+			start = !m_output->m_Writing;
+			m_output->m_Writing = true;
+		}
+		block.clear();
+		m_block.GetBytes() = std::move(block);
+		m_block.GetBytes().reserve(s_BlockSize);
+
+		if (!start)
+			return;
+
+		m_pool.submit([output = m_output]()
+		{
+			std::unique_lock<std::mutex> lock(output->m_Mutex);
+			while (!output->m_Full.empty())
+			{
+				std::vector<uint8_t> written = std::move(output->m_Full.front());
+				output->m_Full.pop_front();
+				lock.unlock();
+
+				const bool failed = std::fwrite(written.data(), 1, written.size(), output->m_File) != written.size();
+				written.clear();
+
+				lock.lock();
+				output->m_Failed = output->m_Failed || failed;
+				if (output->m_Free.size() < s_RingBlocks)
+					output->m_Free.push_back(std::move(written));
+			}
+			output->m_Writing = false;
+			output->m_Idle.notify_all();
+		});
+	}
+
+	/*!***********************************************************************
+	\brief		Write every buffered frame and close the file
+	*************************************************************************/
+	bool ReplayRecorder::End()
+	{
+		if (m_output == nullptr)
+			return true;
+
+		if (!m_block.GetBytes().empty())
+			Flush();
+
+		bool written{};
+		{
+			std::unique_lock<std::mutex> lock(m_output->m_Mutex);
+			m_output->m_Idle.wait(lock, [this]() { return !m_output->m_Writing; });
+			written = !m_output->m_Failed && std::fflush(m_output->m_File) == 0;
+		}
+		written = std::fclose(m_output->m_File) == 0 && written;
+		m_output.reset();
+
+		if (!written)
+			ENGINE_ERROR("Replay file could not be written completely.");
+		return written;
+	}
+
+	/*!***********************************************************************
+	\brief		Open a replay file
+	*************************************************************************/
+	bool ReplayPlayer::Open(const std::string& filePath)
+	{
+		m_file = MappedFile();
+		m_state.clear();
+		m_offset = 0;
+		m_frameIndex = 0;
+
+		if (!VirtualFileSystem::Get().mapFile(filePath, m_file))
+		{
+			ENGINE_ERROR("Could not open replay file " + filePath);
+			return false;
+		}
+
+		ReplayHeader header{};
+		BinaryReader reader(m_file.data(), m_file.size());
+		if (!reader.Read(header) || std::memcmp(header.m_Magic, s_ReplayMagic, sizeof(s_ReplayMagic)) != 0 ||
+			header.m_Version != ReplayRecorder::s_ReplayVersion || !(header.m_Step > 0.0f))
+		{
+			ENGINE_ERROR("Replay file " + filePath + " is not a replay.");
+			m_file = MappedFile();
+			return false;
+		}
+		if (header.m_SchemaHash != CookedSceneCache::GetSchemaHash())
+		{
+			// The fields would be applied to the wrong members
+			ENGINE_ERROR("Replay file " + filePath + " was recorded with different component tables.");
+			m_file = MappedFile();
+			return false;
+		}
+
+		m_step = header.m_Step;
+		m_offset = sizeof(header);
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Apply the next frame to the live components
+	*************************************************************************/
+	bool ReplayPlayer::Step(const ComponentResolver& resolve, float* deltaTime)
+	{
+		if (IsFinished())
+			return false;
+
+		BinaryReader reader(m_file.data() + m_offset, m_file.size() - m_offset);
+		uint64_t frameSize{};
+		if (!reader.ReadVarint(frameSize) || frameSize > reader.GetRemaining())
+		{
+			ENGINE_WARN("Replay ends with a truncated frame.");
+			m_offset = m_file.size();
+			return false;
+		}
+		BinaryReader frame(reader.GetCurrent(), static_cast<size_t>(frameSize));
+		m_offset += reader.GetOffset() + static_cast<size_t>(frameSize);
+
+		uint8_t flags{};
+		uint64_t microseconds{};
+		uint64_t changed{};
+		if (!frame.Read(flags) || !frame.ReadVarint(microseconds) || !frame.ReadVarint(changed))
+			return false;
+
+		if (flags & 1)
+		{
+			for (auto& it : m_state)
+			{
+				std::fill(it.second.begin(), it.second.end(), 0);
+			}
+		}
+		if (deltaTime != nullptr)
+			*deltaTime = static_cast<float>(microseconds / 1000000.0);
+
+		int64_t entity{};
+		FieldValue value;
+		for (uint64_t n = 0; n < changed; ++n)
+		{
+			int64_t entityDelta{};
+			uint8_t type{};
+			uint64_t mask{};
+			if (!frame.ReadSignedVarint(entityDelta) || !frame.Read(type) || !frame.ReadVarint(mask) ||
+				type >= s_ComponentTypeCount)
+			{
+				ENGINE_ERROR("Replay frame is corrupt.");
+				return false;
+			}
+			entity += entityDelta;
+
+			const ComponentTypeID id = static_cast<ComponentTypeID>(type);
+			const std::vector<Channel>& channels = GetChannels(id);
+			if (channels.size() < s_MaxChannels && (mask >> channels.size()) != 0)
+			{
+				ENGINE_ERROR("Replay frame is corrupt.");
+				return false;
+			}
+
+			std::vector<int64_t>& state = m_state[GetStateKey(static_cast<EntityID>(entity), id)];
+			if (state.size() != channels.size())
+				state.assign(channels.size(), 0);
+			for (size_t i = 0; i < channels.size(); ++i)
+			{
+				int64_t delta{};
+				if ((mask >> i & 1) == 0)
+					continue;
+				if (!frame.ReadSignedVarint(delta))
+					return false;
+				state[i] += delta;
+			}
+
+			// Entities that no longer exist keep their state, so they can be followed again
+			Components* component = resolve(static_cast<EntityID>(entity), id);
+			if (component == nullptr)
+				continue;
+			for (size_t i = 0; i < channels.size(); ++i)
+			{
+				Dequantize(channels[i].m_Field->m_Type, state[i], m_step, value);
+				channels[i].m_Field->m_Set(*component, channels[i].m_Element, value);
+			}
+			ComponentReflection::GetDescriptor(id)->FinishLoad(*component);
+		}
+
+		++m_frameIndex;
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Go back to the first frame
+	*************************************************************************/
+	void ReplayPlayer::Rewind()
+	{
+		m_state.clear();
+		m_frameIndex = 0;
+		m_offset = m_file.size() != 0 ? sizeof(ReplayHeader) : 0;
+	}
+}
@@ -0,0 +1,193 @@
+/******************************************************************************/
+/*!
+\file       Replay.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the ReplayRecorder and
+            ReplayPlayer classes, which record a run as a stream of component
+            changes and play it back through the component field tables
+
+            Every frame the recorder reads the numeric fields of the tracked
+            components (Transform, RigidBody2D, Animation and Player by
+            default) through their field tables, quantizes floats to a fixed
+            step and writes only the fields that changed since the previous
+            frame, as zigzag varint deltas. A still entity costs nothing, a
+            moving one a few bytes. Every s_KeyframeInterval frames a keyframe
+            writes every tracked component in full, so a damaged stream only
+            loses the frames up to the next keyframe.
+
+            Frames are appended to a block in memory. Full blocks are written
+            to the file by a WorkerPool job, in order, and their memory is
+            reused for later blocks, so recording never waits on the disk.
+
+            The player decodes the same stream and sets the fields through
+            the same field tables, running the post load fix ups, so a replay
+            goes through the serializer exactly like a scene load does. Both
+            sides reach the ECS through a WorldSnapshot::ComponentResolver.
+
+            File layout: ReplayHeader, then per frame a varint byte count, a
+            flags byte, the frame time in microseconds, the number of changed
+            components and for each one the entity (delta from the previous
+            one in the frame), the ComponentTypeID, a bit mask of changed
+            fields and a signed varint delta per set bit.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _REPLAY_H_
+#define _REPLAY_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include "ComponentReflection.h"
+#include "WorldSnapshot.h"
+#include "SOL/AssetManager/MappedFile.h"
+
+namespace SOL
+{
+    class WorkerPool;
+
+    class ReplayRecorder
+    {
+    public:
+
+        using EntityID = WorldSnapshot::EntityID;
+        using ComponentResolver = WorldSnapshot::ComponentResolver;
+
+        static const uint32_t s_ReplayVersion = 1;
+        static const uint32_t s_KeyframeInterval = 300;     //frames between full frames
+        static const size_t s_BlockSize = 16 * 1024;        //bytes buffered before a block is written
+        static constexpr float s_DefaultStep = 1.0f / 256.0f;
+
+        /*!***********************************************************************
+        \brief		Constructor for ReplayRecorder class.
+        \param      pool The pool the blocks are written on.
+        *************************************************************************/
+        explicit ReplayRecorder(WorkerPool& pool);
+
+        /*!***********************************************************************
+        \brief		Destructor for ReplayRecorder class, ends the recording.
+        *************************************************************************/
+        ~ReplayRecorder();
+
+        ReplayRecorder(const ReplayRecorder&) = delete;
+        ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+
+        /*!***********************************************************************
+        \brief		Choose the components that are recorded, before Begin.
+        \param      types The component types, fields that are not numeric are
+                    not recorded.
+        *************************************************************************/
+        void SetTrackedComponents(const std::vector<ComponentTypeID>& types) { m_tracked = types; }
+
+        /*!***********************************************************************
+        \brief		Start recording, ending the previous recording.
+        \param      filePath The replay file, resolved through
+                    VirtualFileSystem::getWritePath, step The quantization step
+                    of float fields.
+        \return     False if the file could not be created.
+        *************************************************************************/
+        bool Begin(const std::string& filePath, float step = s_DefaultStep);
+
+        /*!***********************************************************************
+        \brief		Record the tracked components of a set of entities.
+        \param      deltaTime The frame time in seconds, entities The entities,
+                    resolve Gets their live components.
+        *************************************************************************/
+        void RecordFrame(float deltaTime, const std::vector<EntityID>& entities, const ComponentResolver& resolve);
+
+        /*!***********************************************************************
+        \brief		Write every buffered frame and close the file, blocking
+                    until the writes are done.
+        \return     False if a write failed.
+        *************************************************************************/
+        bool End();
+
+        /*!***********************************************************************
+        \brief		Check if a recording is in progress.
+        *************************************************************************/
+        bool IsRecording() const { return m_output != nullptr; }
+
+        /*!***********************************************************************
+        \brief		Get the number of frames and encoded bytes recorded so far.
+        *************************************************************************/
+        size_t GetFrameCount() const { return m_frameCount; }
+        size_t GetByteCount() const { return m_byteCount; }
+
+    private:
+
+        struct Output;
+
+        /*!***********************************************************************
+        \brief		Hand the current block to the writer job.
+        *************************************************************************/
+        void Flush();
+
+        WorkerPool& m_pool;
+        std::shared_ptr<Output> m_output;   //shared with the writer job
+        std::vector<ComponentTypeID> m_tracked;
+        float m_step{ s_DefaultStep };
+        BinaryWriter m_block;
+        BinaryWriter m_frame;
+        BinaryWriter m_changes;
+        std::vector<EntityID> m_order;
+        std::unordered_map<uint64_t, std::vector<int64_t>> m_state;    //quantized fields of the previous frame by entity and type
+        size_t m_frameCount{};
+        size_t m_byteCount{};
+    };
+
+    class ReplayPlayer
+    {
+    public:
+
+        using EntityID = WorldSnapshot::EntityID;
+        using ComponentResolver = WorldSnapshot::ComponentResolver;
+
+        /*!***********************************************************************
+        \brief		Open a replay file.
+        \param      filePath The replay file, resolved through the
+                    VirtualFileSystem mounts.
+        \return     False if the file could not be read, is not a replay or was
+                    recorded with different component tables.
+        *************************************************************************/
+        bool Open(const std::string& filePath);
+
+        /*!***********************************************************************
+        \brief		Apply the next frame to the live components.
+        \param      resolve Gets the live components, deltaTime If given,
+                    receives the recorded frame time in seconds.
+        \return     False at the end of the replay or if the frame is corrupt.
+        *************************************************************************/
+        bool Step(const ComponentResolver& resolve, float* deltaTime = nullptr);
+
+        /*!***********************************************************************
+        \brief		Go back to the first frame.
+        *************************************************************************/
+        void Rewind();
+
+        /*!***********************************************************************
+        \brief		Check if every frame has been played.
+        *************************************************************************/
+        bool IsFinished() const { return m_offset >= m_file.size(); }
+
+        /*!***********************************************************************
+        \brief		Get the number of frames played since Open or Rewind.
+        *************************************************************************/
+        size_t GetFrameIndex() const { return m_frameIndex; }
+
+    private:
+        MappedFile m_file;
+        size_t m_offset{};
+        size_t m_frameIndex{};
+        float m_step{ ReplayRecorder::s_DefaultStep };
+        std::unordered_map<uint64_t, std::vector<int64_t>> m_state;    //quantized fields by entity and type
+    };
+}
+#endif  //_REPLAY_H_
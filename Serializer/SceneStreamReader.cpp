@@ -0,0 +1,756 @@
+/******************************************************************************/
+/*!
+\file		SceneStreamReader.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the SceneStreamReader class
+		and the SAX handler that reads scene and prefab JSON field by field
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "SceneStreamReader.h"
+#include "Prefab.h"
+#include "PrefabBaselines.h"
+#include "TileLayers.h"
+#include "JsonParseContext.h"
+#include "SOL/AssetManager/VirtualFileSystem.h"
+#include <memory>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <rapidjson/reader.h>
+#include <rapidjson/writer.h>
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/error/en.h>
+
+namespace SOL
+{
+	namespace
+	{
+		const size_t s_ReadBlockSize = 64 * 1024;
+
+		/*!***********************************************************************
+		\brief		Where the handler is in the document
+		*************************************************************************/
+		enum class StreamState : uint8_t
+		{
+			ROOT,               //before the top level object
+			SCENE,              //in the scene object, expecting a key
+			ENTITIES_VALUE,     //after the "Entities" key
+			ENTITIES,           //in the entity array
+			ENTITY,             //in an entity, expecting a component key
+			PREFAB_VALUE,       //after the key naming the prefab an entity is a delta of
+			COMPONENT_VALUE,    //after a component key
+			COMPONENT,          //in a component, expecting a field key
+			FIELD_VALUE,        //after the key of a scalar field
+			VERSION_VALUE,      //after the version key of a component
+			ARRAY_VALUE,        //after the key of an array field
+			FIELD_ARRAY,        //in an array field
+			SKIP,               //in a value nothing reads
+			CAPTURE,            //in a value collected into a Document
+			DONE
+		};
+
+		/*!***********************************************************************
+		\brief		What a collected value is handed to once it is complete
+		*************************************************************************/
+		enum class CaptureTarget : uint8_t
+		{
+			SCENE_DATA,         //the scene data callback
+			CUSTOM_FIELD,       //the custom field's JSON hook
+			COMPONENT,          //the deserialize function registered for the component
+			TILE_LAYERS         //expanded into tile entities handed out in place
+		};
+
+		/*!***********************************************************************
+		\brief		The JSON type of a scalar event, for matching against fields
+		*************************************************************************/
+		enum class ScalarClass : uint8_t { NONE, BOOL, NUMBER, STRING };
+
+		/*!***********************************************************************
+		\brief		Check if a scalar can be stored in a field, the same rule
+					ComponentDescriptor::ReadJson applies
+		*************************************************************************/
+		bool Accepts(FieldType type, ScalarClass scalar)
+		{
+			switch (type)
+			{
+			case FieldType::BOOL:
+				return scalar == ScalarClass::BOOL;
+			case FieldType::STRING:
+				return scalar == ScalarClass::STRING;
+			default:
+				return scalar == ScalarClass::NUMBER;
+			}
+		}
+
+		class SceneStreamHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, SceneStreamHandler>
+		{
+		public:
+
+			using CaptureWriter = rapidjson::Writer<rapidjson::StringBuffer>;
+
+			/*!***********************************************************************
+			\brief		Constructor for SceneStreamHandler class, prefab is the
+						prefab to read a prefab JSON into, nullptr for a scene JSON
+			*************************************************************************/
+			SceneStreamHandler(Serializer& serializer, Prefab* prefab,
+				const SceneStreamReader::EntityCallback& onEntity, const SceneStreamReader::SceneDataCallback& onSceneData)
+				: m_serializer(serializer), m_prefab(prefab), m_onEntity(onEntity), m_onSceneData(onSceneData),
+				  m_captureWriter(m_captureBuffer)
+			{
+			}
+
+			/*!***********************************************************************
+			\brief		Get the number of entities handed out
+			*************************************************************************/
+			size_t GetEntityCount() const { return m_entityCount; }
+
+			//____________________________SAX EVENTS_______________________________
+
+			bool Null()
+			{
+				return OnScalar(ScalarClass::NONE, [](CaptureWriter& writer) { return writer.Null(); });
+			}
+
+			bool Bool(bool value)
+			{
+				m_value.m_Kind = FieldValue::Kind::UINT;
+				m_value.m_Uint = value ? 1 : 0;
+				return OnScalar(ScalarClass::BOOL, [value](CaptureWriter& writer) { return writer.Bool(value); });
+			}
+
+			bool Int(int value)
+			{
+				m_value.m_Kind = FieldValue::Kind::INT;
+				m_value.m_Int = value;
+				return OnScalar(ScalarClass::NUMBER, [value](CaptureWriter& writer) { return writer.Int(value); });
+			}
+
+			bool Uint(unsigned value)
+			{
+				m_value.m_Kind = FieldValue::Kind::INT;
+				m_value.m_Int = value;
+				return OnScalar(ScalarClass::NUMBER, [value](CaptureWriter& writer) { return writer.Uint(value); });
+			}
+
+			bool Int64(int64_t value)
+			{
+				m_value.m_Kind = FieldValue::Kind::INT;
+				m_value.m_Int = value;
+				return OnScalar(ScalarClass::NUMBER, [value](CaptureWriter& writer) { return writer.Int64(value); });
+			}
+
+			bool Uint64(uint64_t value)
+			{
+				m_value.m_Kind = FieldValue::Kind::UINT;
+				m_value.m_Uint = value;
+				return OnScalar(ScalarClass::NUMBER, [value](CaptureWriter& writer) { return writer.Uint64(value); });
+			}
+
+			bool Double(double value)
+			{
+				m_value.m_Kind = FieldValue::Kind::FLOAT;
+				m_value.m_Float = value;
+				return OnScalar(ScalarClass::NUMBER, [value](CaptureWriter& writer) { return writer.Double(value); });
+			}
+
+			bool String(const char* str, rapidjson::SizeType length, bool)
+			{
+				//Copied into m_value only when a field takes it
+				m_value.m_Kind = FieldValue::Kind::STRING;
+				m_string = str;
+				m_stringLength = length;
+				return OnScalar(ScalarClass::STRING, [str, length](CaptureWriter& writer) { return writer.String(str, length, true); });
+			}
+
+			bool StartObject()
+			{
+				return OnStart(true, [](CaptureWriter& writer) { return writer.StartObject(); });
+			}
+
+			bool EndObject(rapidjson::SizeType count)
+			{
+				return OnEnd([count](CaptureWriter& writer) { return writer.EndObject(count); });
+			}
+
+			bool StartArray()
+			{
+				return OnStart(false, [](CaptureWriter& writer) { return writer.StartArray(); });
+			}
+
+			bool EndArray(rapidjson::SizeType count)
+			{
+				return OnEnd([count](CaptureWriter& writer) { return writer.EndArray(count); });
+			}
+
+			bool Key(const char* str, rapidjson::SizeType length, bool)
+			{
+				switch (m_state)
+				{
+				case StreamState::SKIP:
+					return true;
+
+				case StreamState::CAPTURE:
+					return m_captureWriter.Key(str, length, true);
+
+				case StreamState::SCENE:
+					if (length == 8 && std::memcmp(str, "Entities", 8) == 0)
+					{
+						m_state = StreamState::ENTITIES_VALUE;
+					}
+					else if (std::strlen(TileLayers::s_TileLayersKey) == length && std::memcmp(str, TileLayers::s_TileLayersKey, length) == 0)
+					{
+						BeginCapture(CaptureTarget::TILE_LAYERS, StreamState::SCENE);
+					}
+					else if (m_onSceneData)
+					{
+						m_captureKey.assign(str, length);
+						BeginCapture(CaptureTarget::SCENE_DATA, StreamState::SCENE);
+					}
+					else
+					{
+						BeginSkip(StreamState::SCENE, 0);
+					}
+					return true;
+
+				case StreamState::ENTITY:
+					if (std::strlen(PrefabBaselines::s_PrefabKey) == length && std::memcmp(str, PrefabBaselines::s_PrefabKey, length) == 0)
+						m_state = StreamState::PREFAB_VALUE;
+					else
+						OnComponentKey(str, length);
+					return true;
+
+				case StreamState::COMPONENT:
+					OnFieldKey(str, length);
+					return true;
+
+				default:
+					return false;
+				}
+			}
+
+		private:
+
+			/*!***********************************************************************
+			\brief		Handle a scalar value
+			*************************************************************************/
+			template <typename Forward>
+			bool OnScalar(ScalarClass scalar, Forward forward)
+			{
+				switch (m_state)
+				{
+				case StreamState::SKIP:
+					if (m_depth == 0)
+						m_state = m_resumeState;
+					return true;
+
+				case StreamState::CAPTURE:
+					if (!forward(m_captureWriter))
+						return false;
+					return m_depth == 0 ? FinishCapture() : true;
+
+				case StreamState::FIELD_VALUE:
+					if (Accepts(m_field->m_Type, scalar))
+						m_field->m_Set(*m_component, 0, TakeValue());
+					m_state = StreamState::COMPONENT;
+					return true;
+
+				case StreamState::VERSION_VALUE:
+					if (scalar == ScalarClass::NUMBER && m_value.m_Kind != FieldValue::Kind::FLOAT)
+						m_componentVersion = static_cast<uint32_t>(m_value.AsUint());
+					m_state = StreamState::COMPONENT;
+					return true;
+
+				case StreamState::FIELD_ARRAY:
+					if (m_arrayIndex < m_field->m_Count && Accepts(m_field->m_Type, scalar))
+					{
+						m_arrayValues[m_arrayIndex] = TakeValue();
+						m_arrayMatched[m_arrayIndex] = true;
+					}
+					++m_arrayIndex;
+					return true;
+
+				case StreamState::PREFAB_VALUE:
+					if (scalar == ScalarClass::STRING)
+						ApplyPrefab();
+					m_state = StreamState::ENTITY;
+					return true;
+
+				//A scalar where a container was expected is ignored, as the DOM path does
+				case StreamState::ARRAY_VALUE:
+					m_state = StreamState::COMPONENT;
+					return true;
+				case StreamState::COMPONENT_VALUE:
+					m_state = StreamState::ENTITY;
+					return true;
+				case StreamState::ENTITIES_VALUE:
+					m_state = StreamState::SCENE;
+					return true;
+				case StreamState::ENTITIES:
+					return true;
+
+				default:
+					return false;
+				}
+			}
+
+			/*!***********************************************************************
+			\brief		Handle the start of an object or array
+			*************************************************************************/
+			template <typename Forward>
+			bool OnStart(bool isObject, Forward forward)
+			{
+				switch (m_state)
+				{
+				case StreamState::SKIP:
+					++m_depth;
+					return true;
+
+				case StreamState::CAPTURE:
+					++m_depth;
+					return forward(m_captureWriter);
+
+				case StreamState::ROOT:
+					if (!isObject)
+						return false;
+					if (m_prefab != nullptr)
+					{
+						m_entity = m_prefab;
+						m_state = StreamState::ENTITY;
+					}
+					else
+					{
+						m_state = StreamState::SCENE;
+					}
+					return true;
+
+				case StreamState::ENTITIES_VALUE:
+					if (isObject)
+						BeginSkip(StreamState::SCENE, 1);
+					else
+						m_state = StreamState::ENTITIES;
+					return true;
+
+				case StreamState::ENTITIES:
+					if (isObject)
+					{
+						HandOutTiles(false);
+						m_ownedEntity = std::make_unique<Prefab>();
+						m_entity = m_ownedEntity.get();
+						m_state = StreamState::ENTITY;
+					}
+					else
+					{
+						BeginSkip(StreamState::ENTITIES, 1);
+					}
+					return true;
+
+				case StreamState::COMPONENT_VALUE:
+					if (isObject)
+					{
+						m_fieldCursor = 0;
+						m_componentVersion = 1;
+						m_state = StreamState::COMPONENT;
+					}
+					else
+					{
+						BeginSkip(StreamState::ENTITY, 1);
+					}
+					return true;
+
+				case StreamState::FIELD_VALUE:
+				case StreamState::VERSION_VALUE:
+					BeginSkip(StreamState::COMPONENT, 1);
+					return true;
+
+				case StreamState::PREFAB_VALUE:
+					BeginSkip(StreamState::ENTITY, 1);
+					return true;
+
+				case StreamState::ARRAY_VALUE:
+					if (isObject)
+					{
+						BeginSkip(StreamState::COMPONENT, 1);
+					}
+					else
+					{
+						m_arrayIndex = 0;
+						m_arrayValues.resize(m_field->m_Count);
+						m_arrayMatched.assign(m_field->m_Count, false);
+						m_state = StreamState::FIELD_ARRAY;
+					}
+					return true;
+
+				case StreamState::FIELD_ARRAY:
+					//Nested containers count as elements of the wrong type
+					++m_arrayIndex;
+					BeginSkip(StreamState::FIELD_ARRAY, 1);
+					return true;
+
+				default:
+					return false;
+				}
+			}
+
+			/*!***********************************************************************
+			\brief		Handle the end of an object or array, rapidjson only calls
+						it for the container that is open
+			*************************************************************************/
+			template <typename Forward>
+			bool OnEnd(Forward forward)
+			{
+				switch (m_state)
+				{
+				case StreamState::SKIP:
+					if (--m_depth == 0)
+						m_state = m_resumeState;
+					return true;
+
+				case StreamState::CAPTURE:
+					if (!forward(m_captureWriter))
+						return false;
+					return --m_depth == 0 ? FinishCapture() : true;
+
+				case StreamState::SCENE:
+					HandOutTiles(true);
+					m_state = StreamState::DONE;
+					return true;
+
+				case StreamState::ENTITIES:
+					HandOutTiles(true);
+					m_state = StreamState::SCENE;
+					return true;
+
+				case StreamState::ENTITY:
+					if (m_prefab != nullptr)
+					{
+						m_state = StreamState::DONE;
+						return true;
+					}
+					++m_entityCount;
+					if (m_onEntity)
+						m_onEntity(*m_entity);
+					m_ownedEntity.reset();
+					m_entity = nullptr;
+					m_state = StreamState::ENTITIES;
+					return true;
+
+				case StreamState::COMPONENT:
+					m_descriptor->Upgrade(*m_component, m_componentVersion);
+					m_descriptor->FinishLoad(*m_component);
+					m_state = StreamState::ENTITY;
+					return true;
+
+				case StreamState::FIELD_ARRAY:
+					//Short arrays are ignored as a whole, as the DOM path does
+					if (m_arrayIndex >= m_field->m_Count)
+					{
+						for (uint32_t i = 0; i < m_field->m_Count; ++i)
+						{
+							if (m_arrayMatched[i])
+								m_field->m_Set(*m_component, i, m_arrayValues[i]);
+						}
+					}
+					m_state = StreamState::COMPONENT;
+					return true;
+
+				default:
+					return false;
+				}
+			}
+
+			/*!***********************************************************************
+			\brief		Add the component named by a key of an entity
+			*************************************************************************/
+			void OnComponentKey(const char* key, size_t length)
+			{
+				m_componentID = ComponentReflection::FindComponentID(key, length);
+				m_component = m_entity->CreateComponentByID(m_componentID);
+				m_descriptor = ComponentReflection::GetDescriptor(m_componentID);
+				if (m_component == nullptr || m_descriptor == nullptr)
+				{
+					// Handle error, log it
+					ENGINE_ERROR("Unknown component type");
+					std::cerr << "Error: Unknown component type " << std::string(key, length) << ".\n";
+					BeginSkip(StreamState::ENTITY, 0);
+					return;
+				}
+
+				const char* typeName = ComponentReflection::GetComponentName(m_componentID);
+				m_entity->AddComponent(typeName, *m_component);
+
+				if (!m_serializer.deserializeFunctions.empty() && m_serializer.deserializeFunctions.count(typeName) != 0)
+					BeginCapture(CaptureTarget::COMPONENT, StreamState::ENTITY);
+				else
+					m_state = StreamState::COMPONENT_VALUE;
+			}
+
+			/*!***********************************************************************
+			\brief		Start the entity from the prefab named by the current string,
+						the writer puts the key before every component
+			*************************************************************************/
+			void ApplyPrefab()
+			{
+				const std::string prefabPath(m_string, m_stringLength);
+				if (m_entity->IsPrefabValid())
+				{
+					ENGINE_ERROR("Prefab key after components, they are replaced by the prefab");
+				}
+				if (!PrefabBaselines::Get().Apply(m_serializer, prefabPath, *m_entity))
+				{
+					ENGINE_ERROR("Prefab baseline could not be loaded");
+					std::cerr << "Error: Could not load prefab " << prefabPath << ".\n";
+				}
+			}
+
+			/*!***********************************************************************
+			\brief		Look up the field named by a key of a component
+			*************************************************************************/
+			void OnFieldKey(const char* key, size_t length)
+			{
+				if (length == std::strlen(ComponentDescriptor::s_VersionKey) && std::memcmp(key, ComponentDescriptor::s_VersionKey, length) == 0)
+				{
+					m_state = StreamState::VERSION_VALUE;
+					return;
+				}
+
+				m_field = m_descriptor->FindField(key, length, m_fieldCursor);
+				if (m_field == nullptr)
+					BeginSkip(StreamState::COMPONENT, 0);
+				else if (m_field->m_Type == FieldType::CUSTOM)
+					BeginCapture(CaptureTarget::CUSTOM_FIELD, StreamState::COMPONENT);
+				else
+					m_state = m_field->m_Count == 1 ? StreamState::FIELD_VALUE : StreamState::ARRAY_VALUE;
+			}
+
+			/*!***********************************************************************
+			\brief		Expand the tile layer blocks of the scene, their entities are
+						handed out once the entities before them have been read
+			*************************************************************************/
+			void ReadTileLayers(const JsonValue& layers)
+			{
+				if (!layers.IsArray())
+					return;
+
+				std::vector<std::pair<size_t, const JsonValue*>> sorted;
+				for (const auto& layer : layers.GetArray())
+				{
+					if (layer.IsObject() && layer.HasMember("EntityIndex") && layer["EntityIndex"].IsUint())
+						sorted.emplace_back(layer["EntityIndex"].GetUint(), &layer);
+				}
+				std::stable_sort(sorted.begin(), sorted.end(),
+					[](const auto& a, const auto& b) { return a.first < b.first; });
+
+				m_tiles.SetArray();
+				m_tileLayers.clear();
+				m_nextLayer = 0;
+				m_nextTile = 0;
+				for (const auto& layer : sorted)
+				{
+					if (!TileLayers::ExpandLayer(*layer.second, m_tiles, m_tiles.GetAllocator()))
+					{
+						ENGINE_ERROR("Tile layer block is corrupt, its tiles were not loaded.");
+						continue;
+					}
+					m_tileLayers.emplace_back(layer.first, m_tiles.Size());
+				}
+			}
+
+			/*!***********************************************************************
+			\brief		Hand out the tiles of every block that starts at the current
+						entity, or of every block left if all is set
+			*************************************************************************/
+			void HandOutTiles(bool all)
+			{
+				while (m_nextLayer < m_tileLayers.size() && (all || m_tileLayers[m_nextLayer].first <= m_entityCount))
+				{
+					for (; m_nextTile < m_tileLayers[m_nextLayer].second; ++m_nextTile)
+					{
+						Prefab tile;
+						tile.DeserializeSceneEntity(m_serializer, m_tiles[m_nextTile]);
+						++m_entityCount;
+						if (m_onEntity)
+							m_onEntity(tile);
+					}
+					++m_nextLayer;
+				}
+			}
+
+			/*!***********************************************************************
+			\brief		Get the value of the current scalar event
+			*************************************************************************/
+			const FieldValue& TakeValue()
+			{
+				if (m_value.m_Kind == FieldValue::Kind::STRING)
+					m_value.m_String.assign(m_string, m_stringLength);
+				return m_value;
+			}
+
+			/*!***********************************************************************
+			\brief		Skip the next value, depth is 1 if its first event was
+						already handled
+			*************************************************************************/
+			void BeginSkip(StreamState resumeState, uint32_t depth)
+			{
+				m_resumeState = resumeState;
+				m_depth = depth;
+				m_state = StreamState::SKIP;
+			}
+
+			/*!***********************************************************************
+			\brief		Collect the next value into a Document
+			*************************************************************************/
+			void BeginCapture(CaptureTarget target, StreamState resumeState)
+			{
+				m_captureBuffer.Clear();
+				m_captureWriter.Reset(m_captureBuffer);
+				m_captureTarget = target;
+				m_resumeState = resumeState;
+				m_depth = 0;
+				m_state = StreamState::CAPTURE;
+			}
+
+			/*!***********************************************************************
+			\brief		Parse a collected value and hand it on
+			*************************************************************************/
+			bool FinishCapture()
+			{
+				m_state = m_resumeState;
+
+				// Parsed into the reader's arena, which is reset rather than freed per capture
+				const JsonParseContext::Document& document = m_captureContext->Parse(m_captureBuffer.GetString(), m_captureBuffer.GetSize());
+				if (document.HasParseError())
+					return false;
+
+				switch (m_captureTarget)
+				{
+				case CaptureTarget::SCENE_DATA:
+					m_onSceneData(m_captureKey, document);
+					break;
+				case CaptureTarget::CUSTOM_FIELD:
+					m_field->m_ReadJson(document, *m_component);
+					break;
+				case CaptureTarget::COMPONENT:
+					m_serializer.Deserialize(document, *m_component, m_componentID);
+					break;
+				case CaptureTarget::TILE_LAYERS:
+					ReadTileLayers(document);
+					break;
+				}
+				return true;
+			}
+
+			Serializer& m_serializer;
+			Prefab* m_prefab;
+			const SceneStreamReader::EntityCallback& m_onEntity;
+			const SceneStreamReader::SceneDataCallback& m_onSceneData;
+
+			StreamState m_state{ StreamState::ROOT };
+			StreamState m_resumeState{ StreamState::ROOT };
+			uint32_t m_depth{};
+
+			std::unique_ptr<Prefab> m_ownedEntity;
+			Prefab* m_entity{};
+			size_t m_entityCount{};
+
+			ComponentTypeID m_componentID{ ComponentTypeID::INVALID };
+			Components* m_component{};
+			const ComponentDescriptor* m_descriptor{};
+			const FieldInfo* m_field{};
+			size_t m_fieldCursor{};
+			uint32_t m_componentVersion{ 1 };	//from the version key, 1 if the component has none
+
+			FieldValue m_value;
+			const char* m_string{};
+			size_t m_stringLength{};
+			uint32_t m_arrayIndex{};
+			std::vector<FieldValue> m_arrayValues;
+			std::vector<bool> m_arrayMatched;
+
+			rapidjson::Document m_tiles;
+			std::vector<std::pair<size_t, rapidjson::SizeType>> m_tileLayers;	//entity index and end in m_tiles of each block
+			size_t m_nextLayer{};
+			rapidjson::SizeType m_nextTile{};
+
+			CaptureTarget m_captureTarget{ CaptureTarget::SCENE_DATA };
+			std::string m_captureKey;
+			rapidjson::StringBuffer m_captureBuffer;
+			CaptureWriter m_captureWriter;
+			JsonParseContext::Lease m_captureContext{ JsonParseContext::Acquire() };
+		};
+	}
+
+	/*!***********************************************************************
+	\brief		Constructor for SceneStreamReader class
+	*************************************************************************/
+	SceneStreamReader::SceneStreamReader(Serializer& serializer, EntityCallback onEntity, SceneDataCallback onSceneData)
+		: m_serializer(serializer), m_onEntity(std::move(onEntity)), m_onSceneData(std::move(onSceneData))
+	{
+	}
+
+	/*!***********************************************************************
+	\brief		Run the SAX reader over a stream
+	*************************************************************************/
+	template <typename Stream>
+	bool SceneStreamReader::Parse(Stream& stream, Prefab* prefab)
+	{
+		SceneStreamHandler handler(m_serializer, prefab, m_onEntity, m_onSceneData);
+		rapidjson::Reader reader;
+		const rapidjson::ParseResult result = reader.Parse<rapidjson::kParseDefaultFlags>(stream, handler);
+		m_entityCount = handler.GetEntityCount();
+
+		if (result.IsError())
+		{
+			ENGINE_ERROR("Error: JSON stream parse failed.\n");
+			std::cerr << "Error: " << rapidjson::GetParseError_En(result.Code()) << " at offset " << result.Offset() << ".\n";
+			return false;
+		}
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Stream a scene JSON from disk in fixed size blocks
+	*************************************************************************/
+	bool SceneStreamReader::ReadFile(const std::string& filePath)
+	{
+		const std::string loadPath = VirtualFileSystem::Get().getLoadPath(filePath);
+		std::FILE* file = std::fopen(loadPath.c_str(), "rb");
+		if (file == nullptr)
+		{
+			std::cerr << "Could not open the file: " << filePath << std::endl;
+			m_entityCount = 0;
+			return false;
+		}
+
+		std::vector<char> block(s_ReadBlockSize);
+		rapidjson::FileReadStream stream(file, block.data(), block.size());
+		const bool result = Parse(stream, nullptr);
+		std::fclose(file);
+		return result;
+	}
+
+	/*!***********************************************************************
+	\brief		Stream a scene JSON already in memory
+	*************************************************************************/
+	bool SceneStreamReader::Read(const std::string& json)
+	{
+		rapidjson::StringStream stream(json.c_str());
+		return Parse(stream, nullptr);
+	}
+
+	/*!***********************************************************************
+	\brief		Read a prefab JSON into a prefab without building a Document
+	*************************************************************************/
+	bool SceneStreamReader::ReadPrefab(Serializer& serializer, const std::string& json, Prefab& prefab)
+	{
+		SceneStreamReader streamReader(serializer, nullptr);
+		rapidjson::StringStream stream(json.c_str());
+		return streamReader.Parse(stream, &prefab);
+	}
+}
@@ -0,0 +1,103 @@
+/******************************************************************************/
+/*!
+\file       SceneStreamReader.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the SceneStreamReader
+            class, which loads scene and prefab JSON with the rapidjson SAX
+            Reader instead of a Document
+
+            Each element of "Entities" is read straight into a Prefab through
+            the component field tables and handed to the entity callback as
+            soon as its closing brace is parsed, so only one entity is held in
+            memory at a time and instantiation can start before the rest of
+            the file has been read. Values the tables cannot set field by field
+            (custom fields, components with a registered deserialize function
+            and scene data such as "Layers") are collected into a small
+            Document of their own. Tile layer blocks are expanded when they
+            are read and their entities handed out at the index they were
+            packed from.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _SCENESTREAMREADER_H_
+#define _SCENESTREAMREADER_H_
+
+#include <string>
+#include <functional>
+#include "ComponentReflection.h"
+
+namespace SOL
+{
+    class Serializer;
+    class Prefab;
+
+    class SceneStreamReader
+    {
+    public:
+
+        using EntityCallback = std::function<void(Prefab& entity)>;
+        using SceneDataCallback = std::function<void(const std::string& key, const JsonValue& value)>;
+
+        /*!***********************************************************************
+        \brief		Constructor for SceneStreamReader class.
+        \param      serializer Consulted for registered deserialize functions,
+                    onEntity Called with every entity once it is complete,
+                    onSceneData Called with every top level member except
+                    "Entities" and "TileLayers", may be nullptr to skip them.
+        *************************************************************************/
+        SceneStreamReader(Serializer& serializer, EntityCallback onEntity, SceneDataCallback onSceneData = nullptr);
+
+        /*!***********************************************************************
+        \brief		Stream a scene JSON from disk in fixed size blocks.
+        \param      filePath The scene JSON, resolved through the
+                    VirtualFileSystem mounts.
+        \return     False if the file could not be opened or parsed, entities
+                    before the error have already been handed out.
+        *************************************************************************/
+        bool ReadFile(const std::string& filePath);
+
+        /*!***********************************************************************
+        \brief		Stream a scene JSON already in memory.
+        \param      json The scene JSON.
+        \return     False if the JSON could not be parsed.
+        *************************************************************************/
+        bool Read(const std::string& json);
+
+        /*!***********************************************************************
+        \brief		Get the number of entities handed out by the last read.
+        *************************************************************************/
+        size_t GetEntityCount() const { return m_entityCount; }
+
+        /*!***********************************************************************
+        \brief		Read a prefab JSON, a single object of components, into a
+                    prefab without building a Document.
+        \param      serializer The serializer, json The prefab JSON,
+                    prefab Receives the components.
+        \return     False if the JSON could not be parsed.
+        *************************************************************************/
+        static bool ReadPrefab(Serializer& serializer, const std::string& json, Prefab& prefab);
+
+    private:
+
+        /*!***********************************************************************
+        \brief		Run the SAX reader over a stream.
+        \param      stream The rapidjson input stream, prefab The prefab to
+                    read a prefab JSON into, nullptr for a scene JSON.
+        \return     False if the JSON could not be parsed.
+        *************************************************************************/
+        template <typename Stream>
+        bool Parse(Stream& stream, Prefab* prefab);
+
+        Serializer& m_serializer;
+        EntityCallback m_onEntity;
+        SceneDataCallback m_onSceneData;
+        size_t m_entityCount{};
+    };
+}
+#endif  //_SCENESTREAMREADER_H_
@@ -20,6 +20,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <rapidjson/writer.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/prettywriter.h>
+#include "ComponentReflection.h"
 #include <string>
 #include <functional>
 #include <map>
@@ -35,43 +36,12 @@ namespace SOL
     public:
 
         /*!***********************************************************************
-        \brief		Constructor for Serializer class.
+        \brief		Constructor for Serializer class. Described components dispatch
+                    through the static ComponentReflection tables, so nothing is
+                    registered per instance.
         *************************************************************************/
         Serializer()
         {
-            RegisterDeserializeFunction("TransformComponent", Serializer::DeserializeTransformComponent);
-            RegisterDeserializeFunction("MovementComponent", Serializer::DeserializeMovementComponent);
-            RegisterDeserializeFunction("PrimitiveComponent", Serializer::DeserializePrimitiveComponent);
-            RegisterDeserializeFunction("SpriteComponent", Serializer::DeserializeSpriteComponent);
-            RegisterDeserializeFunction("PlayerComponent", Serializer::DeserializePlayerComponent);
-            RegisterDeserializeFunction("NameComponent", Serializer::DeserializeNameComponent);
-            RegisterDeserializeFunction("RigidBody2DComponent", Serializer::DeserializeRigidBody2DComponent);
-            RegisterDeserializeFunction("CameraComponent", Serializer::DeserializeCameraComponent);
-            RegisterDeserializeFunction("FontComponent", Serializer::DeserializeFontComponent);
-            RegisterDeserializeFunction("AnimationComponent", Serializer::DeserializeAnimationComponent);
-            RegisterDeserializeFunction("GemComponent", Serializer::DeserializeGemComponent);
-            RegisterDeserializeFunction("UIComponent", Serializer::DeserializeUIComponent);
-            RegisterDeserializeFunction("AudioComponent", Serializer::DeserializeAudioComponent);
-            RegisterDeserializeFunction("EnemyComponent", Serializer::DeserializeEnemyComponent);
-            RegisterDeserializeFunction("TileComponent", Serializer::DeserializeTileComponent);
-            RegisterDeserializeFunction("CPPScriptComponent", Serializer::DeserializeCPPScriptComponent);
-
-            RegisterSerializeFunction("TransformComponent", Serializer::SerializeTransformComponent);
-            RegisterSerializeFunction("MovementComponent", Serializer::SerializeMovementComponent);
-            RegisterSerializeFunction("PrimitiveComponent", Serializer::SerializePrimitiveComponent);
-            RegisterSerializeFunction("SpriteComponent", Serializer::SerializeSpriteComponent);
-            RegisterSerializeFunction("PlayerComponent", Serializer::SerializePlayerComponent);
-            RegisterSerializeFunction("NameComponent", Serializer::SerializeNameComponent);
-            RegisterSerializeFunction("RigidBody2DComponent", Serializer::SerializeRigidBody2DComponent);
-            RegisterSerializeFunction("CameraComponent", Serializer::SerializeCameraComponent);
-            RegisterSerializeFunction("FontComponent", Serializer::SerializefontComponent);
-            RegisterSerializeFunction("AnimationComponent", Serializer::SerializeAnimationComponent);
-            RegisterSerializeFunction("GemComponent", Serializer::SerializeGemComponent);
-            RegisterSerializeFunction("UIComponent", Serializer::SerializeUIComponent);
-            RegisterSerializeFunction("AudioComponent", Serializer::SerializeAudioComponent);
-            RegisterSerializeFunction("EnemyComponent", Serializer::SerializeEnemyComponent);
-            RegisterSerializeFunction("TileComponent", Serializer::SerializeTileComponent);
-            RegisterSerializeFunction("CPPScriptComponent", Serializer::SerializeCPPScriptComponent);
         }
 
         /*!***********************************************************************
@@ -82,16 +52,18 @@ namespace SOL
 
         }
 
-        using Writer = rapidjson::PrettyWriter<rapidjson::StringBuffer>;
-        using Reader = rapidjson::GenericValue<rapidjson::UTF8<>>;
+        using Writer = JsonWriter;
+        using Reader = JsonValue;
 
         /*!***********************************************************************
-        \brief		Function objects for serialization.
+        \brief		Function objects for serialization, only needed to override
+                    the generated codec of a component.
         *************************************************************************/
         std::map<std::string, std::function<void(Writer&, const Components&)>> serializeFunctions;
 
         /*!***********************************************************************
-        \brief		Function objects for deserialization.
+        \brief		Function objects for deserialization, only needed to override
+                    the generated codec of a component.
         *************************************************************************/
         std::map<std::string, std::function<void(const Reader&, Components&)>> deserializeFunctions;
 
@@ -109,6 +81,20 @@ namespace SOL
         *************************************************************************/
         void Deserialize(const Reader& reader, Components& component, const std::string& typeName);
 
+        /*!***********************************************************************
+        \brief		Serialize by component type ID, an array index per call.
+        \param      writer Writer reference, id ComponentTypeID,
+                    component const Components reference.
+        *************************************************************************/
+        void Serialize(Writer& writer, ComponentTypeID id, const Components& component);
+
+        /*!***********************************************************************
+        \brief		Deserialize by component type ID, an array index per call.
+        \param      reader const Reader reference, component Components reference,
+                    id ComponentTypeID.
+        *************************************************************************/
+        void Deserialize(const Reader& reader, Components& component, ComponentTypeID id);
+
         /*!***********************************************************************
         \brief		Register serialization functions.
         \param      typeName const std::string reference,
@@ -129,167 +115,40 @@ namespace SOL
         *************************************************************************/
         static std::string readJsonFile(const std::string& filePath);
 
-
-//________________________EXTEND WHEN NEW COMPONENTS IMPLEMENTED(ADD MORE)________________________
-        /*!***********************************************************************
-        \brief		Serializes function for transform component
-        *************************************************************************/
-        static void SerializeTransformComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		Serializes function for movement component
-        *************************************************************************/
-        static void SerializeMovementComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		Serializes function for primitive component
-        *************************************************************************/
-        static void SerializePrimitiveComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		Serializes function for sprite component
-        *************************************************************************/
-        static void SerializeSpriteComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		Serializes function for Name component
-        *************************************************************************/
-        static void SerializeNameComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		Serializes function for Player component
-        *************************************************************************/
-        static void SerializePlayerComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		Serializes function for Rigidbody component
-        *************************************************************************/
-        static void SerializeRigidBody2DComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		Serializes function for Camera component
-        *************************************************************************/
-        static void SerializeCameraComponent(Writer& writer, const Components& component);
-        /*!***********************************************************************
-        \brief		Serializes function for font component
-        *************************************************************************/
-        static void SerializefontComponent(Writer& writer, const Components& component);
-
         /*!***********************************************************************
-        \brief		Serializes function for animation component
+        \brief		Function to write a scene Json File. Runs of tile entities are
+                    packed into tile layer blocks first, so the scene save calls
+                    this with the scene it wrote instead of writing the file
+                    itself.
+        \param      filePath const std::string reference, resolved through
+                    VirtualFileSystem::getWritePath, sceneJson The scene.
+        \return     False if the scene is not valid JSON or was not written.
         *************************************************************************/
-        static void SerializeAnimationComponent(Writer& writer, const Components& component);
+        static bool writeSceneFile(const std::string& filePath, const std::string& sceneJson);
 
-        /*!***********************************************************************
-        \brief		Serializes function for gem component
-        *************************************************************************/
-        static void SerializeGemComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		Serializes function for UI component
-        *************************************************************************/
-        static void SerializeUIComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		Serializes function for audio component
-        *************************************************************************/
-        static void SerializeAudioComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		Serializes function for enemy component
-        *************************************************************************/
-        static void SerializeEnemyComponent(Writer& writer, const Components& component);
 
         /*!***********************************************************************
-        \brief		Serializes function for tile component
-        *************************************************************************/
-        static void SerializeTileComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		Serializes function for CPP script component
-        *************************************************************************/
-        static void SerializeCPPScriptComponent(Writer& writer, const Components& component);
-
-        /*!***********************************************************************
-        \brief		deserializes function for transform component
-        *************************************************************************/
-        static void DeserializeTransformComponent(const Reader& reader, Components& component);
-
-        /*!***********************************************************************
-        \brief		deserializes function for movement component
-        *************************************************************************/
-        static void DeserializeMovementComponent(const Reader& reader, Components& component);
-
-        /*!***********************************************************************
-        \brief		deserializes function for Primitive component
-        *************************************************************************/
-        static void DeserializePrimitiveComponent(const Reader& reader, Components& component);
-
-        /*!***********************************************************************
-        \brief		deSerializes function for sprite component
-        *************************************************************************/
-        static void DeserializeSpriteComponent(const Reader& reader, Components& component);
-
-        /*!***********************************************************************
-        \brief		deserializes function for Name component
-        *************************************************************************/
-        static void DeserializeNameComponent(const Reader& reader, Components& component);
-
-        /*!***********************************************************************
-        \brief		deserializes function for player component
-        *************************************************************************/
-        static void DeserializePlayerComponent(const Reader& reader, Components& component);
-
-        /*!***********************************************************************
-        \brief		deserializes function for rigidbody component
-        *************************************************************************/
-        static void DeserializeRigidBody2DComponent(const Reader& reader, Components& component);
-
-        /*!***********************************************************************
-        \brief		deserializes function for camera component
-        *************************************************************************/
-        static void DeserializeCameraComponent(const Reader& reader, Components& component);
-
-
-        /*!***********************************************************************
-        \brief		deserializes function for font component
-        *************************************************************************/
-        static void DeserializeFontComponent(const Reader& reader, Components& component);
-
-        /*!***********************************************************************
-        \brief		deserializes function for animation component
-        *************************************************************************/
-        static void DeserializeAnimationComponent(const Reader& reader, Components& component);
-
-        /*!***********************************************************************
-        \brief		deserializes function for gem component
-        *************************************************************************/
-        static void DeserializeGemComponent(const Reader& reader, Components& component);
-                    
-        /*!***********************************************************************
-        \brief		deserializes function for UI component
-        *************************************************************************/
-        static void DeserializeUIComponent(const Reader& reader, Components& component);
-                    
-        /*!***********************************************************************
-        \brief		deserializes function for audio component
-        *************************************************************************/
-        static void DeserializeAudioComponent(const Reader& reader, Components& component);
-
-        /*!***********************************************************************
-        \brief		deserializes function for enemy component
+        \brief		Serialize a component as binary using its field table.
+        \param      writer BinaryWriter reference, typeName const std::string reference,
+                    component const Components reference.
         *************************************************************************/
-        static void DeserializeEnemyComponent(const Reader& reader, Components& component);
+        void SerializeBinary(BinaryWriter& writer, const std::string& typeName, const Components& component);
 
         /*!***********************************************************************
-        \brief		deserializes function for tile component
+        \brief		Deserialize a component written by SerializeBinary.
+        \param      reader BinaryReader reference, component Components reference,
+                    typeName const std::string reference.
+        \return     False if the type is not described or the data was truncated.
         *************************************************************************/
-        static void DeserializeTileComponent(const Reader& reader, Components& component);
+        bool DeserializeBinary(BinaryReader& reader, Components& component, const std::string& typeName);
 
         /*!***********************************************************************
-        \brief		deserializes function for CPP script component
+        \brief		Deserialize a component written by SerializeBinary by type ID.
+        \param      reader BinaryReader reference, component Components reference,
+                    id ComponentTypeID.
+        \return     False if the type is not described or the data was truncated.
         *************************************************************************/
-        static void DeserializeCPPScriptComponent(const Reader& reader, Components& component);
+        bool DeserializeBinary(BinaryReader& reader, Components& component, ComponentTypeID id);
 
     private:
 
@@ -0,0 +1,550 @@
+/******************************************************************************/
+/*!
+\file		SerializerBenchmark.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the SerializerBenchmark
+		class, which round trips every scene and prefab file through the
+		Serializer and reports what each phase costs
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "SerializerBenchmark.h"
+#include "Serializer.h"
+#include "Prefab.h"
+#include "TileLayers.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <iomanip>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+#ifdef SOL_SERIALIZER_BENCHMARK_ALLOCATIONS
+namespace
+{
+	std::atomic<size_t> s_AllocationCount{};
+	std::atomic<size_t> s_LiveBytes{};
+	std::atomic<size_t> s_PeakBytes{};
+
+	// Every block carries its size in front of it so delete can count it back
+	const size_t s_BlockHeader = alignof(std::max_align_t);
+
+	/*!***********************************************************************
+	\brief		Allocate a counted block, nullptr if out of memory
+	*************************************************************************/
+	void* CountedAlloc(size_t size)
+	{
+		void* block = std::malloc(size + s_BlockHeader);
+		if (block == nullptr)
+			return nullptr;
+
+		*static_cast<size_t*>(block) = size;
+		s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+		const size_t live = s_LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+		size_t peak = s_PeakBytes.load(std::memory_order_relaxed);
+		while (live > peak && !s_PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+		{
+		}
+		return static_cast<char*>(block) + s_BlockHeader;
+	}
+
+	/*!***********************************************************************
+	\brief		Free a block from CountedAlloc
+	*************************************************************************/
+	void CountedFree(void* pointer)
+	{
+		if (pointer == nullptr)
+			return;
+
+		void* block = static_cast<char*>(pointer) - s_BlockHeader;
+		s_LiveBytes.fetch_sub(*static_cast<size_t*>(block), std::memory_order_relaxed);
+		std::free(block);
+	}
+}
+
+void* operator new(size_t size)
+{
+	void* pointer = CountedAlloc(size);
+	if (pointer == nullptr)
+		throw std::bad_alloc();
+	return pointer;
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return CountedAlloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return CountedAlloc(size);
+}
+
+void operator delete(void* pointer) noexcept { CountedFree(pointer); }
+void operator delete[](void* pointer) noexcept { CountedFree(pointer); }
+void operator delete(void* pointer, size_t) noexcept { CountedFree(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { CountedFree(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { CountedFree(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { CountedFree(pointer); }
+#endif
+
+namespace SOL
+{
+	namespace
+	{
+		using Entities = std::vector<std::unique_ptr<Prefab>>;
+
+		/*!***********************************************************************
+		\brief		Times one run of a phase and counts what it allocates
+		*************************************************************************/
+		class PhaseTimer
+		{
+		public:
+			explicit PhaseTimer(SerializerBenchmark::PhaseStats& stats)
+				: m_stats(stats)
+			{
+#ifdef SOL_SERIALIZER_BENCHMARK_ALLOCATIONS
+				m_allocations = s_AllocationCount.load();
+				m_liveBytes = s_LiveBytes.load();
+				s_PeakBytes.store(m_liveBytes);
+#endif
+				m_start = std::chrono::steady_clock::now();
+			}
+
+			/*!***********************************************************************
+			\brief		Add the run to the phase totals
+			*************************************************************************/
+			void Stop(size_t bytes, size_t entities)
+			{
+				m_stats.m_Seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+				m_stats.m_Bytes += bytes;
+				m_stats.m_Entities += entities;
+#ifdef SOL_SERIALIZER_BENCHMARK_ALLOCATIONS
+				m_stats.m_Allocations += s_AllocationCount.load() - m_allocations;
+				const size_t peak = s_PeakBytes.load();
+				m_stats.m_PeakHeapBytes = std::max(m_stats.m_PeakHeapBytes, peak > m_liveBytes ? peak - m_liveBytes : 0);
+#endif
+			}
+
+		private:
+			SerializerBenchmark::PhaseStats& m_stats;
+			std::chrono::steady_clock::time_point m_start;
+#ifdef SOL_SERIALIZER_BENCHMARK_ALLOCATIONS
+			size_t m_allocations{};
+			size_t m_liveBytes{};
+#endif
+		};
+
+		/*!***********************************************************************
+		\brief		Check if a top level member holds the entities of a scene
+		*************************************************************************/
+		bool IsEntityMember(const JsonValue& name)
+		{
+			return std::strcmp(name.GetString(), "Entities") == 0 || std::strcmp(name.GetString(), TileLayers::s_TileLayersKey) == 0;
+		}
+
+		/*!***********************************************************************
+		\brief		Check if a parsed file is a scene, prefab files are a single
+					object of components
+		*************************************************************************/
+		bool IsScene(const JsonValue& document)
+		{
+			for (auto it = document.MemberBegin(); it != document.MemberEnd(); ++it)
+			{
+				if (IsEntityMember(it->name))
+					return true;
+			}
+			return false;
+		}
+
+		/*!***********************************************************************
+		\brief		Deserialize every entity of a parsed scene or prefab file
+		*************************************************************************/
+		bool DeserializeEntities(Serializer& serializer, const rapidjson::Document& document, bool scene, Entities& entities)
+		{
+			std::vector<const JsonValue*> elements;
+			rapidjson::Document tiles;
+			if (!scene)
+			{
+				elements.push_back(&document);
+			}
+			else if (!TileLayers::GatherEntities(document, tiles, elements))
+			{
+				return false;
+			}
+
+			entities.clear();
+			entities.reserve(elements.size());
+			for (const JsonValue* element : elements)
+			{
+				if (!element->IsObject())
+					return false;
+				entities.push_back(std::make_unique<Prefab>());
+				entities.back()->DeserializeSceneEntity(serializer, *element);
+			}
+			return true;
+		}
+
+		/*!***********************************************************************
+		\brief		Serialize entities the way the scene or prefab file held them,
+					tile layer blocks are written back as entities
+		*************************************************************************/
+		void SerializeEntities(Serializer& serializer, const rapidjson::Document& document, bool scene, Entities& entities,
+			rapidjson::StringBuffer& buffer)
+		{
+			JsonWriter writer(buffer);
+			writer.StartObject();
+			if (!scene)
+			{
+				entities.front()->SerializeSceneEntity(serializer, writer);
+				writer.EndObject();
+				return;
+			}
+
+			bool entitiesWritten = false;
+			for (auto it = document.MemberBegin(); it != document.MemberEnd(); ++it)
+			{
+				if (!IsEntityMember(it->name))
+				{
+					writer.Key(it->name.GetString(), it->name.GetStringLength());
+					it->value.Accept(writer);
+					continue;
+				}
+				if (entitiesWritten)
+					continue;
+
+				writer.Key("Entities");
+				writer.StartArray();
+				for (std::unique_ptr<Prefab>& entity : entities)
+				{
+					writer.StartObject();
+					entity->SerializeSceneEntity(serializer, writer);
+					writer.EndObject();
+				}
+				writer.EndArray();
+				entitiesWritten = true;
+			}
+			writer.EndObject();
+		}
+
+		/*!***********************************************************************
+		\brief		Write every component of the entities in full, prefab deltas
+					resolved, so two loads can be compared
+		*************************************************************************/
+		void ResolveEntities(Serializer& serializer, Entities& entities, rapidjson::Document& resolved)
+		{
+			rapidjson::StringBuffer buffer;
+			JsonWriter writer(buffer);
+			writer.StartArray();
+			for (std::unique_ptr<Prefab>& entity : entities)
+			{
+				writer.StartObject();
+				for (const auto& pair : entity->GetEntityComponentMap())
+				{
+					writer.String(pair.first.c_str());
+					serializer.Serialize(writer, pair.first, pair.second);
+				}
+				writer.EndObject();
+			}
+			writer.EndArray();
+			resolved.Parse(buffer.GetString(), buffer.GetSize());
+		}
+
+		/*!***********************************************************************
+		\brief		Compare what the engine loads from the original and the
+					written file
+		*************************************************************************/
+		bool VerifyRoundTrip(Serializer& serializer, const rapidjson::Document& original, bool scene, Entities& entities,
+			const rapidjson::StringBuffer& written, std::string& difference)
+		{
+			rapidjson::Document reloaded;
+			reloaded.Parse(written.GetString(), written.GetSize());
+			if (reloaded.HasParseError() || !reloaded.IsObject())
+			{
+				difference = "the written JSON does not parse";
+				return false;
+			}
+
+			Entities reloadedEntities;
+			if (!DeserializeEntities(serializer, reloaded, scene, reloadedEntities))
+			{
+				difference = "the written entities do not load";
+				return false;
+			}
+
+			// Scene data outside the entities is copied as it is
+			for (auto it = original.MemberBegin(); scene && it != original.MemberEnd(); ++it)
+			{
+				if (IsEntityMember(it->name))
+					continue;
+
+				auto copy = reloaded.FindMember(it->name);
+				std::string path = it->name.GetString();
+				if (copy == reloaded.MemberEnd() || !SerializerBenchmark::CompareJson(it->value, copy->value, path))
+				{
+					difference = path;
+					return false;
+				}
+			}
+
+			rapidjson::Document before, after;
+			ResolveEntities(serializer, entities, before);
+			ResolveEntities(serializer, reloadedEntities, after);
+			difference = "Entities";
+			return SerializerBenchmark::CompareJson(before, after, difference);
+		}
+
+		/*!***********************************************************************
+		\brief		Get the directory round tripped files are written to
+		*************************************************************************/
+		std::filesystem::path GetOutputDirectory()
+		{
+			std::error_code ec;
+			return std::filesystem::temp_directory_path(ec) / "SOLSerializerBenchmark";
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Round trip every .json file in the directories
+	*************************************************************************/
+	SerializerBenchmark::Result SerializerBenchmark::Run(const std::vector<std::string>& directories, size_t iterations)
+	{
+		Result result;
+		result.m_Iterations = std::max<size_t>(iterations, 1);
+
+		std::vector<std::string> files;
+		for (const std::string& directory : directories)
+		{
+			std::error_code ec;
+			for (std::filesystem::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec))
+			{
+				if (it->is_regular_file() && it->path().extension() == ".json")
+					files.push_back(it->path().generic_string());
+			}
+			if (ec)
+			{
+				ENGINE_ERROR("Benchmark directory could not be read");
+				std::cerr << "Error: Could not read " << directory << ".\n";
+			}
+		}
+		std::sort(files.begin(), files.end());
+
+		std::error_code ec;
+		std::filesystem::create_directories(GetOutputDirectory(), ec);
+		for (const std::string& file : files)
+		{
+			RunFile(file, result.m_Iterations, result);
+		}
+		std::filesystem::remove_all(GetOutputDirectory(), ec);
+
+		return result;
+	}
+
+	/*!***********************************************************************
+	\brief		Round trip the scenes and prefabs shipped with the game
+	*************************************************************************/
+	SerializerBenchmark::Result SerializerBenchmark::RunDefault(size_t iterations)
+	{
+		return Run({ "./Json/Scene", "./Json/Prefab" }, iterations);
+	}
+
+	/*!***********************************************************************
+	\brief		Round trip one file
+	*************************************************************************/
+	void SerializerBenchmark::RunFile(const std::string& filePath, size_t iterations, Result& result)
+	{
+		const std::string json = Serializer::readJsonFile(filePath);
+		if (json.empty())
+		{
+			result.m_Failures.push_back(filePath + ": could not be read");
+			return;
+		}
+
+		const std::string outputPath = (GetOutputDirectory() / std::filesystem::path(filePath).filename()).string();
+		Serializer serializer;
+		++result.m_Files;
+
+		for (size_t iteration = 0; iteration < iterations; ++iteration)
+		{
+			rapidjson::Document document;
+			{
+				PhaseTimer timer(result.m_Phases[PHASE_PARSE]);
+				document.Parse(json.c_str(), json.size());
+				timer.Stop(json.size(), 0);
+			}
+			if (document.HasParseError() || !document.IsObject())
+			{
+				result.m_Failures.push_back(filePath + ": not a JSON object");
+				return;
+			}
+
+			const bool scene = IsScene(document);
+			Entities entities;
+			{
+				PhaseTimer timer(result.m_Phases[PHASE_DESERIALIZE]);
+				const bool loaded = DeserializeEntities(serializer, document, scene, entities);
+				timer.Stop(json.size(), entities.size());
+				if (!loaded)
+				{
+					result.m_Failures.push_back(filePath + ": entities could not be deserialized");
+					return;
+				}
+			}
+
+			rapidjson::StringBuffer buffer;
+			{
+				PhaseTimer timer(result.m_Phases[PHASE_SERIALIZE]);
+				SerializeEntities(serializer, document, scene, entities, buffer);
+				timer.Stop(buffer.GetSize(), entities.size());
+			}
+
+			{
+				PhaseTimer timer(result.m_Phases[PHASE_WRITE]);
+				std::ofstream outFile(outputPath, std::ios::binary);
+				outFile.write(buffer.GetString(), static_cast<std::streamsize>(buffer.GetSize()));
+				outFile.close();
+				timer.Stop(buffer.GetSize(), entities.size());
+				if (!outFile)
+				{
+					result.m_Failures.push_back(filePath + ": could not write " + outputPath);
+					return;
+				}
+			}
+
+			// Checked once, outside the timed phases
+			std::string difference;
+			if (iteration == 0 && !VerifyRoundTrip(serializer, document, scene, entities, buffer, difference))
+			{
+				result.m_Failures.push_back(filePath + ": round trip differs at " + difference);
+				return;
+			}
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Write a table of the results
+	*************************************************************************/
+	void SerializerBenchmark::Report(const Result& result, std::ostream& out)
+	{
+		static const char* const s_PhaseNames[PHASE_COUNT] = { "Parse", "Deserialize", "Serialize", "Write" };
+
+		out << "Serializer round trip: " << result.m_Files << " files x " << result.m_Iterations << " iterations\n";
+		out << std::left << std::setw(13) << "Phase" << std::right
+			<< std::setw(12) << "ms" << std::setw(12) << "MB/s" << std::setw(14) << "entities/s";
+		if (CountsAllocations())
+			out << std::setw(14) << "allocations" << std::setw(14) << "peak KB";
+		out << "\n";
+
+		out << std::fixed << std::setprecision(2);
+		for (int phase = 0; phase < PHASE_COUNT; ++phase)
+		{
+			const PhaseStats& stats = result.m_Phases[phase];
+			const double seconds = stats.m_Seconds > 0.0 ? stats.m_Seconds : 1e-9;
+			out << std::left << std::setw(13) << s_PhaseNames[phase] << std::right
+				<< std::setw(12) << stats.m_Seconds * 1000.0
+				<< std::setw(12) << static_cast<double>(stats.m_Bytes) / (1024.0 * 1024.0) / seconds
+				<< std::setw(14) << static_cast<double>(stats.m_Entities) / seconds;
+			if (CountsAllocations())
+				out << std::setw(14) << stats.m_Allocations << std::setw(14) << static_cast<double>(stats.m_PeakHeapBytes) / 1024.0;
+			out << "\n";
+		}
+		out.unsetf(std::ios::floatfield);
+
+		if (!CountsAllocations())
+			out << "Allocations are counted when built with SOL_SERIALIZER_BENCHMARK_ALLOCATIONS\n";
+
+		for (const std::string& failure : result.m_Failures)
+		{
+			out << "FAILED " << failure << "\n";
+		}
+		out << (result.m_Failures.empty() ? "All files round tripped\n" : "Round trip failed\n");
+	}
+
+	/*!***********************************************************************
+	\brief		Compare two JSON values, ignoring member order and float rounding
+	*************************************************************************/
+	bool SerializerBenchmark::CompareJson(const JsonValue& a, const JsonValue& b, std::string& path)
+	{
+		if (a.IsNumber() && b.IsNumber())
+		{
+			if (a.IsInt64() && b.IsInt64())
+				return a.GetInt64() == b.GetInt64();
+			if (a.IsUint64() && b.IsUint64())
+				return a.GetUint64() == b.GetUint64();
+
+			// Components hold floats, so a double written back may only match to float precision
+			const double x = a.GetDouble(), y = b.GetDouble();
+			return std::fabs(x - y) <= 1e-5 * std::max({ 1.0, std::fabs(x), std::fabs(y) });
+		}
+		if (a.GetType() != b.GetType())
+			return false;
+
+		if (a.IsObject())
+		{
+			if (a.MemberCount() != b.MemberCount())
+				return false;
+			for (auto it = a.MemberBegin(); it != a.MemberEnd(); ++it)
+			{
+				const std::string memberPath = path + "/" + it->name.GetString();
+				auto other = b.FindMember(it->name);
+				if (other == b.MemberEnd())
+				{
+					path = memberPath;
+					return false;
+				}
+				std::string childPath = memberPath;
+				if (!CompareJson(it->value, other->value, childPath))
+				{
+					path = childPath;
+					return false;
+				}
+			}
+			return true;
+		}
+
+		if (a.IsArray())
+		{
+			if (a.Size() != b.Size())
+				return false;
+			for (rapidjson::SizeType i = 0; i < a.Size(); ++i)
+			{
+				std::string childPath = path + "[" + std::to_string(i) + "]";
+				if (!CompareJson(a[i], b[i], childPath))
+				{
+					path = childPath;
+					return false;
+				}
+			}
+			return true;
+		}
+
+		if (a.IsString())
+			return a.GetStringLength() == b.GetStringLength() && std::memcmp(a.GetString(), b.GetString(), a.GetStringLength()) == 0;
+
+		return a == b;
+	}
+
+	/*!***********************************************************************
+	\brief		Check if this build counts heap allocations
+	*************************************************************************/
+	bool SerializerBenchmark::CountsAllocations()
+	{
+#ifdef SOL_SERIALIZER_BENCHMARK_ALLOCATIONS
+		return true;
+#else
+		return false;
+#endif
+	}
+}
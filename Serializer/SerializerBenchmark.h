@@ -0,0 +1,127 @@
+/******************************************************************************/
+/*!
+\file       SerializerBenchmark.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the SerializerBenchmark
+            class, which round trips every scene and prefab file through the
+            Serializer and reports what each phase costs
+
+            Each file goes through four timed phases:
+
+                Parse        JSON text to a rapidjson Document
+                Deserialize  every entity into a Prefab
+                Serialize    the Prefabs back to JSON text
+                Write        the text to a file
+
+            Phases report MB/s and entities/s. Building with
+            SOL_SERIALIZER_BENCHMARK_ALLOCATIONS defined replaces the global
+            operator new and delete in SerializerBenchmark.cpp, so each phase
+            also reports its heap allocation count and peak heap growth. Leave
+            it undefined in the engine and editor builds.
+
+            After the round trip the written file is loaded again and every
+            entity is compared to the entity loaded from the original, with
+            prefab deltas resolved, so a file only passes if the engine loads
+            exactly the same thing from it.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _SERIALIZERBENCHMARK_H_
+#define _SERIALIZERBENCHMARK_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include "ComponentReflection.h"
+
+namespace SOL
+{
+    class SerializerBenchmark
+    {
+    public:
+
+        enum Phase
+        {
+            PHASE_PARSE,
+            PHASE_DESERIALIZE,
+            PHASE_SERIALIZE,
+            PHASE_WRITE,
+            PHASE_COUNT
+        };
+
+        /*!***********************************************************************
+        \brief		Totals of one phase over every file and iteration.
+        *************************************************************************/
+        struct PhaseStats
+        {
+            double m_Seconds{};
+            size_t m_Bytes{};           //JSON bytes read or produced
+            size_t m_Entities{};
+            size_t m_Allocations{};     //0 unless allocations are counted
+            size_t m_PeakHeapBytes{};   //largest heap growth during one run of the phase
+        };
+
+        /*!***********************************************************************
+        \brief		The outcome of a benchmark run.
+        *************************************************************************/
+        struct Result
+        {
+            PhaseStats m_Phases[PHASE_COUNT];
+            size_t m_Files{};
+            size_t m_Iterations{};
+            std::vector<std::string> m_Failures;    //one line per file that failed to load or round trip
+        };
+
+        /*!***********************************************************************
+        \brief		Round trip every .json file in the directories.
+        \param      directories The directories to read, such as ./Json/Scene
+                    and ./Json/Prefab, iterations The number of round trips
+                    per file.
+        \return     The totals and the files that did not round trip.
+        *************************************************************************/
+        static Result Run(const std::vector<std::string>& directories, size_t iterations = 1);
+
+        /*!***********************************************************************
+        \brief		Round trip the scenes and prefabs shipped with the game.
+        \param      iterations The number of round trips per file.
+        \return     The totals and the files that did not round trip.
+        *************************************************************************/
+        static Result RunDefault(size_t iterations = 1);
+
+        /*!***********************************************************************
+        \brief		Write a table of the results.
+        \param      result The results, out The stream to write to.
+        *************************************************************************/
+        static void Report(const Result& result, std::ostream& out);
+
+        /*!***********************************************************************
+        \brief		Compare two JSON values, ignoring member order and float
+                    rounding.
+        \param      a The first value, b The second value, path Receives the
+                    path of the first difference.
+        \return     True if the values are equal.
+        *************************************************************************/
+        static bool CompareJson(const JsonValue& a, const JsonValue& b, std::string& path);
+
+        /*!***********************************************************************
+        \brief		Check if this build counts heap allocations.
+        *************************************************************************/
+        static bool CountsAllocations();
+
+    private:
+
+        /*!***********************************************************************
+        \brief		Round trip one file.
+        \param      filePath The file, iterations The number of round trips,
+                    result Receives the totals and any failure.
+        *************************************************************************/
+        static void RunFile(const std::string& filePath, size_t iterations, Result& result);
+    };
+}
+#endif  //_SERIALIZERBENCHMARK_H_
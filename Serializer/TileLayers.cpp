@@ -0,0 +1,561 @@
+/******************************************************************************/
+/*!
+\file		TileLayers.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the TileLayers class, which
+		stores grid aligned tile entities of a scene as run length encoded
+		tile layer blocks
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "TileLayers.h"
+#include <algorithm>
+#include <cmath>
+
+namespace SOL
+{
+	const char* const TileLayers::s_TileLayersKey = "TileLayers";
+
+	namespace
+	{
+		const uint64_t s_MaxLayerCells = 1 << 24;	//bounds the grid of a corrupt or very sparse block
+		const uint64_t s_MaxCellsPerTile = 64;		//sparser runs are left as entities
+
+		/*!***********************************************************************
+		\brief		The grid of a tile layer block with its runs decoded
+		*************************************************************************/
+		struct LayerGrid
+		{
+			double m_Origin[2]{};
+			double m_CellSize[2]{};
+			uint32_t m_Width{};
+			uint32_t m_Height{};
+			std::vector<uint32_t> m_Cells;		//palette index + 1, 0 if empty
+			const JsonValue* m_Groups{};
+			const JsonValue* m_Palette{};
+		};
+
+		/*!***********************************************************************
+		\brief		Gets the Transform array of a tile entity
+		\return		nullptr if the entity is not a tile with a position
+		*************************************************************************/
+		const JsonValue* GetTilePosition(const JsonValue& entity)
+		{
+			if (!entity.IsObject() || !entity.HasMember("TileComponent"))
+				return nullptr;
+
+			auto transform = entity.FindMember("TransformComponent");
+			if (transform == entity.MemberEnd() || !transform->value.IsObject())
+				return nullptr;
+
+			auto position = transform->value.FindMember("Transform");
+			if (position == transform->value.MemberEnd() || !position->value.IsArray() || position->value.Size() < 2 ||
+				!position->value[0u].IsNumber() || !position->value[1u].IsNumber())
+			{
+				return nullptr;
+			}
+			return &position->value;
+		}
+
+		/*!***********************************************************************
+		\brief		Gets the Name member of an entity
+		\return		nullptr if the entity has no name
+		*************************************************************************/
+		const JsonValue* GetName(const JsonValue& entity)
+		{
+			auto name = entity.FindMember("NameComponent");
+			if (name == entity.MemberEnd() || !name->value.IsObject())
+				return nullptr;
+
+			auto text = name->value.FindMember("Name");
+			return text != name->value.MemberEnd() && text->value.IsString() ? &text->value : nullptr;
+		}
+
+		/*!***********************************************************************
+		\brief		Gets the group of a tile entity, its name without the
+					trailing _<n>
+		*************************************************************************/
+		std::string GetGroup(const JsonValue& entity)
+		{
+			const JsonValue* name = GetName(entity);
+			if (name == nullptr)
+				return std::string();
+
+			const std::string text(name->GetString(), name->GetStringLength());
+			const size_t separator = text.rfind('_');
+			return separator == std::string::npos ? text : text.substr(0, separator);
+		}
+
+		/*!***********************************************************************
+		\brief		Reads a two element number array
+		*************************************************************************/
+		bool ReadPair(const JsonValue& layer, const char* key, double (&values)[2])
+		{
+			auto it = layer.FindMember(key);
+			if (it == layer.MemberEnd() || !it->value.IsArray() || it->value.Size() != 2 ||
+				!it->value[0u].IsNumber() || !it->value[1u].IsNumber())
+			{
+				return false;
+			}
+			values[0] = it->value[0u].GetDouble();
+			values[1] = it->value[1u].GetDouble();
+			return true;
+		}
+
+		/*!***********************************************************************
+		\brief		Reads the header and decodes the runs of a tile layer block
+		*************************************************************************/
+		bool ReadLayer(const JsonValue& layer, LayerGrid& grid)
+		{
+			if (!layer.IsObject() || !ReadPair(layer, "Origin", grid.m_Origin) || !ReadPair(layer, "CellSize", grid.m_CellSize))
+				return false;
+
+			auto dimensions = layer.FindMember("Dimensions");
+			auto groups = layer.FindMember("Groups");
+			auto palette = layer.FindMember("Palette");
+			auto cells = layer.FindMember("Cells");
+			if (dimensions == layer.MemberEnd() || !dimensions->value.IsArray() || dimensions->value.Size() != 2 ||
+				!dimensions->value[0u].IsUint() || !dimensions->value[1u].IsUint() ||
+				groups == layer.MemberEnd() || !groups->value.IsArray() ||
+				palette == layer.MemberEnd() || !palette->value.IsArray() ||
+				cells == layer.MemberEnd() || !cells->value.IsArray() || cells->value.Size() % 2 != 0)
+			{
+				return false;
+			}
+
+			grid.m_Width = dimensions->value[0u].GetUint();
+			grid.m_Height = dimensions->value[1u].GetUint();
+			const uint64_t cellCount = static_cast<uint64_t>(grid.m_Width) * grid.m_Height;
+			if (cellCount > s_MaxLayerCells)
+				return false;
+
+			for (const auto& entry : palette->value.GetArray())
+			{
+				if (!entry.IsObject() || !entry.HasMember("Group") || !entry["Group"].IsUint() ||
+					entry["Group"].GetUint() >= groups->value.Size() || !entry.HasMember("Entity") ||
+					GetTilePosition(entry["Entity"]) == nullptr)
+				{
+					return false;
+				}
+			}
+
+			grid.m_Cells.clear();
+			grid.m_Cells.reserve(static_cast<size_t>(cellCount));
+			for (rapidjson::SizeType i = 0; i < cells->value.Size(); i += 2)
+			{
+				const JsonValue& run = cells->value[i];
+				const JsonValue& value = cells->value[i + 1];
+				if (!run.IsUint() || !value.IsUint() || value.GetUint() > palette->value.Size() ||
+					run.GetUint() > cellCount - grid.m_Cells.size())
+				{
+					return false;
+				}
+				grid.m_Cells.insert(grid.m_Cells.end(), run.GetUint(), value.GetUint());
+			}
+
+			grid.m_Groups = &groups->value;
+			grid.m_Palette = &palette->value;
+			return grid.m_Cells.size() == cellCount;
+		}
+
+		/*!***********************************************************************
+		\brief		Finds the grid spacing of tile coordinates, the smallest gap
+					between two distinct values
+		\return		0 if every tile has the same coordinate
+		*************************************************************************/
+		double FindCellSize(std::vector<double> values)
+		{
+			std::sort(values.begin(), values.end());
+			double cellSize = 0.0;
+			for (size_t i = 1; i < values.size(); ++i)
+			{
+				const double gap = values[i] - values[i - 1];
+				if (gap > 0.0 && (cellSize == 0.0 || gap < cellSize))
+					cellSize = gap;
+			}
+			return cellSize;
+		}
+
+		/*!***********************************************************************
+		\brief		Builds the tile layer block of a run of tile entities
+		\return		False if the run does not sit on a grid or the block would not
+					expand to exactly the same entities
+		*************************************************************************/
+		bool BuildLayer(const JsonValue& entities, rapidjson::SizeType begin, rapidjson::SizeType end,
+			rapidjson::Value& layer, rapidjson::Document::AllocatorType& allocator)
+		{
+			const size_t count = end - begin;
+			std::vector<double> xs(count), ys(count);
+			for (size_t k = 0; k < count; ++k)
+			{
+				const JsonValue& position = *GetTilePosition(entities[static_cast<rapidjson::SizeType>(begin + k)]);
+				xs[k] = position[0u].GetDouble();
+				ys[k] = position[1u].GetDouble();
+			}
+
+			const double origin[2] = { *std::min_element(xs.begin(), xs.end()), *std::min_element(ys.begin(), ys.end()) };
+			double cellSize[2] = { FindCellSize(xs), FindCellSize(ys) };
+			if (cellSize[0] == 0.0)
+				cellSize[0] = cellSize[1] != 0.0 ? cellSize[1] : 1.0;
+			if (cellSize[1] == 0.0)
+				cellSize[1] = cellSize[0];
+
+			// Every tile has to land exactly on a cell
+			std::vector<uint64_t> columns(count), rows(count);
+			uint64_t width = 0, height = 0;
+			for (size_t k = 0; k < count; ++k)
+			{
+				const double column = std::round((xs[k] - origin[0]) / cellSize[0]);
+				const double row = std::round((ys[k] - origin[1]) / cellSize[1]);
+				if (column >= static_cast<double>(s_MaxLayerCells) || row >= static_cast<double>(s_MaxLayerCells) ||
+					origin[0] + column * cellSize[0] != xs[k] || origin[1] + row * cellSize[1] != ys[k])
+				{
+					return false;
+				}
+				columns[k] = static_cast<uint64_t>(column);
+				rows[k] = static_cast<uint64_t>(row);
+				width = std::max(width, columns[k] + 1);
+				height = std::max(height, rows[k] + 1);
+			}
+			if (width * height > s_MaxLayerCells || width * height > count * s_MaxCellsPerTile)
+				return false;
+
+			rapidjson::Document scratch;
+			std::vector<uint32_t> cells(static_cast<size_t>(width * height), 0);
+			std::unordered_map<std::string, uint32_t> paletteLookup;
+			std::unordered_map<std::string, uint32_t> groupLookup;
+			rapidjson::Value groups(rapidjson::kArrayType);
+			rapidjson::Value palette(rapidjson::kArrayType);
+
+			for (size_t k = 0; k < count; ++k)
+			{
+				uint32_t& cell = cells[static_cast<size_t>(rows[k] * width + columns[k])];
+				if (cell != 0)
+					return false;
+
+				const JsonValue& entity = entities[static_cast<rapidjson::SizeType>(begin + k)];
+				const std::string group = GetGroup(entity);
+				auto groupIndex = groupLookup.emplace(group, groups.Size());
+				if (groupIndex.second)
+					groups.PushBack(rapidjson::Value(group.c_str(), static_cast<rapidjson::SizeType>(group.size()), allocator), allocator);
+
+				// The palette entry is the entity with its position and name cleared
+				rapidjson::Value tile(entity, scratch.GetAllocator());
+				JsonValue& position = tile["TransformComponent"]["Transform"];
+				position[0u].SetDouble(0.0);
+				position[1u].SetDouble(0.0);
+				if (const JsonValue* name = GetName(tile))
+					const_cast<JsonValue*>(name)->SetString("", 0, scratch.GetAllocator());
+
+				rapidjson::StringBuffer buffer;
+				rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+				tile.Accept(writer);
+				const std::string key = std::to_string(groupIndex.first->second) + ':' + buffer.GetString();
+
+				auto paletteIndex = paletteLookup.emplace(key, palette.Size());
+				if (paletteIndex.second)
+				{
+					rapidjson::Value entry(rapidjson::kObjectType);
+					entry.AddMember("Group", rapidjson::Value(groupIndex.first->second), allocator);
+					entry.AddMember("Entity", rapidjson::Value(tile, allocator), allocator);
+					palette.PushBack(entry, allocator);
+				}
+				cell = paletteIndex.first->second + 1;
+			}
+
+			rapidjson::Value runs(rapidjson::kArrayType);
+			for (size_t i = 0; i < cells.size();)
+			{
+				size_t next = i + 1;
+				while (next < cells.size() && cells[next] == cells[i])
+				{
+					++next;
+				}
+				runs.PushBack(rapidjson::Value(static_cast<unsigned>(next - i)), allocator);
+				runs.PushBack(rapidjson::Value(cells[i]), allocator);
+				i = next;
+			}
+
+			rapidjson::Value originValue(rapidjson::kArrayType), cellSizeValue(rapidjson::kArrayType), dimensions(rapidjson::kArrayType);
+			originValue.PushBack(rapidjson::Value(origin[0]), allocator).PushBack(rapidjson::Value(origin[1]), allocator);
+			cellSizeValue.PushBack(rapidjson::Value(cellSize[0]), allocator).PushBack(rapidjson::Value(cellSize[1]), allocator);
+			dimensions.PushBack(rapidjson::Value(static_cast<unsigned>(width)), allocator).PushBack(rapidjson::Value(static_cast<unsigned>(height)), allocator);
+
+			layer.SetObject();
+			layer.AddMember("EntityIndex", rapidjson::Value(static_cast<unsigned>(begin)), allocator);
+			layer.AddMember("Origin", originValue, allocator);
+			layer.AddMember("CellSize", cellSizeValue, allocator);
+			layer.AddMember("Dimensions", dimensions, allocator);
+			layer.AddMember("Groups", groups, allocator);
+			layer.AddMember("Palette", palette, allocator);
+			layer.AddMember("Cells", runs, allocator);
+
+			// Only keep the block if it gives back the same entities in the same order
+			rapidjson::Value expanded(rapidjson::kArrayType);
+			if (!TileLayers::ExpandLayer(layer, expanded, scratch.GetAllocator()) || expanded.Size() != count)
+				return false;
+			for (size_t k = 0; k < count; ++k)
+			{
+				if (expanded[static_cast<rapidjson::SizeType>(k)] != entities[static_cast<rapidjson::SizeType>(begin + k)])
+					return false;
+			}
+			return true;
+		}
+
+		/*!***********************************************************************
+		\brief		Gets the tile layer blocks of a scene in entity order
+		*************************************************************************/
+		std::vector<const JsonValue*> GetSortedLayers(const JsonValue& layers)
+		{
+			std::vector<const JsonValue*> sorted;
+			if (!layers.IsArray())
+				return sorted;
+
+			for (const auto& layer : layers.GetArray())
+			{
+				if (layer.IsObject() && layer.HasMember("EntityIndex") && layer["EntityIndex"].IsUint())
+					sorted.push_back(&layer);
+			}
+			std::stable_sort(sorted.begin(), sorted.end(),
+				[](const JsonValue* a, const JsonValue* b) { return (*a)["EntityIndex"].GetUint() < (*b)["EntityIndex"].GetUint(); });
+			return sorted;
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Replace runs of grid aligned tile entities with tile layer blocks
+	*************************************************************************/
+	size_t TileLayers::Pack(rapidjson::Document& scene, size_t minTiles)
+	{
+		Expand(scene);
+		if (!scene.IsObject() || !scene.HasMember("Entities") || !scene["Entities"].IsArray())
+			return 0;
+
+		rapidjson::Document::AllocatorType& allocator = scene.GetAllocator();
+		rapidjson::Value& entities = scene["Entities"];
+		rapidjson::Value kept(rapidjson::kArrayType);
+		rapidjson::Value layers(rapidjson::kArrayType);
+		size_t packed = 0;
+
+		for (rapidjson::SizeType i = 0; i < entities.Size();)
+		{
+			rapidjson::SizeType end = i;
+			while (end < entities.Size() && GetTilePosition(entities[end]) != nullptr)
+			{
+				++end;
+			}
+
+			rapidjson::Value layer;
+			if (end - i >= std::max<size_t>(minTiles, 1) && BuildLayer(entities, i, end, layer, allocator))
+			{
+				layers.PushBack(layer, allocator);
+				packed += end - i;
+				i = end;
+				continue;
+			}
+
+			// Not a tile, or a run that does not pack, is kept as it is
+			end = std::max(end, i + 1);
+			for (; i < end; ++i)
+			{
+				kept.PushBack(entities[i], allocator);
+			}
+		}
+
+		entities.Swap(kept);
+		if (packed == 0)
+			return 0;
+
+		// Blocks go before the entities so a streaming reader has them in time
+		rapidjson::Value entityArray;
+		entityArray.Swap(entities);
+		scene.EraseMember(scene.FindMember("Entities"));
+		scene.AddMember(rapidjson::StringRef(s_TileLayersKey), layers, allocator);
+		scene.AddMember("Entities", entityArray, allocator);
+		return packed;
+	}
+
+	/*!***********************************************************************
+	\brief		Replace the tile layer blocks of a scene with their entities
+	*************************************************************************/
+	size_t TileLayers::Expand(rapidjson::Document& scene)
+	{
+		if (!scene.IsObject() || !scene.HasMember(s_TileLayersKey) || !scene.HasMember("Entities") || !scene["Entities"].IsArray())
+			return 0;
+
+		rapidjson::Document::AllocatorType& allocator = scene.GetAllocator();
+		rapidjson::Value& entities = scene["Entities"];
+		rapidjson::Value merged(rapidjson::kArrayType);
+		rapidjson::SizeType next = 0;
+		size_t restored = 0;
+
+		for (const JsonValue* layer : GetSortedLayers(scene[s_TileLayersKey]))
+		{
+			const size_t index = (*layer)["EntityIndex"].GetUint();
+			while (merged.Size() < index && next < entities.Size())
+			{
+				merged.PushBack(entities[next++], allocator);
+			}
+
+			rapidjson::Value tiles(rapidjson::kArrayType);
+			if (!ExpandLayer(*layer, tiles, allocator))
+			{
+				ENGINE_ERROR("Tile layer block is corrupt, its tiles were not loaded.");
+				continue;
+			}
+			restored += tiles.Size();
+			for (auto& tile : tiles.GetArray())
+			{
+				merged.PushBack(tile, allocator);
+			}
+		}
+
+		while (next < entities.Size())
+		{
+			merged.PushBack(entities[next++], allocator);
+		}
+		entities.Swap(merged);
+		scene.EraseMember(scene.FindMember(s_TileLayersKey));
+		return restored;
+	}
+
+	/*!***********************************************************************
+	\brief		List the entities of a scene in load order
+	*************************************************************************/
+	bool TileLayers::GatherEntities(const JsonValue& scene, rapidjson::Document& tiles, std::vector<const JsonValue*>& entities)
+	{
+		entities.clear();
+		tiles.SetArray();
+		if (!scene.IsObject() || !scene.HasMember("Entities") || !scene["Entities"].IsArray())
+			return false;
+
+		const JsonValue& sceneEntities = scene["Entities"];
+		auto layers = scene.FindMember(s_TileLayersKey);
+		if (layers == scene.MemberEnd())
+		{
+			for (const auto& entity : sceneEntities.GetArray())
+			{
+				entities.push_back(&entity);
+			}
+			return true;
+		}
+
+		// Expand every block before taking pointers, the array moves as it grows
+		const std::vector<const JsonValue*> sorted = GetSortedLayers(layers->value);
+		std::vector<rapidjson::SizeType> ends;
+		for (const JsonValue* layer : sorted)
+		{
+			if (!ExpandLayer(*layer, tiles, tiles.GetAllocator()))
+				return false;
+			ends.push_back(tiles.Size());
+		}
+
+		rapidjson::SizeType next = 0, tile = 0;
+		for (size_t l = 0; l < sorted.size(); ++l)
+		{
+			const size_t index = (*sorted[l])["EntityIndex"].GetUint();
+			while (entities.size() < index && next < sceneEntities.Size())
+			{
+				entities.push_back(&sceneEntities[next++]);
+			}
+			for (; tile < ends[l]; ++tile)
+			{
+				entities.push_back(&tiles[tile]);
+			}
+		}
+		while (next < sceneEntities.Size())
+		{
+			entities.push_back(&sceneEntities[next++]);
+		}
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Expand one tile layer block into entities
+	*************************************************************************/
+	bool TileLayers::ExpandLayer(const JsonValue& layer, rapidjson::Value& entities, rapidjson::Document::AllocatorType& allocator)
+	{
+		LayerGrid grid;
+		if (!entities.IsArray() || !ReadLayer(layer, grid))
+			return false;
+
+		for (rapidjson::SizeType g = 0; g < grid.m_Groups->Size(); ++g)
+		{
+			const JsonValue& group = (*grid.m_Groups)[g];
+			const std::string prefix = group.IsString() ? std::string(group.GetString(), group.GetStringLength()) : std::string();
+			size_t number = 0;
+
+			for (uint32_t row = 0; row < grid.m_Height; ++row)
+			{
+				for (uint32_t column = 0; column < grid.m_Width; ++column)
+				{
+					const uint32_t cell = grid.m_Cells[static_cast<size_t>(row) * grid.m_Width + column];
+					if (cell == 0)
+						continue;
+
+					const JsonValue& entry = (*grid.m_Palette)[cell - 1];
+					if (entry["Group"].GetUint() != g)
+						continue;
+
+					rapidjson::Value entity(entry["Entity"], allocator);
+					JsonValue& position = entity["TransformComponent"]["Transform"];
+					position[0u].SetDouble(grid.m_Origin[0] + column * grid.m_CellSize[0]);
+					position[1u].SetDouble(grid.m_Origin[1] + row * grid.m_CellSize[1]);
+					if (const JsonValue* name = GetName(entity))
+					{
+						const std::string text = prefix + '_' + std::to_string(number);
+						const_cast<JsonValue*>(name)->SetString(text.c_str(), static_cast<rapidjson::SizeType>(text.size()), allocator);
+					}
+					++number;
+					entities.PushBack(entity, allocator);
+				}
+			}
+		}
+		return true;
+	}
+
+	/*!***********************************************************************
+	\brief		Read one tile layer block into a grid
+	*************************************************************************/
+	bool TileLayers::ReadTileMap(const JsonValue& layer, TileMap& map)
+	{
+		LayerGrid grid;
+		if (!ReadLayer(layer, grid))
+			return false;
+
+		// Look each palette entry up once, the cells only index them
+		std::vector<uint32_t> tileTypes(grid.m_Palette->Size() + 1, s_EmptyTile);
+		std::vector<uint64_t> textures(grid.m_Palette->Size() + 1, 0);
+		for (rapidjson::SizeType p = 0; p < grid.m_Palette->Size(); ++p)
+		{
+			const JsonValue& entity = (*grid.m_Palette)[p]["Entity"];
+			const JsonValue& tile = entity["TileComponent"];
+			tileTypes[p + 1] = tile.IsObject() && tile.HasMember("TileType") && tile["TileType"].IsUint() ? tile["TileType"].GetUint() : 0;
+
+			auto sprite = entity.FindMember("SpriteComponent");
+			if (sprite != entity.MemberEnd() && sprite->value.IsObject() && sprite->value.HasMember("UUID") && sprite->value["UUID"].IsUint64())
+				textures[p + 1] = sprite->value["UUID"].GetUint64();
+		}
+
+		map.m_Origin[0] = grid.m_Origin[0];
+		map.m_Origin[1] = grid.m_Origin[1];
+		map.m_CellSize[0] = grid.m_CellSize[0];
+		map.m_CellSize[1] = grid.m_CellSize[1];
+		map.m_Width = grid.m_Width;
+		map.m_Height = grid.m_Height;
+		map.m_TileTypes.resize(grid.m_Cells.size());
+		map.m_Textures.resize(grid.m_Cells.size());
+		for (size_t i = 0; i < grid.m_Cells.size(); ++i)
+		{
+			map.m_TileTypes[i] = tileTypes[grid.m_Cells[i]];
+			map.m_Textures[i] = textures[grid.m_Cells[i]];
+		}
+		return true;
+	}
+}
@@ -0,0 +1,113 @@
+/******************************************************************************/
+/*!
+\file       TileLayers.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the TileLayers class,
+            which stores grid aligned tile entities of a scene as run length
+            encoded tile layer blocks
+
+            Terrain is authored as one entity per tile, each with a full
+            transform, sprite and name. Pack finds runs of tile entities that
+            sit on a grid and replaces each run with a block in "TileLayers":
+
+                { "EntityIndex": 143,
+                  "Origin": [ 0.0, 0.0 ],
+                  "CellSize": [ 100.0, 100.0 ],
+                  "Dimensions": [ 20, 16 ],
+                  "Groups": [ "Stone", "Terrain" ],
+                  "Palette": [ { "Group": 0, "Entity": { ... } }, ... ],
+                  "Cells": [ 20, 1, 1, 2, ... ] }
+
+            Cells holds (run length, palette index + 1) pairs in row major
+            order, 0 marks an empty cell. A palette entry is a tile entity with
+            its position and name cleared. Expanding a block gives every group
+            in turn, its cells in row major order, named <group>_<n>. A run is
+            only packed if expanding it gives back exactly the same entities,
+            so packing is lossless.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _TILELAYERS_H_
+#define _TILELAYERS_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <rapidjson/document.h>
+#include "ComponentReflection.h"
+
+namespace SOL
+{
+    class TileLayers
+    {
+    public:
+
+        static const char* const s_TileLayersKey;       //top level member holding the blocks
+        static const size_t s_MinLayerTiles = 16;       //shorter runs are left as entities
+        static const uint32_t s_EmptyTile = UINT32_MAX; //TileMap tile type of an empty cell
+
+        /*!***********************************************************************
+        \brief		A tile layer block read straight into a grid, for systems
+                    that draw or collide terrain without one entity per tile.
+        *************************************************************************/
+        struct TileMap
+        {
+            double m_Origin[2]{};
+            double m_CellSize[2]{};
+            uint32_t m_Width{};
+            uint32_t m_Height{};
+            std::vector<uint32_t> m_TileTypes;  //per cell in row major order, s_EmptyTile if empty
+            std::vector<uint64_t> m_Textures;   //per cell sprite UUID, 0 if empty or without a sprite
+        };
+
+        /*!***********************************************************************
+        \brief		Replace runs of grid aligned tile entities with tile layer
+                    blocks. Blocks already in the scene are expanded first.
+                    Called on every scene write, by Serializer::writeSceneFile
+                    and by EditJournal compaction.
+        \param      scene The scene document, minTiles The shortest run packed.
+        \return     The number of entities packed.
+        *************************************************************************/
+        static size_t Pack(rapidjson::Document& scene, size_t minTiles = s_MinLayerTiles);
+
+        /*!***********************************************************************
+        \brief		Replace the tile layer blocks of a scene with their entities.
+        \param      scene The scene document.
+        \return     The number of entities restored.
+        *************************************************************************/
+        static size_t Expand(rapidjson::Document& scene);
+
+        /*!***********************************************************************
+        \brief		List the entities of a scene in load order, expanding tile
+                    layer blocks into a document of their own instead of
+                    changing the scene.
+        \param      scene The scene object, tiles Receives the expanded tile
+                    entities, entities Receives every entity.
+        \return     False if the value is not a scene object or a block is
+                    corrupt.
+        *************************************************************************/
+        static bool GatherEntities(const JsonValue& scene, rapidjson::Document& tiles, std::vector<const JsonValue*>& entities);
+
+        /*!***********************************************************************
+        \brief		Expand one tile layer block into entities.
+        \param      layer The block, entities Receives the entities,
+                    allocator The allocator of entities.
+        \return     False if the block is corrupt.
+        *************************************************************************/
+        static bool ExpandLayer(const JsonValue& layer, rapidjson::Value& entities, rapidjson::Document::AllocatorType& allocator);
+
+        /*!***********************************************************************
+        \brief		Read one tile layer block into a grid.
+        \param      layer The block, map Receives the grid.
+        \return     False if the block is corrupt.
+        *************************************************************************/
+        static bool ReadTileMap(const JsonValue& layer, TileMap& map);
+    };
+}
+#endif  //_TILELAYERS_H_
@@ -0,0 +1,188 @@
+/******************************************************************************/
+/*!
+\file		WorldSnapshot.cpp
+\author		Ang Jie Le Jet
+\date       18 October 2026
+
+\brief  This file consists of the definitions for the WorldSnapshot class,
+		which copies the live component state of a scene into a buffer and
+		restores it in place
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+#include "SOLpch.h"
+#include "WorldSnapshot.h"
+#include "SOL/AssetManager/ContentHash.h"
+#include "SOL/ECS/Components/TransformComponent.h"
+#include "SOL/ECS/Components/AudioComponent.h"
+#include "SOL/ECS/Components/CPPScriptComponent.h"
+#include <algorithm>
+
+namespace SOL
+{
+	/*!***********************************************************************
+	\brief		Forget the captured state, keeping the buffers
+	*************************************************************************/
+	void WorldSnapshot::Clear()
+	{
+		m_writer.GetBytes().clear();
+		m_records.clear();
+	}
+
+	/*!***********************************************************************
+	\brief		Replace the snapshot with the state of a set of entities
+	*************************************************************************/
+	void WorldSnapshot::Capture(const std::vector<EntityID>& entities, const ComponentResolver& resolve)
+	{
+		Clear();
+
+		m_order.assign(entities.begin(), entities.end());
+		std::sort(m_order.begin(), m_order.end());
+		m_order.erase(std::unique(m_order.begin(), m_order.end()), m_order.end());
+
+		for (EntityID entity : m_order)
+		{
+			for (size_t type = 0; type < s_ComponentTypeCount; ++type)
+			{
+				const ComponentTypeID id = static_cast<ComponentTypeID>(type);
+				if (const Components* component = resolve(entity, id))
+					Add(entity, id, *component);
+			}
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Append one component to the snapshot
+	*************************************************************************/
+	void WorldSnapshot::Add(EntityID entity, ComponentTypeID id, const Components& component)
+	{
+		const ComponentDescriptor* descriptor = ComponentReflection::GetDescriptor(id);
+		if (descriptor == nullptr)
+			return;
+
+		const size_t offset = m_writer.GetBytes().size();
+		descriptor->WriteBinary(m_writer, component);
+		m_records.push_back({ entity, id, static_cast<uint32_t>(offset), static_cast<uint32_t>(m_writer.GetBytes().size() - offset) });
+	}
+
+	/*!***********************************************************************
+	\brief		Write the captured state back into the live components
+	*************************************************************************/
+	bool WorldSnapshot::Restore(const ComponentResolver& resolve, std::vector<EntityID>* missing) const
+	{
+		const uint8_t* bytes = m_writer.GetBytes().data();
+		bool restored = true;
+
+		for (const Record& record : m_records)
+		{
+			Components* component = resolve(record.m_Entity, record.m_ID);
+			if (component == nullptr)
+			{
+				// Records of an entity are adjacent, so it is listed once
+				if (missing != nullptr && (missing->empty() || missing->back() != record.m_Entity))
+					missing->push_back(record.m_Entity);
+				restored = false;
+				continue;
+			}
+
+			BinaryReader reader(bytes + record.m_Offset, record.m_Size);
+			if (!ComponentReflection::GetDescriptor(record.m_ID)->ReadBinary(reader, *component))
+			{
+				ENGINE_ERROR("World snapshot could not restore a component.");
+				std::cerr << "Error: World snapshot could not restore " << ComponentReflection::GetComponentName(record.m_ID)
+					<< " of entity " << record.m_Entity << ".\n";
+				restored = false;
+			}
+		}
+		return restored;
+	}
+
+	/*!***********************************************************************
+	\brief		Get the captured entities in the order they were captured
+	*************************************************************************/
+	void WorldSnapshot::GetEntities(std::vector<EntityID>& entities) const
+	{
+		entities.clear();
+		for (const Record& record : m_records)
+		{
+			if (entities.empty() || entities.back() != record.m_Entity)
+				entities.push_back(record.m_Entity);
+		}
+	}
+
+	/*!***********************************************************************
+	\brief		Hash the captured state
+	*************************************************************************/
+	uint64_t WorldSnapshot::GetHash() const
+	{
+		ContentHash hash = hashBytes(m_records.data(), m_records.size() * sizeof(Record));
+		return hashBytes(m_writer.GetBytes().data(), m_writer.GetBytes().size(), hash);
+	}
+
+	/*!***********************************************************************
+	\brief		Function to test snapshot restore (For Developers to
+				Maintain/Debug code)
+	*************************************************************************/
+	bool WorldSnapshot::RestoreTester()
+	{
+		ENGINE_INFO("TESTING WORLD SNAPSHOT RESTORE");
+		const EntityID entity = 7;
+		TransformComponent transform;
+		AudioComponent audio;
+		CPPScriptComponent scripts;
+
+		ComponentResolver resolve = [&](EntityID id, ComponentTypeID type) -> Components*
+		{
+			if (id != entity)
+				return nullptr;
+			switch (type)
+			{
+			case ComponentTypeID::TransformComponent: return &transform;
+			case ComponentTypeID::AudioComponent: return &audio;
+			case ComponentTypeID::CPPScriptComponent: return &scripts;
+			default: return nullptr;
+			}
+		};
+
+		//State at the checkpoint
+		transform.m_Transform = { 111.0f, 111.0f };
+		transform.m_Rotation = 111.0f;
+		AudioComponent::AudioControl jump{};
+		jump.m_AudioKey = "SFX_jump";
+		jump.m_Volume = 0.5f;
+		audio.m_AudioControlMap["Jump"] = jump;
+		scripts.m_Scripts[(CPPScript_Type)0] = nullptr;
+
+		WorldSnapshot snapshot;
+		snapshot.Capture({ entity }, resolve);
+		const uint64_t captured = snapshot.GetHash();
+
+		//Change plain and CUSTOM fields after the capture
+		transform.m_Transform = { 222.0f, 222.0f };
+		transform.m_Rotation = 222.0f;
+		audio.m_AudioControlMap["Jump"].m_Volume = 1.0f;
+		audio.m_AudioControlMap["Land"] = jump;
+		scripts.m_Scripts[(CPPScript_Type)1] = nullptr;
+
+		bool passed = snapshot.Restore(resolve);
+		passed = passed && transform.m_Transform.x == 111.0f && transform.m_Rotation == 111.0f;
+		passed = passed && audio.m_AudioControlMap.size() == 1 && audio.m_AudioControlMap.count("Jump") &&
+			audio.m_AudioControlMap["Jump"].m_Volume == 0.5f;
+		passed = passed && scripts.m_Scripts.size() == 1 && scripts.m_Scripts.count((CPPScript_Type)0);
+
+		//Restoring twice gives the same state
+		WorldSnapshot restored;
+		passed = passed && snapshot.Restore(resolve);
+		restored.Capture({ entity }, resolve);
+		passed = passed && restored.GetHash() == captured;
+
+		if (passed)
+			ENGINE_INFO("World snapshot restore passed.");
+		else
+			ENGINE_ERROR("World snapshot restore did not give back the captured state.");
+		return passed;
+	}
+}
@@ -0,0 +1,132 @@
+/******************************************************************************/
+/*!
+\file       WorldSnapshot.h
+\author     Ang Jie Le Jet
+\date       18 October 2026
+
+\brief      This file consists of the declarations for the WorldSnapshot
+            class, a copy of the live component state of a scene kept in
+            memory and restored in place
+
+            Capture writes every described component of the given entities
+            with its binary codec into one buffer, Restore reads them back
+            into the live components. Nothing is parsed, created or looked up
+            by name, so a checkpoint respawn or the debug reset costs about as
+            much as copying the bytes, and the same snapshot always restores
+            the same state.
+
+            The ECS is reached through a ComponentResolver, which returns the
+            live component of an entity or nullptr if the entity does not have
+            it, e.g.
+
+            snapshot.Capture(entities, [&](WorldSnapshot::EntityID e, ComponentTypeID id)
+                { return ecs.TryGetComponent(e, id); });
+
+            Only the fields in the component tables are kept, runtime state
+            that is not serialized is rebuilt by the post load fix ups the
+            same way as after a scene load. Entities destroyed since the
+            capture are reported by Restore, recreate them and restore again.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+ /******************************************************************************/
+
+#ifndef _WORLDSNAPSHOT_H_
+#define _WORLDSNAPSHOT_H_
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include "ComponentReflection.h"
+#include "BinaryStream.h"
+
+namespace SOL
+{
+    class WorldSnapshot
+    {
+    public:
+
+        using EntityID = uint32_t;
+        using ComponentResolver = std::function<Components*(EntityID entity, ComponentTypeID id)>;
+
+        /*!***********************************************************************
+        \brief		Forget the captured state, the buffers are kept for the next
+                    capture.
+        *************************************************************************/
+        void Clear();
+
+        /*!***********************************************************************
+        \brief		Replace the snapshot with the state of a set of entities.
+                    Entities are captured in ascending order and their
+                    components in ComponentTypeID order, whatever order they
+                    are given in.
+        \param      entities The entities, resolve Gets their live components.
+        *************************************************************************/
+        void Capture(const std::vector<EntityID>& entities, const ComponentResolver& resolve);
+
+        /*!***********************************************************************
+        \brief		Append one component to the snapshot.
+        \param      entity The entity, id The component type,
+                    component The live component.
+        *************************************************************************/
+        void Add(EntityID entity, ComponentTypeID id, const Components& component);
+
+        /*!***********************************************************************
+        \brief		Write the captured state back into the live components, in
+                    the order it was captured.
+        \param      resolve Gets the live components,
+                    missing If given, receives every entity with a captured
+                    component that resolve did not return.
+        \return     False if a component was missing or could not be read.
+        *************************************************************************/
+        bool Restore(const ComponentResolver& resolve, std::vector<EntityID>* missing = nullptr) const;
+
+        /*!***********************************************************************
+        \brief		Get the captured entities in the order they were captured.
+        \param      entities Receives the entities.
+        *************************************************************************/
+        void GetEntities(std::vector<EntityID>& entities) const;
+
+        /*!***********************************************************************
+        \brief		Check if nothing has been captured.
+        *************************************************************************/
+        bool IsEmpty() const { return m_records.empty(); }
+
+        /*!***********************************************************************
+        \brief		Get the number of captured components and their size.
+        *************************************************************************/
+        size_t GetComponentCount() const { return m_records.size(); }
+        size_t GetByteSize() const { return m_writer.GetBytes().size(); }
+
+        /*!***********************************************************************
+        \brief		Hash the captured state, equal hashes mean equal worlds, for
+                    checking that a respawn restored what was captured.
+        *************************************************************************/
+        uint64_t GetHash() const;
+
+        /*!***********************************************************************
+        \brief		Function to test snapshot restore (For Developers to
+                    Maintain/Debug code).
+        \return     True if a restore undid every change made after the
+                    capture, including changes to CUSTOM fields.
+        *************************************************************************/
+        static bool RestoreTester();
+
+    private:
+
+        struct Record
+        {
+            EntityID m_Entity;
+            ComponentTypeID m_ID;
+            uint32_t m_Offset;          //into the buffer
+            uint32_t m_Size;
+        };
+
+        BinaryWriter m_writer;
+        std::vector<Record> m_records;
+        std::vector<EntityID> m_order;  //scratch for sorting the entities of a capture
+    };
+}
+#endif  //_WORLDSNAPSHOT_H_